@@ -49,6 +49,8 @@ namespace EE
     {
         cli::Parser cmdParser( argc, argv );
         cmdParser.set_optional<std::string>( "map", "map", "", "The startup map." );
+        cmdParser.set_optional<std::string>( "capture", "capture", "", "Record the game world session to this file." );
+        cmdParser.set_optional<std::string>( "replay", "replay", "", "Replay a recorded game world session and write out the frame timings." );
 
         if ( !cmdParser.run() )
         {
@@ -61,6 +63,23 @@ namespace EE
             m_engine.m_startupMap = DataPath( map.c_str() );
         }
 
+        std::string const capturePath = cmdParser.get<std::string>( "capture" );
+        std::string const replayPath = cmdParser.get<std::string>( "replay" );
+        if ( !capturePath.empty() && !replayPath.empty() )
+        {
+            return FatalError( "Cannot capture and replay a session at the same time!" );
+        }
+
+        if ( !capturePath.empty() )
+        {
+            m_engine.m_sessionCapturePath = FileSystem::Path( capturePath.c_str() );
+        }
+
+        if ( !replayPath.empty() )
+        {
+            m_engine.m_sessionReplayPath = FileSystem::Path( replayPath.c_str() );
+        }
+
         return true;
     }
 
@@ -9,7 +9,10 @@
 #include "Base/Time/Timers.h"
 #include "Base/Resource/Settings/GlobalSettings_Resource.h"
 #include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/FileSystem/FileSystem.h"
 #include "Base/Settings/IniFile.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Types/HashMap.h"
 
 #include <windows.h>
 #include <iostream>
@@ -27,6 +30,7 @@ namespace EE
             cli::Parser cmdParser( argc, argv );
             cmdParser.set_default<bool>( false );
             cmdParser.set_optional<std::string>( "compile", "compile", "", "Compile resource" );
+            cmdParser.set_optional<std::string>( "batch", "batch", "", "Compile all resources listed (one data path per line) in the specified file." );
             cmdParser.set_optional<bool>( "debug", "debug", false, "Trigger debug break before execution." );
             cmdParser.set_optional<bool>( "force", "force", false, "Force compilation" );
             cmdParser.set_optional<bool>( "package", "package", false, "Compile resource for packaged build." );
@@ -37,19 +41,29 @@ namespace EE
                 m_isForcedCompilation = cmdParser.get<bool>( "force" );
                 m_isForPackagedBuild = cmdParser.get<bool>( "package" );
 
+                // Get batch argument
+                std::string const batchFilePath = cmdParser.get<std::string>( "batch" );
+                if ( !batchFilePath.empty() )
+                {
+                    m_isBatchCompilation = true;
+                    m_isValid = ReadBatchFile( batchFilePath.c_str() );
+                    return;
+                }
+
                 // Get compile argument
                 DataPath const resourcePath( cmdParser.get<std::string>( "compile" ).c_str() );
                 if ( resourcePath.IsValid() )
                 {
-                    m_resourceID = ResourceID( resourcePath );
+                    ResourceID const resourceID( resourcePath );
 
-                    if ( m_resourceID.IsValid() )
+                    if ( resourceID.IsValid() )
                     {
+                        m_resourceIDs.emplace_back( resourceID );
                         m_isValid = true;
                     }
                     else
                     {
-                        EE_LOG_ERROR( "Resource", "Resource Compiler", "Invalid compile request: %s\n", m_resourceID.ToString().c_str() );
+                        EE_LOG_ERROR( "Resource", "Resource Compiler", "Invalid compile request: %s\n", resourceID.ToString().c_str() );
                     }
 
                     return;
@@ -57,11 +71,58 @@ namespace EE
             }
         }
 
+        bool ReadBatchFile( char const* pBatchFilePath )
+        {
+            String fileContents;
+            if ( !FileSystem::ReadTextFile( pBatchFilePath, fileContents ) )
+            {
+                EE_LOG_ERROR( "Resource", "Resource Compiler", "Failed to read batch file: %s\n", pBatchFilePath );
+                return false;
+            }
+
+            TVector<String> lines;
+            StringUtils::Split( fileContents, lines, "\r\n" );
+
+            // Build machines generate these lists so duplicates are likely, we cant compile the same resource twice concurrently
+            THashMap<ResourceID, bool> uniqueResourceIDs;
+            uniqueResourceIDs.reserve( lines.size() );
+
+            for ( auto& line : lines )
+            {
+                line.trim();
+                if ( line.empty() )
+                {
+                    continue;
+                }
+
+                ResourceID const resourceID( line );
+                if ( !resourceID.IsValid() )
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Compiler", "Invalid compile request in batch file: %s\n", line.c_str() );
+                    return false;
+                }
+
+                if ( uniqueResourceIDs.insert( { resourceID, true } ).second )
+                {
+                    m_resourceIDs.emplace_back( resourceID );
+                }
+            }
+
+            if ( m_resourceIDs.empty() )
+            {
+                EE_LOG_ERROR( "Resource", "Resource Compiler", "Batch file contains no compile requests: %s\n", pBatchFilePath );
+                return false;
+            }
+
+            return true;
+        }
+
         bool IsValid() const { return m_isValid; }
 
     public:
 
-        ResourceID          m_resourceID;
+        TVector<ResourceID> m_resourceIDs;
+        bool                m_isBatchCompilation = false;
         bool                m_triggerDebugBreak = false;
         bool                m_isForPackagedBuild = false;
         bool                m_isForcedCompilation = false;
@@ -155,14 +216,21 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
+    ResourceCompilerApplication::CompileJob::~CompileJob()
+    {
+        m_compileDependencyTreeRoot.DestroyDependencies();
+        EE::Delete( m_pCompileContext );
+    }
+
+    //-------------------------------------------------------------------------
+
     ResourceCompilerApplication::ResourceCompilerApplication()
         : m_settingsRegistry( m_typeRegistry )
     {}
 
     ResourceCompilerApplication::~ResourceCompilerApplication()
     {
-        EE_ASSERT( m_pCompileContext == nullptr );
-        EE_ASSERT( m_pCompilerRegistry == nullptr );
+        EE_ASSERT( m_pTaskSystem == nullptr );
         EE_ASSERT( m_pCompilerRegistry == nullptr );
     }
 
@@ -195,14 +263,25 @@ namespace EE::Resource
 
         m_pCompilerRegistry = EE::New<CompilerRegistry>( m_typeRegistry, pSettings->m_sourceDataDirectoryPath );
 
-        // Setup compile context
+        // Setup compile request
         //-------------------------------------------------------------------------
 
         m_forceCompilation = argParser.m_isForcedCompilation;
+        m_isForPackagedBuild = argParser.m_isForPackagedBuild;
+        m_isBatchCompilation = argParser.m_isBatchCompilation;
+        m_resourcesToCompile = argParser.m_resourceIDs;
 
-        m_pCompileContext = EE::New<CompileContext>( pSettings->m_sourceDataDirectoryPath, argParser.m_isForPackagedBuild ? pSettings->m_packagedBuildCompiledResourceDirectoryPath : pSettings->m_compiledResourceDirectoryPath, argParser.m_resourceID, argParser.m_isForPackagedBuild );
-        m_pCompileContext->m_sourceDataDirectoryPath.EnsureDirectoryExists();
-        m_pCompileContext->m_compiledResourceDirectoryPath.EnsureDirectoryExists();
+        m_sourceDataDirectoryPath = pSettings->m_sourceDataDirectoryPath;
+        m_compiledResourceDirectoryPath = m_isForPackagedBuild ? pSettings->m_packagedBuildCompiledResourceDirectoryPath : pSettings->m_compiledResourceDirectoryPath;
+        m_sourceDataDirectoryPath.EnsureDirectoryExists();
+        m_compiledResourceDirectoryPath.EnsureDirectoryExists();
+
+        // Batch compilations run all checks and compiles on a worker pool
+        if ( m_isBatchCompilation )
+        {
+            m_pTaskSystem = EE::New<TaskSystem>( Threading::GetProcessorInfo().m_numLogicalCores );
+            m_pTaskSystem->Initialize();
+        }
 
         //-------------------------------------------------------------------------
 
@@ -211,9 +290,12 @@ namespace EE::Resource
 
     void ResourceCompilerApplication::Shutdown()
     {
-        m_compileDependencyTreeRoot.DestroyDependencies();
-      
-        EE::Delete( m_pCompileContext );
+        if ( m_pTaskSystem != nullptr )
+        {
+            m_pTaskSystem->WaitForAll();
+            m_pTaskSystem->Shutdown();
+            EE::Delete( m_pTaskSystem );
+        }
 
         EE::Delete( m_pCompilerRegistry );
 
@@ -250,42 +332,186 @@ namespace EE::Resource
             return Resource::CompilationResult::Failure;
         }
 
+        return m_isBatchCompilation ? RunBatch() : RunSingle();
+    }
+
+    CompilationResult ResourceCompilerApplication::RunSingle()
+    {
+        EE_ASSERT( m_resourcesToCompile.size() == 1 );
+
+        CompileJob job( m_resourcesToCompile[0] );
+        if ( !PrepareJob( job ) )
+        {
+            return job.m_result;
+        }
+
+        EE_LOG_INFO( "Resource", "Resource Compiler", "Up to Date Check took: %.2fms", job.m_upToDateCheckTime.ToFloat() );
+
+        if ( !job.m_requiresCompilation )
+        {
+            EE_LOG_INFO( "Resource", "Resource Compiler", "Resource is up to date, nothing to do!" );
+            return job.m_result;
+        }
+
+        ExecuteJob( job );
+
+        EE_LOG_INFO( "Resource", "Resource Compiler", "Compilation took: %.2fms", job.m_compileTime.ToFloat() );
+        EE_LOG_INFO( "Resource", "Resource Compiler", "Total time: %.2fms", ( job.m_upToDateCheckTime + job.m_compileTime ).ToFloat() );
+
+        return job.m_result;
+    }
+
+    CompilationResult ResourceCompilerApplication::RunBatch()
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+
+        TVector<CompileJob*> jobs;
+        jobs.reserve( m_resourcesToCompile.size() );
+        for ( ResourceID const& resourceID : m_resourcesToCompile )
+        {
+            jobs.emplace_back( EE::New<CompileJob>( resourceID ) );
+        }
+
+        int32_t const numJobs = (int32_t) jobs.size();
+
+        // Run all up-to-date checks in parallel
+        //-------------------------------------------------------------------------
+
+        Milliseconds upToDateCheckTime = 0.0f;
+        {
+            ScopedTimer<PlatformClock> upToDateCheckTimer( upToDateCheckTime );
+
+            AsyncTask upToDateCheckTask( numJobs, [this, &jobs] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    PrepareJob( *jobs[i] );
+                }
+            } );
+
+            m_pTaskSystem->ScheduleTask( &upToDateCheckTask );
+            m_pTaskSystem->WaitForTask( &upToDateCheckTask );
+        }
+
+        // Compile all stale resources in parallel
+        //-------------------------------------------------------------------------
+
+        TVector<CompileJob*> jobsToCompile;
+        for ( CompileJob* pJob : jobs )
+        {
+            if ( pJob->m_requiresCompilation )
+            {
+                jobsToCompile.emplace_back( pJob );
+            }
+        }
+
+        Milliseconds compileTime = 0.0f;
+        if ( !jobsToCompile.empty() )
+        {
+            ScopedTimer<PlatformClock> compileTimer( compileTime );
+
+            // Compile times vary wildly between resources, so dont batch them
+            // Note: only compilers that are marked as threadsafe actually compile concurrently, all others are serialized in 'ExecuteJob'
+            AsyncTask compileTask( (uint32_t) jobsToCompile.size(), [this, &jobsToCompile] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    ExecuteJob( *jobsToCompile[i] );
+                }
+            } );
+            compileTask.m_MinRange = 1;
+
+            m_pTaskSystem->ScheduleTask( &compileTask );
+            m_pTaskSystem->WaitForTask( &compileTask );
+        }
+
+        // Gather results
+        //-------------------------------------------------------------------------
+
+        int32_t numUpToDate = 0, numCompiled = 0, numWithWarnings = 0, numFailed = 0;
+        for ( CompileJob* pJob : jobs )
+        {
+            switch ( pJob->m_result )
+            {
+                case CompilationResult::SuccessUpToDate: numUpToDate++; break;
+                case CompilationResult::Success: numCompiled++; break;
+                case CompilationResult::SuccessWithWarnings: numWithWarnings++; break;
+
+                default:
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Compiler", "Failed to compile: %s", pJob->m_resourceID.c_str() );
+                    numFailed++;
+                }
+                break;
+            }
+
+            EE::Delete( pJob );
+        }
+
+        EE_LOG_INFO( "Resource", "Resource Compiler", "Batch: %d resources, %d up to date, %d compiled, %d compiled with warnings, %d failed", numJobs, numUpToDate, numCompiled, numWithWarnings, numFailed );
+        EE_LOG_INFO( "Resource", "Resource Compiler", "Up to Date Checks took: %.2fms", upToDateCheckTime.ToFloat() );
+        EE_LOG_INFO( "Resource", "Resource Compiler", "Compilation took: %.2fms", compileTime.ToFloat() );
+        EE_LOG_INFO( "Resource", "Resource Compiler", "Total time: %.2fms", ( upToDateCheckTime + compileTime ).ToFloat() );
+
+        //-------------------------------------------------------------------------
+
+        if ( numFailed > 0 )
+        {
+            return CompilationResult::Failure;
+        }
+
+        if ( numWithWarnings > 0 )
+        {
+            return CompilationResult::SuccessWithWarnings;
+        }
+
+        return ( numCompiled > 0 ) ? CompilationResult::Success : CompilationResult::SuccessUpToDate;
+    }
+
+    bool ResourceCompilerApplication::PrepareJob( CompileJob& job )
+    {
+        job.m_result = CompilationResult::Failure;
+        job.m_requiresCompilation = false;
+
         // Try create compilation context
-        if ( m_pCompileContext != nullptr && !m_pCompileContext->IsValid() )
+        job.m_pCompileContext = EE::New<CompileContext>( m_sourceDataDirectoryPath, m_compiledResourceDirectoryPath, job.m_resourceID, m_isForPackagedBuild );
+        if ( !job.m_pCompileContext->IsValid() )
         {
-            return Resource::CompilationResult::Failure;
+            return false;
         }
 
         // Try find compiler
-        auto pCompiler = m_pCompilerRegistry->GetCompilerForResourceType( m_pCompileContext->m_resourceID.GetResourceTypeID() );
-        if ( pCompiler == nullptr )
+        job.m_pCompiler = m_pCompilerRegistry->GetCompilerForResourceType( job.m_resourceID.GetResourceTypeID() );
+        if ( job.m_pCompiler == nullptr )
         {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Cant find appropriate resource compiler for type: %u", m_pCompileContext->m_resourceID.GetResourceTypeID() );
-            return Resource::CompilationResult::Failure;
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Cant find appropriate resource compiler for type: %u", job.m_resourceID.GetResourceTypeID() );
+            return false;
         }
 
         // Validate request
         //-------------------------------------------------------------------------
 
+        CompileContext* pCompileContext = job.m_pCompileContext;
+
         // Validate input path
-        if ( pCompiler->IsInputFileRequired() && !FileSystem::Exists( m_pCompileContext->m_inputFilePath ) )
+        if ( job.m_pCompiler->IsInputFileRequired() && !FileSystem::Exists( pCompileContext->m_inputFilePath ) )
         {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Source file for data path ('%s') does not exist: '%s'\n", m_pCompileContext->m_sourceDataDirectoryPath.c_str(), m_pCompileContext->m_inputFilePath.c_str() );
-            return Resource::CompilationResult::Failure;
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Source file for data path ('%s') does not exist: '%s'\n", pCompileContext->m_sourceDataDirectoryPath.c_str(), pCompileContext->m_inputFilePath.c_str() );
+            return false;
         }
 
         // Try create target directory
-        if ( !m_pCompileContext->m_outputFilePath.EnsureDirectoryExists() )
+        if ( !pCompileContext->m_outputFilePath.EnsureDirectoryExists() )
         {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Error: Destination path (%s) doesnt exist!", m_pCompileContext->m_outputFilePath.GetParentDirectory().c_str() );
-            return Resource::CompilationResult::Failure;
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Error: Destination path (%s) doesnt exist!", pCompileContext->m_outputFilePath.GetParentDirectory().c_str() );
+            return false;
         }
 
         // Check that target file isn't read-only
-        if ( FileSystem::Exists( m_pCompileContext->m_outputFilePath ) && FileSystem::IsFileReadOnly( m_pCompileContext->m_outputFilePath ) )
+        if ( FileSystem::Exists( pCompileContext->m_outputFilePath ) && FileSystem::IsFileReadOnly( pCompileContext->m_outputFilePath ) )
         {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Error: Destination file (%s) is read-only!", m_pCompileContext->m_outputFilePath.GetFullPath().c_str() );
-            return Resource::CompilationResult::Failure;
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Error: Destination file (%s) is read-only!", pCompileContext->m_outputFilePath.GetFullPath().c_str() );
+            return false;
         }
 
         // Basic Up-To-Date Check
@@ -293,102 +519,106 @@ namespace EE::Resource
 
         bool requiresCompilation = true;
 
-        Milliseconds upToDateCheckTime = 0.0f;
-        {
-            ScopedTimer<PlatformClock> upToDateCheckTimer( upToDateCheckTime );
+        ScopedTimer<PlatformClock> upToDateCheckTimer( job.m_upToDateCheckTime );
 
-            // Check compile dependency and if this resource needs compilation
-            m_uniqueCompileDependencies.clear();
-            m_compileDependencyTreeRoot.Reset();
-            if ( !FillCompileDependencyNode( &m_compileDependencyTreeRoot, m_pCompileContext->m_resourceID.GetDataPath() ) )
-            {
-                EE_LOG_ERROR( "Resource", "Resource Compiler", "Failed to create dependency tree: %s", m_errorMessage.c_str() );
-                return Resource::CompilationResult::Failure;
-            }
-
-            m_pCompileContext->m_sourceResourceHash = m_compileDependencyTreeRoot.m_combinedHash;
-            requiresCompilation = !m_compileDependencyTreeRoot.IsUpToDate();
+        // Check compile dependency and if this resource needs compilation
+        if ( !BuildCompileDependencyTree( job ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Failed to create dependency tree for %s: %s", job.m_resourceID.c_str(), job.m_errorMessage.c_str() );
+            return false;
         }
 
-        EE_LOG_INFO( "Resource", "Resource Compiler", "Up to Date Check took: %.2fms", upToDateCheckTime.ToFloat() );
+        pCompileContext->m_sourceResourceHash = job.m_compileDependencyTreeRoot.m_combinedHash;
+        requiresCompilation = !job.m_compileDependencyTreeRoot.IsUpToDate();
 
         // Advanced Up-To-Date Check
         //-------------------------------------------------------------------------
 
-        if ( pCompiler->RequiresAdvancedUpToDateCheck( m_pCompileContext->m_resourceID.GetResourceTypeID() ) )
+        if ( job.m_pCompiler->RequiresAdvancedUpToDateCheck( job.m_resourceID.GetResourceTypeID() ) )
         {
             // Always calculate the advanced hash
-            Milliseconds advancedUpToDateCheckTime = 0.0f;
+            if ( job.m_pCompiler->IsThreadSafe() )
             {
-                ScopedTimer<PlatformClock> advancedUpToDateCheckTimer( advancedUpToDateCheckTime );
-                m_pCompileContext->m_advancedUpToDateHash = pCompiler->CalculateAdvancedUpToDateHash( m_pCompileContext->m_resourceID );
+                pCompileContext->m_advancedUpToDateHash = job.m_pCompiler->CalculateAdvancedUpToDateHash( job.m_resourceID );
+            }
+            else
+            {
+                Threading::ScopeLock lock( m_nonThreadSafeCompilerMutex );
+                pCompileContext->m_advancedUpToDateHash = job.m_pCompiler->CalculateAdvancedUpToDateHash( job.m_resourceID );
             }
-
-            EE_LOG_INFO( "Resource", "Resource Compiler", "Advanced Up to Date Check took: %.2fms", advancedUpToDateCheckTime.ToFloat() );
 
             // If we passed the basic up to date check, check the advanced hash
             if ( !requiresCompilation )
             {
                 CompiledResourceRecord compiledRecord;
-                if ( m_compiledResourceDB.GetRecord( m_pCompileContext->m_resourceID, compiledRecord ) )
+                if ( GetCompiledResourceRecord( job.m_resourceID, compiledRecord ) )
                 {
-                    requiresCompilation = ( compiledRecord.m_advancedUpToDateHash != m_pCompileContext->m_advancedUpToDateHash );
+                    requiresCompilation = ( compiledRecord.m_advancedUpToDateHash != pCompileContext->m_advancedUpToDateHash );
                 }
             }
         }
 
-        // Should we proceed with the compilation?
         //-------------------------------------------------------------------------
 
-        if ( !requiresCompilation && !m_forceCompilation )
-        {
-            EE_LOG_INFO( "Resource", "Resource Compiler", "Resource is up to date, nothing to do!" );
-            return Resource::CompilationResult::SuccessUpToDate;
-        }
+        job.m_requiresCompilation = requiresCompilation || m_forceCompilation;
+        job.m_result = CompilationResult::SuccessUpToDate;
+        return true;
+    }
 
-        // Compile
-        //-------------------------------------------------------------------------
+    void ResourceCompilerApplication::ExecuteJob( CompileJob& job )
+    {
+        EE_ASSERT( job.m_requiresCompilation && job.m_pCompiler != nullptr && job.m_pCompileContext != nullptr );
 
-        Resource::CompilationResult compilationResult;
+        ScopedTimer<PlatformClock> compileTimer( job.m_compileTime );
 
-        Milliseconds compileTime = 0.0f;
+        if ( job.m_pCompiler->IsThreadSafe() )
         {
-            ScopedTimer<PlatformClock> compileTimer( compileTime );
-
-            compilationResult = pCompiler->Compile( *m_pCompileContext );
+            job.m_result = job.m_pCompiler->Compile( *job.m_pCompileContext );
+        }
+        else
+        {
+            Threading::ScopeLock lock( m_nonThreadSafeCompilerMutex );
+            job.m_result = job.m_pCompiler->Compile( *job.m_pCompileContext );
+        }
 
-            // Update database
-            if ( compilationResult == Resource::CompilationResult::Success || compilationResult == Resource::CompilationResult::SuccessWithWarnings )
-            {
-                Resource::CompiledResourceRecord record;
-                record.m_resourceID = m_pCompileContext->m_resourceID;
-                record.m_compilerVersion = m_compileDependencyTreeRoot.m_compilerVersion;
-                record.m_fileTimestamp = m_compileDependencyTreeRoot.m_timestamp;
-                record.m_sourceTimestampHash = m_pCompileContext->m_sourceResourceHash;
-                record.m_advancedUpToDateHash = m_pCompileContext->m_advancedUpToDateHash;
-                m_compiledResourceDB.WriteRecord( record );
-            }
+        // Update database
+        if ( job.m_result == Resource::CompilationResult::Success || job.m_result == Resource::CompilationResult::SuccessWithWarnings )
+        {
+            Resource::CompiledResourceRecord record;
+            record.m_resourceID = job.m_resourceID;
+            record.m_compilerVersion = job.m_compileDependencyTreeRoot.m_compilerVersion;
+            record.m_fileTimestamp = job.m_compileDependencyTreeRoot.m_timestamp;
+            record.m_sourceTimestampHash = job.m_pCompileContext->m_sourceResourceHash;
+            record.m_advancedUpToDateHash = job.m_pCompileContext->m_advancedUpToDateHash;
+            WriteCompiledResourceRecord( record );
         }
+    }
 
-        EE_LOG_INFO( "Resource", "Resource Compiler", "Compilation took: %.2fms", compileTime.ToFloat() );
-        EE_LOG_INFO( "Resource", "Resource Compiler", "Total time: %.2fms", ( upToDateCheckTime + compileTime ).ToFloat() );
+    bool ResourceCompilerApplication::GetCompiledResourceRecord( ResourceID const& resourceID, CompiledResourceRecord& outRecord )
+    {
+        Threading::ScopeLock lock( m_compiledResourceDBMutex );
+        return m_compiledResourceDB.GetRecord( resourceID, outRecord );
+    }
 
-        return compilationResult;
+    void ResourceCompilerApplication::WriteCompiledResourceRecord( CompiledResourceRecord const& record )
+    {
+        Threading::ScopeLock lock( m_compiledResourceDBMutex );
+        m_compiledResourceDB.WriteRecord( record );
     }
 
-    bool ResourceCompilerApplication::BuildCompileDependencyTree( ResourceID const& resourceID )
+    bool ResourceCompilerApplication::BuildCompileDependencyTree( CompileJob& job )
     {
-        EE_ASSERT( resourceID.IsValid() );
+        EE_ASSERT( job.m_resourceID.IsValid() );
 
         //-------------------------------------------------------------------------
 
-        m_errorMessage.clear();
-        m_uniqueCompileDependencies.clear();
-        m_compileDependencyTreeRoot.Reset();
-        return FillCompileDependencyNode( &m_compileDependencyTreeRoot, resourceID.GetDataPath() );
+        job.m_errorMessage.clear();
+        job.m_uniqueCompileDependencies.clear();
+        job.m_compileDependencyTreeRoot.Reset();
+        return FillCompileDependencyNode( job, &job.m_compileDependencyTreeRoot, job.m_resourceID.GetDataPath() );
     }
 
-    bool ResourceCompilerApplication::TryReadCompileDependencies( ResourceID const& resourceID, TVector<DataPath>& outDependencies )
+    bool ResourceCompilerApplication::TryReadCompileDependencies( CompileJob& job, ResourceID const& resourceID, TVector<DataPath>& outDependencies )
     {
         EE_ASSERT( resourceID.IsValid() );
 
@@ -406,7 +636,7 @@ namespace EE::Resource
             ResourceTypeID const parentResourceTypeID = parentResourceID.GetResourceTypeID();
             if ( !m_typeRegistry.IsRegisteredResourceType( parentResourceTypeID ) )
             {
-                m_errorMessage.sprintf( "Invalid parent resource type detected for: %s", resourceID.c_str() );
+                job.m_errorMessage.sprintf( "Invalid parent resource type detected for: %s", resourceID.c_str() );
                 return false;
             }
 
@@ -414,7 +644,7 @@ namespace EE::Resource
         }
         else
         {
-            FileSystem::Path const resourceFilePath = resourceID.GetFileSystemPath( m_pCompileContext->m_sourceDataDirectoryPath );
+            FileSystem::Path const resourceFilePath = resourceID.GetFileSystemPath( m_sourceDataDirectoryPath );
 
             auto pDescriptor = ResourceDescriptor::TryReadFromFile( m_typeRegistry, resourceFilePath );
             if ( pDescriptor == nullptr )
@@ -430,7 +660,7 @@ namespace EE::Resource
         return true;
     }
 
-    bool ResourceCompilerApplication::FillCompileDependencyNode( CompileDependencyNode* pNode, DataPath const& resourcePath )
+    bool ResourceCompilerApplication::FillCompileDependencyNode( CompileJob& job, CompileDependencyNode* pNode, DataPath const& resourcePath )
     {
         EE_ASSERT( pNode != nullptr );
         EE_ASSERT( resourcePath.IsValid() );
@@ -439,7 +669,7 @@ namespace EE::Resource
         //-------------------------------------------------------------------------
 
         pNode->m_ID = resourcePath;
-        pNode->m_sourcePath = resourcePath.GetFileSystemPath( m_pCompileContext->m_sourceDataDirectoryPath );
+        pNode->m_sourcePath = resourcePath.GetFileSystemPath( m_sourceDataDirectoryPath );
         pNode->m_sourceExists = FileSystem::Exists( pNode->m_sourcePath );
         pNode->m_timestamp = pNode->m_sourceExists ? FileSystem::GetFileModifiedTime( pNode->m_sourcePath ) : 0;
 
@@ -459,7 +689,7 @@ namespace EE::Resource
             skipDependencyCheck = !isCompilableResource || !ShouldCheckCompileDependenciesForResourceType( pNode->m_ID );
             if ( isCompilableResource )
             {
-                pNode->m_targetPath = resourcePath.GetFileSystemPath( m_pCompileContext->m_compiledResourceDirectoryPath );
+                pNode->m_targetPath = resourcePath.GetFileSystemPath( m_compiledResourceDirectoryPath );
                 pNode->m_targetExists = FileSystem::Exists( pNode->m_targetPath );
 
                 if ( pNode->m_targetExists && pCompiler->WillGenerateAdditionalDataFile( resourceTypeID ) )
@@ -469,7 +699,7 @@ namespace EE::Resource
                 }
 
                 pNode->m_compilerVersion = pCompiler->GetVersion( resourceTypeID );
-                m_compiledResourceDB.GetRecord( pNode->m_ID, pNode->m_compiledRecord );
+                GetCompiledResourceRecord( pNode->m_ID, pNode->m_compiledRecord );
 
                 // Some compilers dont require an input file to run - these resources should always be recompiled!
                 if ( !pNode->m_sourceExists && !pCompiler->IsInputFileRequired() )
@@ -486,12 +716,12 @@ namespace EE::Resource
         if ( !skipDependencyCheck )
         {
             TVector<DataPath> dependencies;
-            if ( TryReadCompileDependencies( resourcePath, dependencies ) )
+            if ( TryReadCompileDependencies( job, resourcePath, dependencies ) )
             {
                 for ( auto const& dependencyResourceID : dependencies )
                 {
                     // Skip resources already in the tree!
-                    if ( VectorContains( m_uniqueCompileDependencies, dependencyResourceID ) )
+                    if ( VectorContains( job.m_uniqueCompileDependencies, dependencyResourceID ) )
                     {
                         continue;
                     }
@@ -504,7 +734,7 @@ namespace EE::Resource
                     {
                         if ( pNodeToCheck->m_ID == dependencyResourceID )
                         {
-                            m_errorMessage = "Circular dependency detected!";
+                            job.m_errorMessage = "Circular dependency detected!";
                             return false;
                         }
 
@@ -516,12 +746,12 @@ namespace EE::Resource
 
                     auto pChildDependencyNode = pNode->m_dependencies.emplace_back( EE::New<CompileDependencyNode>() );
                     pChildDependencyNode->m_pParentNode = pNode;
-                    if ( !FillCompileDependencyNode( pChildDependencyNode, dependencyResourceID ) )
+                    if ( !FillCompileDependencyNode( job, pChildDependencyNode, dependencyResourceID ) )
                     {
                         return false;
                     }
 
-                    m_uniqueCompileDependencies.emplace_back( dependencyResourceID );
+                    job.m_uniqueCompileDependencies.emplace_back( dependencyResourceID );
                 }
             }
             else
@@ -3,12 +3,15 @@
 #include "CompiledResourceDatabase.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Settings/SettingsRegistry.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
     struct CommandLineArgumentParser;
+    class TaskSystem;
 }
 
 //-------------------------------------------------------------------------
@@ -53,6 +56,26 @@ namespace EE::Resource
             TVector<CompileDependencyNode*>         m_dependencies;
         };
 
+        // All the state needed to check and compile a single resource, batch compilations create one of these per requested resource
+        struct CompileJob
+        {
+            CompileJob( ResourceID const& resourceID ) : m_resourceID( resourceID ) {}
+            ~CompileJob();
+
+        public:
+
+            ResourceID                              m_resourceID;
+            Compiler const*                         m_pCompiler = nullptr;
+            CompileContext*                         m_pCompileContext = nullptr;
+            CompileDependencyNode                   m_compileDependencyTreeRoot;
+            TVector<ResourceID>                     m_uniqueCompileDependencies;
+            String                                  m_errorMessage;
+            CompilationResult                       m_result = CompilationResult::Failure;
+            Milliseconds                            m_upToDateCheckTime = 0.0f;
+            Milliseconds                            m_compileTime = 0.0f;
+            bool                                    m_requiresCompilation = true;
+        };
+
     public:
 
         static bool ShouldCheckCompileDependenciesForResourceType( ResourceID const& resourceID );
@@ -69,21 +92,37 @@ namespace EE::Resource
 
     private:
 
-        bool BuildCompileDependencyTree( ResourceID const& resourceID );
-        bool TryReadCompileDependencies( ResourceID const& resourceID, TVector<DataPath>& outDependencies );
-        bool FillCompileDependencyNode( CompileDependencyNode* pNode, DataPath const& resourceID );
+        CompilationResult RunSingle();
+        CompilationResult RunBatch();
+
+        // Validate the request and run the basic and advanced up-to-date checks, returns false if the job failed
+        bool PrepareJob( CompileJob& job );
+
+        // Compile the resource and update the compiled resource database
+        void ExecuteJob( CompileJob& job );
+
+        bool BuildCompileDependencyTree( CompileJob& job );
+        bool TryReadCompileDependencies( CompileJob& job, ResourceID const& resourceID, TVector<DataPath>& outDependencies );
+        bool FillCompileDependencyNode( CompileJob& job, CompileDependencyNode* pNode, DataPath const& resourceID );
+
+        // The database connection is shared between all jobs so all access needs to be serialized
+        bool GetCompiledResourceRecord( ResourceID const& resourceID, CompiledResourceRecord& outRecord );
+        void WriteCompiledResourceRecord( CompiledResourceRecord const& record );
 
     private:
 
         TypeSystem::TypeRegistry                m_typeRegistry;
         Settings::SettingsRegistry              m_settingsRegistry;
         CompiledResourceDatabase                m_compiledResourceDB;
+        Threading::Mutex                        m_compiledResourceDBMutex;
+        Threading::Mutex                        m_nonThreadSafeCompilerMutex; // Serializes all compilers that are not threadsafe, since they may share importers/SDK state with each other
         CompilerRegistry*                       m_pCompilerRegistry = nullptr;
-        CompileContext*                         m_pCompileContext = nullptr;
+        TaskSystem*                             m_pTaskSystem = nullptr;
+        FileSystem::Path                        m_sourceDataDirectoryPath;
+        FileSystem::Path                        m_compiledResourceDirectoryPath;
+        TVector<ResourceID>                     m_resourcesToCompile;
+        bool                                    m_isBatchCompilation = false;
+        bool                                    m_isForPackagedBuild = false;
         bool                                    m_forceCompilation = false;
-
-        TVector<ResourceID>                     m_uniqueCompileDependencies;
-        CompileDependencyNode                   m_compileDependencyTreeRoot;
-        String                                  m_errorMessage;
     };
 }
\ No newline at end of file
@@ -306,7 +306,7 @@ namespace EE::Resource
         // Tools
         //-------------------------------------------------------------------------
 
-        m_pDataFileResaver = EE::New<DataFileResaver>( m_typeRegistry, m_pSettings->m_sourceDataDirectoryPath );
+        m_pDataFileResaver = EE::New<DataFileResaver>( m_typeRegistry, m_pSettings->m_sourceDataDirectoryPath, &m_taskSystem );
 
         return true;
     }
@@ -519,9 +519,8 @@ namespace EE::Resource
 
         if ( m_pDataFileResaver->IsResaving() )
         {
-            m_pDataFileResaver->UpdateResave( 10 );
-
-            if ( m_pDataFileResaver->GetProgress() == 1.0f )
+            // Files are resaved in parallel on the task system, this only tracks completion
+            if ( m_pDataFileResaver->UpdateResave() == 0 )
             {
                 EndResaveOfDataFiles();
             }
@@ -106,4 +106,40 @@ namespace EE::Input
             input.Clear();
         }
     }
+
+    void InputDevice::RecordState( RecordedDeviceState& outState ) const
+    {
+        outState.m_inputs.clear();
+        outState.m_isConnected = m_isConnected;
+
+        for ( size_t i = 0; i < m_inputs.size(); i++ )
+        {
+            LogicalInput const& input = m_inputs[i];
+            if ( input.IsInDefaultState() )
+            {
+                continue;
+            }
+
+            auto& recordedInput = outState.m_inputs.emplace_back();
+            recordedInput.m_ID = (uint16_t) i;
+            recordedInput.m_state = (uint8_t) input.m_state;
+            recordedInput.m_signal = (uint8_t) input.m_signal;
+            recordedInput.m_value = input.m_value;
+        }
+    }
+
+    void InputDevice::ReplayState( RecordedDeviceState const& state )
+    {
+        InputDevice::Clear();
+        m_isConnected = state.m_isConnected;
+
+        for ( auto const& recordedInput : state.m_inputs )
+        {
+            EE_ASSERT( recordedInput.m_ID < m_inputs.size() );
+            LogicalInput& input = m_inputs[recordedInput.m_ID];
+            input.m_state = (InputState) recordedInput.m_state;
+            input.m_signal = (LogicalInput::Signal) recordedInput.m_signal;
+            input.m_value = recordedInput.m_value;
+        }
+    }
 }
\ No newline at end of file
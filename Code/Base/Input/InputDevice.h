@@ -2,6 +2,8 @@
 
 #include "Input.h"
 #include "Base/Time/Time.h"
+#include "Base/Math/Math.h"
+#include "Base/Serialization/BinarySerialization.h"
 
 //-------------------------------------------------------------------------
 
@@ -18,6 +20,32 @@ namespace EE::Input
 
     //-------------------------------------------------------------------------
 
+    // The recorded logical state of an input device, used to deterministically replay input
+    // Only the inputs that are not in their default state are stored
+    struct RecordedDeviceState
+    {
+        EE_SERIALIZE( m_inputs, m_mousePosition, m_charKeyPressed, m_isConnected );
+
+        struct RecordedInput
+        {
+            EE_SERIALIZE( m_ID, m_state, m_signal, m_value );
+
+            uint16_t                m_ID = 0;
+            uint8_t                 m_state = 0;
+            uint8_t                 m_signal = 0;
+            float                   m_value = 0.0f;
+        };
+
+    public:
+
+        TVector<RecordedInput>      m_inputs;
+        Int2                        m_mousePosition = Int2::Zero; // Only used by keyboard/mouse devices
+        uint8_t                     m_charKeyPressed = 0; // Only used by keyboard/mouse devices
+        bool                        m_isConnected = false;
+    };
+
+    //-------------------------------------------------------------------------
+
     class InputDevice
     {
 
@@ -39,6 +67,7 @@ namespace EE::Input
 
             void Clear() { *this = LogicalInput(); }
             void Update();
+            inline bool IsInDefaultState() const { return m_state == InputState::None && m_signal == Signal::None && m_value == 0.0f; }
 
         private:
 
@@ -71,6 +100,12 @@ namespace EE::Input
         // Called to clear all inputs that this device modifies
         virtual void Clear();
 
+        // Record the current logical state of this device
+        virtual void RecordState( RecordedDeviceState& outState ) const;
+
+        // Replace the current logical state of this device with a previously recorded one
+        virtual void ReplayState( RecordedDeviceState const& state );
+
         //-------------------------------------------------------------------------
 
         inline InputState GetState( InputID ID ) const
@@ -17,4 +17,19 @@ namespace EE::Input
         m_movementDelta = Float2::Zero;
         InputDevice::Clear();
     }
+
+    void KeyboardMouseDevice::RecordState( RecordedDeviceState& outState ) const
+    {
+        InputDevice::RecordState( outState );
+        outState.m_mousePosition = m_position;
+        outState.m_charKeyPressed = m_charKeyPressed;
+    }
+
+    void KeyboardMouseDevice::ReplayState( RecordedDeviceState const& state )
+    {
+        InputDevice::ReplayState( state );
+        m_position = state.m_mousePosition;
+        m_charKeyPressed = state.m_charKeyPressed;
+        m_movementDelta = Float2::Zero;
+    }
 }
\ No newline at end of file
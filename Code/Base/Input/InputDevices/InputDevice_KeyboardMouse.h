@@ -36,6 +36,9 @@ namespace EE::Input
 
         virtual void Clear() override;
 
+        virtual void RecordState( RecordedDeviceState& outState ) const override;
+        virtual void ReplayState( RecordedDeviceState const& state ) override;
+
     private:
 
         uint8_t                             m_charKeyPressed = 0;
@@ -70,6 +70,24 @@ namespace EE::Input
         }
     }
 
+    void InputSystem::RecordState( TInlineVector<RecordedDeviceState, 5>& outDeviceStates ) const
+    {
+        outDeviceStates.resize( m_inputDevices.size() );
+        for ( size_t i = 0; i < m_inputDevices.size(); i++ )
+        {
+            m_inputDevices[i]->RecordState( outDeviceStates[i] );
+        }
+    }
+
+    void InputSystem::ReplayState( TInlineVector<RecordedDeviceState, 5> const& deviceStates )
+    {
+        EE_ASSERT( deviceStates.size() == m_inputDevices.size() );
+        for ( size_t i = 0; i < m_inputDevices.size(); i++ )
+        {
+            m_inputDevices[i]->ReplayState( deviceStates[i] );
+        }
+    }
+
     //-------------------------------------------------------------------------
 
     uint32_t InputSystem::GetNumConnectedControllers() const
@@ -40,6 +40,15 @@ namespace EE::Input
         // Forwards input messages to the various devices
         void ForwardInputMessageToInputDevices( GenericMessage const& inputMessage );
 
+        // Recording
+        //-------------------------------------------------------------------------
+
+        // Record the logical state of all input devices
+        void RecordState( TInlineVector<RecordedDeviceState, 5>& outDeviceStates ) const;
+
+        // Replace the logical state of all input devices with a previously recorded state, this is used instead of updating the devices when replaying input
+        void ReplayState( TInlineVector<RecordedDeviceState, 5> const& deviceStates );
+
         // Input Devices
         //-------------------------------------------------------------------------
 
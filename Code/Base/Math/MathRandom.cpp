@@ -52,4 +52,10 @@ namespace EE::Math
         Threading::ScopeLock lock( g_globalRandomMutex );
         return g_rng.GetFloat( min, max );
     }
+
+    void SetGlobalRandomSeed( uint32_t seed )
+    {
+        Threading::ScopeLock lock( g_globalRandomMutex );
+        g_rng = RNG( seed );
+    }
 }
\ No newline at end of file
@@ -52,4 +52,7 @@ namespace EE::Math
 
     // Get a random float value between [min, max]
     EE_BASE_API float GetRandomFloat( float min = 0, float max = 1.0f );
+
+    // Reseed the global generator, this makes all subsequent global random values deterministic (used for session replays)
+    EE_BASE_API void SetGlobalRandomSeed( uint32_t seed );
 }
\ No newline at end of file
@@ -8,6 +8,10 @@
     #include <stdlib.h>
 #endif
 
+#if EE_ENABLE_MEMORY_TAGGING
+    #include <atomic>
+#endif
+
 //-------------------------------------------------------------------------
 // Note: We dont globally overload the new or delete operators
 //-------------------------------------------------------------------------
@@ -94,6 +98,181 @@ namespace EE
             return 0;
             #endif
         }
+
+        //-------------------------------------------------------------------------
+        // Raw Allocation
+        //-------------------------------------------------------------------------
+
+        static void* AllocateRaw( size_t size, size_t alignment )
+        {
+            #if EE_USE_CUSTOM_ALLOCATOR
+            return rpaligned_alloc( alignment, size );
+            #elif _WIN32
+            return _aligned_malloc( size, alignment );
+            #endif
+        }
+
+        static void FreeRaw( void* pMemory )
+        {
+            #if EE_USE_CUSTOM_ALLOCATOR
+            rpfree( pMemory );
+            #elif _WIN32
+            _aligned_free( pMemory );
+            #endif
+        }
+
+        //-------------------------------------------------------------------------
+        // Tagging
+        //-------------------------------------------------------------------------
+
+        #if EE_ENABLE_MEMORY_TAGGING
+        static constexpr uint32_t const g_maxTagStackDepth = 32;
+        static constexpr uint8_t const g_numTags = (uint8_t) Tag::NumTags;
+
+        static char const* const g_tagNames[g_numTags] = { "Untagged", "Animation", "Entity", "Resource", "Physics", "Render", "Navigation", "AI", "Tools" };
+
+        // Stored directly in front of every allocation, the offset is from the start of the raw allocation to the user pointer
+        struct AllocationHeader
+        {
+            uint64_t                        m_size;
+            uint32_t                        m_offset;
+            Tag                             m_tag;
+            uint8_t                         m_padding[3];
+        };
+
+        static_assert( sizeof( AllocationHeader ) == 16, "The allocation header needs to be 16 bytes so as not to break the default alignment" );
+
+        // Each tag's counters are on their own cache line to avoid false sharing between subsystems allocating on different threads
+        struct alignas( 64 ) TagCounters
+        {
+            std::atomic<size_t>             m_currentBytes = 0;
+            std::atomic<size_t>             m_peakBytes = 0;
+            std::atomic<uint64_t>           m_numLiveAllocations = 0;
+            std::atomic<uint64_t>           m_totalAllocations = 0;
+            std::atomic<size_t>             m_budgetBytes = 0;
+        };
+
+        static TagCounters g_tagCounters[g_numTags];
+        static std::atomic<BudgetExceededCallback> g_budgetExceededCallback = nullptr;
+
+        static thread_local Tag g_tagStack[g_maxTagStackDepth];
+        static thread_local uint32_t g_tagStackSize = 0;
+
+        //-------------------------------------------------------------------------
+
+        static void TrackAllocation( Tag tag, size_t size, bool isNewAllocation )
+        {
+            TagCounters& counters = g_tagCounters[(uint8_t) tag];
+
+            if ( isNewAllocation )
+            {
+                counters.m_numLiveAllocations.fetch_add( 1, std::memory_order_relaxed );
+                counters.m_totalAllocations.fetch_add( 1, std::memory_order_relaxed );
+            }
+
+            size_t const previousBytes = counters.m_currentBytes.fetch_add( size, std::memory_order_relaxed );
+            size_t const currentBytes = previousBytes + size;
+
+            // Update high-water mark
+            size_t peakBytes = counters.m_peakBytes.load( std::memory_order_relaxed );
+            while ( currentBytes > peakBytes && !counters.m_peakBytes.compare_exchange_weak( peakBytes, currentBytes, std::memory_order_relaxed ) ) {}
+
+            // Only notify when we cross the budget, not for every allocation made while over budget
+            size_t const budgetBytes = counters.m_budgetBytes.load( std::memory_order_relaxed );
+            if ( budgetBytes > 0 && previousBytes <= budgetBytes && currentBytes > budgetBytes )
+            {
+                BudgetExceededCallback callback = g_budgetExceededCallback.load( std::memory_order_relaxed );
+                if ( callback != nullptr )
+                {
+                    callback( tag, currentBytes, budgetBytes );
+                }
+            }
+        }
+
+        static void TrackFree( Tag tag, size_t size, bool isFreedAllocation )
+        {
+            TagCounters& counters = g_tagCounters[(uint8_t) tag];
+
+            if ( isFreedAllocation )
+            {
+                counters.m_numLiveAllocations.fetch_sub( 1, std::memory_order_relaxed );
+            }
+
+            counters.m_currentBytes.fetch_sub( size, std::memory_order_relaxed );
+        }
+
+        inline static AllocationHeader* GetAllocationHeader( void* pMemory )
+        {
+            return reinterpret_cast<AllocationHeader*>( reinterpret_cast<uint8_t*>( pMemory ) - sizeof( AllocationHeader ) );
+        }
+
+        //-------------------------------------------------------------------------
+
+        char const* GetTagName( Tag tag )
+        {
+            EE_ASSERT( tag < Tag::NumTags );
+            return g_tagNames[(uint8_t) tag];
+        }
+
+        void PushTag( Tag tag )
+        {
+            EE_ASSERT( tag < Tag::NumTags );
+            EE_ASSERT( g_tagStackSize < g_maxTagStackDepth );
+            g_tagStack[g_tagStackSize++] = tag;
+        }
+
+        void PopTag()
+        {
+            EE_ASSERT( g_tagStackSize > 0 );
+            g_tagStackSize--;
+        }
+
+        Tag GetCurrentTag()
+        {
+            return ( g_tagStackSize > 0 ) ? g_tagStack[g_tagStackSize - 1] : Tag::Untagged;
+        }
+
+        TagStatistics GetTagStatistics( Tag tag )
+        {
+            EE_ASSERT( tag < Tag::NumTags );
+            TagCounters const& counters = g_tagCounters[(uint8_t) tag];
+
+            TagStatistics stats;
+            stats.m_currentBytes = counters.m_currentBytes.load( std::memory_order_relaxed );
+            stats.m_peakBytes = counters.m_peakBytes.load( std::memory_order_relaxed );
+            stats.m_numLiveAllocations = counters.m_numLiveAllocations.load( std::memory_order_relaxed );
+            stats.m_totalAllocations = counters.m_totalAllocations.load( std::memory_order_relaxed );
+            stats.m_budgetBytes = counters.m_budgetBytes.load( std::memory_order_relaxed );
+            return stats;
+        }
+
+        void GetAllTagStatistics( TagStatistics( &outStatistics )[(uint8_t) Tag::NumTags] )
+        {
+            for ( uint8_t i = 0; i < g_numTags; i++ )
+            {
+                outStatistics[i] = GetTagStatistics( (Tag) i );
+            }
+        }
+
+        void ResetTagPeaks()
+        {
+            for ( auto& counters : g_tagCounters )
+            {
+                counters.m_peakBytes.store( counters.m_currentBytes.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+            }
+        }
+
+        void SetTagBudget( Tag tag, size_t budgetBytes )
+        {
+            EE_ASSERT( tag < Tag::NumTags );
+            g_tagCounters[(uint8_t) tag].m_budgetBytes.store( budgetBytes, std::memory_order_relaxed );
+        }
+
+        void SetBudgetExceededCallback( BudgetExceededCallback callback )
+        {
+            g_budgetExceededCallback.store( callback, std::memory_order_relaxed );
+        }
+        #endif
     }
 
     //-------------------------------------------------------------------------
@@ -104,12 +283,23 @@ namespace EE
 
         if ( size == 0 ) return nullptr;
 
-        void* pMemory = nullptr;
+        #if EE_ENABLE_MEMORY_TAGGING
+        // The header offset is a multiple of the alignment so that the user pointer keeps the requested alignment
+        size_t const offset = ( alignment > sizeof( Memory::AllocationHeader ) ) ? alignment : sizeof( Memory::AllocationHeader );
+        uint8_t* pRawMemory = (uint8_t*) Memory::AllocateRaw( size + offset, offset );
+        if ( pRawMemory == nullptr )
+        {
+            return nullptr;
+        }
 
-        #if EE_USE_CUSTOM_ALLOCATOR
-        pMemory = rpaligned_alloc( alignment, size );
-        #elif _WIN32
-        pMemory = _aligned_malloc( size, alignment );
+        void* pMemory = pRawMemory + offset;
+        Memory::AllocationHeader* pHeader = Memory::GetAllocationHeader( pMemory );
+        pHeader->m_size = size;
+        pHeader->m_offset = (uint32_t) offset;
+        pHeader->m_tag = Memory::GetCurrentTag();
+        Memory::TrackAllocation( pHeader->m_tag, size, true );
+        #else
+        void* pMemory = Memory::AllocateRaw( size, alignment );
         #endif
 
         EE_ASSERT( Memory::IsAligned( pMemory, alignment ) );
@@ -122,7 +312,31 @@ namespace EE
 
         void* pReallocatedMemory = nullptr;
 
-        #if EE_USE_CUSTOM_ALLOCATOR
+        #if EE_ENABLE_MEMORY_TAGGING
+        if ( pMemory == nullptr )
+        {
+            return Alloc( newSize, originalAlignment );
+        }
+
+        // We cant realloc in place since the header needs to move with the data, so allocate a new block and copy
+        // The reallocated memory keeps the tag it was originally allocated with
+        Memory::AllocationHeader const originalHeader = *Memory::GetAllocationHeader( pMemory );
+        size_t const offset = originalHeader.m_offset;
+        uint8_t* pRawMemory = (uint8_t*) Memory::AllocateRaw( newSize + offset, offset );
+        if ( pRawMemory != nullptr )
+        {
+            pReallocatedMemory = pRawMemory + offset;
+            memcpy( pReallocatedMemory, pMemory, ( originalHeader.m_size < newSize ) ? (size_t) originalHeader.m_size : newSize );
+
+            Memory::AllocationHeader* pHeader = Memory::GetAllocationHeader( pReallocatedMemory );
+            *pHeader = originalHeader;
+            pHeader->m_size = newSize;
+
+            Memory::TrackFree( originalHeader.m_tag, (size_t) originalHeader.m_size, false );
+            Memory::TrackAllocation( originalHeader.m_tag, newSize, false );
+            Memory::FreeRaw( reinterpret_cast<uint8_t*>( pMemory ) - offset );
+        }
+        #elif EE_USE_CUSTOM_ALLOCATOR
         pReallocatedMemory = rprealloc( pMemory, newSize );
         #elif _WIN32
         pReallocatedMemory = _aligned_realloc( pMemory, newSize, originalAlignment );
@@ -136,10 +350,17 @@ namespace EE
     {
         EE_ASSERT( EE::Memory::g_isMemorySystemInitialized );
 
-        #if EE_USE_CUSTOM_ALLOCATOR
-        rpfree( (uint8_t*) pMemory );
-        #elif _WIN32
-        _aligned_free( pMemory );
+        #if EE_ENABLE_MEMORY_TAGGING
+        if ( pMemory == nullptr )
+        {
+            return;
+        }
+
+        Memory::AllocationHeader const* pHeader = Memory::GetAllocationHeader( pMemory );
+        Memory::TrackFree( pHeader->m_tag, (size_t) pHeader->m_size, true );
+        Memory::FreeRaw( reinterpret_cast<uint8_t*>( pMemory ) - pHeader->m_offset );
+        #else
+        Memory::FreeRaw( pMemory );
         #endif
 
         pMemory = nullptr;
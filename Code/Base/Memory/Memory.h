@@ -11,6 +11,11 @@
 #define EE_USE_CUSTOM_ALLOCATOR 1
 #define EE_DEFAULT_ALIGNMENT 8
 
+// Memory tagging attributes allocations to engine subsystems. This adds a 16 byte header to each allocation so is only enabled in development builds.
+#if EE_DEVELOPMENT_TOOLS
+#define EE_ENABLE_MEMORY_TAGGING 1
+#endif
+
 //-------------------------------------------------------------------------
 
 #ifdef _WIN32
@@ -25,6 +30,12 @@
 
 #endif
 
+#if EE_ENABLE_MEMORY_TAGGING
+    #define EE_MEMORY_TAG_SCOPE( TagName ) EE::Memory::ScopedTag const _memoryTagScope( EE::Memory::Tag::TagName )
+#else
+    #define EE_MEMORY_TAG_SCOPE( TagName )
+#endif
+
 //-------------------------------------------------------------------------
 
 namespace EE
@@ -77,6 +88,69 @@ namespace EE
 
         EE_BASE_API size_t GetTotalRequestedMemory();
         EE_BASE_API size_t GetTotalAllocatedMemory();
+
+        //-------------------------------------------------------------------------
+        // Tagging
+        //-------------------------------------------------------------------------
+        // Each thread has a stack of tags, allocations are attributed to the tag at the top of the allocating thread's stack
+        // Frees and reallocs are always attributed to the tag that the memory was originally allocated with
+        // Note: tags are not inherited by tasks, so tasks that should be attributed to a subsystem need to push their own tag
+
+        enum class Tag : uint8_t
+        {
+            Untagged = 0,
+            Animation,
+            Entity,
+            Resource,
+            Physics,
+            Render,
+            Navigation,
+            AI,
+            Tools,
+
+            NumTags,
+        };
+
+        struct TagStatistics
+        {
+            size_t                          m_currentBytes = 0;
+            size_t                          m_peakBytes = 0;            // High-water mark since startup or the last call to ResetTagPeaks
+            uint64_t                        m_numLiveAllocations = 0;
+            uint64_t                        m_totalAllocations = 0;     // All allocations made since startup
+            size_t                          m_budgetBytes = 0;          // Zero means that there is no budget set
+        };
+
+        // Called on the allocating thread whenever an allocation pushes a tag over its budget
+        // Note: this is called from within the allocator so be careful with what you do in the callback
+        using BudgetExceededCallback = void( * )( Tag tag, size_t currentBytes, size_t budgetBytes );
+
+        #if EE_ENABLE_MEMORY_TAGGING
+        EE_BASE_API char const* GetTagName( Tag tag );
+
+        EE_BASE_API void PushTag( Tag tag );
+        EE_BASE_API void PopTag();
+        EE_BASE_API Tag GetCurrentTag();
+
+        EE_BASE_API TagStatistics GetTagStatistics( Tag tag );
+        EE_BASE_API void GetAllTagStatistics( TagStatistics( &outStatistics )[(uint8_t) Tag::NumTags] );
+        EE_BASE_API void ResetTagPeaks();
+
+        EE_BASE_API void SetTagBudget( Tag tag, size_t budgetBytes );
+        EE_BASE_API void SetBudgetExceededCallback( BudgetExceededCallback callback );
+
+        //-------------------------------------------------------------------------
+
+        class [[nodiscard]] ScopedTag
+        {
+        public:
+
+            ScopedTag( Tag tag ) { PushTag( tag ); }
+            ~ScopedTag() { PopTag(); }
+
+            ScopedTag( ScopedTag const& ) = delete;
+            ScopedTag& operator=( ScopedTag const& ) = delete;
+        };
+        #endif
     }
 
     //-------------------------------------------------------------------------
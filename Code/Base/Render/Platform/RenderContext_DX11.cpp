@@ -496,6 +496,12 @@ namespace EE::Render
         m_pDeviceContext->DrawIndexed( vertexCount, indexStartIndex, vertexStartIndex );
     }
 
+    void RenderContext::DrawIndexedInstanced( uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t indexStartIndex, uint32_t vertexStartIndex, uint32_t instanceStartIndex ) const
+    {
+        EE_ASSERT( IsValid() );
+        m_pDeviceContext->DrawIndexedInstanced( indexCountPerInstance, instanceCount, indexStartIndex, vertexStartIndex, instanceStartIndex );
+    }
+
     void RenderContext::Dispatch( uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ ) const
     {
         EE_ASSERT( IsValid() );
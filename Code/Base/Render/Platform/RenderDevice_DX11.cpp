@@ -536,6 +536,12 @@ namespace EE::Render
             EE_ASSERT( buffer.m_byteStride == 2 || buffer.m_byteStride == 4 ); // only 16/32 bit indices support
             break;
 
+            case RenderBuffer::Type::Structured:
+            bufferDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+            bufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+            EE_ASSERT( buffer.m_byteStride > 0 && ( buffer.m_byteSize % buffer.m_byteStride ) == 0 );
+            break;
+
             default:
             EE_HALT();
         }
@@ -551,6 +557,22 @@ namespace EE::Render
         // Create and store buffer
         m_pDevice->CreateBuffer( &bufferDesc, pInitializationData == nullptr ? nullptr : &initData, (ID3D11Buffer**) &buffer.m_resourceHandle.m_pData );
         EE_ASSERT( buffer.IsValid() );
+
+        // Structured buffers are only accessible to shaders via a view
+        if ( buffer.m_type == RenderBuffer::Type::Structured )
+        {
+            D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
+            Memory::MemsetZero( &srvDesc, sizeof( srvDesc ) );
+            srvDesc.Format = DXGI_FORMAT_UNKNOWN;
+            srvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+            srvDesc.Buffer.FirstElement = 0;
+            srvDesc.Buffer.NumElements = buffer.GetNumElements();
+
+            ID3D11ShaderResourceView* pBufferSRV = nullptr;
+            auto result = m_pDevice->CreateShaderResourceView( (ID3D11Buffer*) buffer.m_resourceHandle.m_pData, &srvDesc, &pBufferSRV );
+            EE_ASSERT( SUCCEEDED( result ) );
+            buffer.m_shaderResourceView.m_pData = pBufferSRV;
+        }
     }
 
     void RenderDevice::ResizeBuffer( RenderBuffer& buffer, uint32_t newSize )
@@ -558,6 +580,12 @@ namespace EE::Render
         EE_ASSERT( buffer.IsValid() && newSize % buffer.m_byteStride == 0 );
 
         // Release D3D buffer
+        if ( buffer.m_shaderResourceView.IsValid() )
+        {
+            ( (ID3D11ShaderResourceView*) buffer.m_shaderResourceView.m_pData )->Release();
+            buffer.m_shaderResourceView.Reset();
+        }
+
         ( (ID3D11Buffer*) buffer.m_resourceHandle.m_pData )->Release();
         buffer.m_resourceHandle.m_pData = nullptr;
         buffer.m_byteSize = newSize;
@@ -570,6 +598,12 @@ namespace EE::Render
 
         if ( buffer.IsValid() )
         {
+            if ( buffer.m_shaderResourceView.IsValid() )
+            {
+                ( (ID3D11ShaderResourceView*) buffer.m_shaderResourceView.m_pData )->Release();
+                buffer.m_shaderResourceView.Reset();
+            }
+
             ( (ID3D11Buffer*) buffer.m_resourceHandle.m_pData )->Release();
             buffer.m_resourceHandle.Reset();
             buffer = RenderBuffer();
@@ -23,6 +23,7 @@ namespace EE::Render
             Vertex,
             Index,
             Constant,
+            Structured, // Read-only structured buffer, accessed via its shader resource view
         };
 
         enum class Usage
@@ -42,6 +43,7 @@ namespace EE::Render
         inline bool IsValid() const { return m_resourceHandle.IsValid(); }
 
         BufferHandle const& GetResourceHandle() const { return m_resourceHandle; }
+        inline ViewSRVHandle const& GetShaderResourceView() const { EE_ASSERT( m_type == Type::Structured ); return m_shaderResourceView; }
         inline uint32_t GetNumElements() const { return m_byteSize / m_byteStride; }
 
     public:
@@ -56,6 +58,7 @@ namespace EE::Render
     protected:
 
         BufferHandle            m_resourceHandle;
+        ViewSRVHandle           m_shaderResourceView;
     };
 
     //-------------------------------------------------------------------------
@@ -255,6 +255,7 @@ namespace EE::Resource
     void ResourceSystem::Update( bool waitForAsyncTask )
     {
         EE_PROFILE_FUNCTION_RESOURCE();
+        EE_MEMORY_TAG_SCOPE( Resource );
         EE_ASSERT( Threading::IsMainThread() );
         EE_ASSERT( m_pResourceProvider != nullptr );
 
@@ -398,6 +399,7 @@ namespace EE::Resource
     void ResourceSystem::ProcessResourceRequests()
     {
         EE_PROFILE_FUNCTION_RESOURCE();
+        EE_MEMORY_TAG_SCOPE( Resource );
 
         //-------------------------------------------------------------------------
 
@@ -3,6 +3,7 @@
 #include "Base/TypeSystem/TypeInfo.h"
 #include "Base/TypeSystem/TypeInstance.h"
 #include "Base/TypeSystem/CoreTypeConversions.h"
+#include "Base/Encoding/Hash.h"
 
 //-------------------------------------------------------------------------
 
@@ -214,34 +215,35 @@ namespace EE::Serialization
 
             //-------------------------------------------------------------------------
 
-            for ( auto const& propInfo : pTypeInfo->m_properties )
+            // Walk the property nodes once and look up the property info for each via the type's property map
+            for ( xml_node propertyNode : typeNode.children() )
             {
-                // Try to find the property node
-                xml_node propertyNode = typeNode.find_child_by_attribute( g_propertyIDAttrName, propInfo.m_ID.c_str() );
-                if ( propertyNode.empty() )
+                xml_attribute propertyIDAttr = propertyNode.attribute( g_propertyIDAttrName );
+                if ( propertyIDAttr.empty() )
                 {
                     continue;
                 }
 
+                // Hash the ID directly rather than constructing a StringID from the string, to avoid locking the global string cache for each property
+                char const* pPropertyID = propertyIDAttr.as_string();
+                PropertyInfo const* pPropInfo = pTypeInfo->GetPropertyInfo( StringID( Hash::GetHash64( pPropertyID ) ) );
+                if ( pPropInfo == nullptr )
+                {
+                    continue;
+                }
+
+                PropertyInfo const& propInfo = *pPropInfo;
                 auto pPropertyDataAddress = propInfo.GetPropertyAddress( pTypeInstance );
 
                 if ( propInfo.IsArrayProperty() )
                 {
-                    // Get all array element nodes
+                    // Count the array element nodes, so that we can read straight into correctly sized storage
                     //-------------------------------------------------------------------------
 
-                    TInlineVector<xml_node, 10> arrayElementNodes;
+                    char const* const pElementNodeName = ( ( IsCoreType( propInfo.m_typeID ) || propInfo.IsEnumProperty() ) && !propInfo.IsTypeInstanceProperty() ) ? g_propertyNodeName : g_typeNodeName;
 
-                    if ( ( IsCoreType( propInfo.m_typeID ) || propInfo.IsEnumProperty() ) && !propInfo.IsTypeInstanceProperty() )
-                    {
-                        GetAllChildNodes( propertyNode, g_propertyNodeName, arrayElementNodes );
-                    }
-                    else
-                    {
-                        GetAllChildNodes( propertyNode, g_typeNodeName, arrayElementNodes );
-                    }
-
-                    int32_t const numElements = (int32_t) arrayElementNodes.size();
+                    auto const elementNodes = propertyNode.children( pElementNodeName );
+                    int32_t const numElements = (int32_t) std::distance( elementNodes.begin(), elementNodes.end() );
 
                     // Static array
                     if ( propInfo.IsStaticArrayProperty() )
@@ -253,13 +255,15 @@ namespace EE::Serialization
                         }
 
                         uint8_t* pArrayElementAddress = reinterpret_cast<uint8_t*>( pPropertyDataAddress );
-                        for ( int32_t i = 0; i < numElements; i++ )
+                        int32_t elementIdx = 0;
+                        for ( xml_node elementNode : elementNodes )
                         {
-                            if ( !ReadProperty( typeRegistry, arrayElementNodes[i], propInfo, pArrayElementAddress, i ) )
+                            if ( !ReadProperty( typeRegistry, elementNode, propInfo, pArrayElementAddress, elementIdx ) )
                             {
                                 return false;
                             }
                             pArrayElementAddress += propInfo.m_arrayElementSize;
+                            elementIdx++;
                         }
                     }
                     else // Dynamic array
@@ -271,14 +275,18 @@ namespace EE::Serialization
                             pTypeInfo->ClearArray( pTypeInstance, propInfo.m_ID.ToUint() );
                         }
 
-                        // Do the traversal backwards to only allocate once
-                        for ( int32_t i = ( numElements - 1 ); i >= 0; i-- )
+                        // Size the array up front so we only allocate once
+                        pTypeInfo->SetArraySize( pTypeInstance, propInfo.m_ID.ToUint(), numElements );
+
+                        int32_t elementIdx = 0;
+                        for ( xml_node elementNode : elementNodes )
                         {
-                            auto pArrayElementAddress = pTypeInfo->GetArrayElementDataPtr( pTypeInstance, propInfo.m_ID.ToUint(), i );
-                            if ( !ReadProperty( typeRegistry, arrayElementNodes[i], propInfo, pArrayElementAddress, i ) )
+                            auto pArrayElementAddress = pTypeInfo->GetArrayElementDataPtr( pTypeInstance, propInfo.m_ID.ToUint(), elementIdx );
+                            if ( !ReadProperty( typeRegistry, elementNode, propInfo, pArrayElementAddress, elementIdx ) )
                             {
                                 return false;
                             }
+                            elementIdx++;
                         }
                     }
                 }
@@ -15,93 +15,140 @@
 #include "Base/Math/NumericRange.h"
 
 #include "EnumInfo.h"
+#include <charconv>
 
 //-------------------------------------------------------------------------
 
 namespace EE::TypeSystem::Conversion
 {
-    void StringToFloatArray( String const& str, int32_t const numFloats, float* pFloats )
+    // Numeric Text Conversion
+    //-------------------------------------------------------------------------
+    // We use the charconv functions since they parse in place (no temporary strings), are locale independent and
+    // format floating point values using the shortest representation that round-trips exactly
+
+    template<typename T>
+    static T ParseNumber( char const* pStart, char const* pEnd )
     {
-        char substr[128] = { 0 };
-        int32_t resIdx = 0;
+        // 'from_chars' doesn't accept leading whitespace or an explicit '+' sign
+        while ( pStart < pEnd && isspace( (unsigned char) *pStart ) )
+        {
+            pStart++;
+        }
 
-        bool complete = false;
-        size_t startIdx = 0;
-        while ( resIdx < numFloats && !complete )
+        if constexpr ( std::is_floating_point_v<T> )
         {
-            size_t endIdx = str.find_first_of( ',', startIdx );
-            if ( endIdx == String::npos )
+            if ( pStart < pEnd && *pStart == '+' )
             {
-                endIdx = str.length();
-                complete = true;
+                pStart++;
             }
 
-            size_t sizeToCopy = endIdx - startIdx;
-            EE_ASSERT( sizeToCopy < 128 );
-            memcpy( substr, &str.c_str()[startIdx], sizeToCopy );
-            substr[sizeToCopy] = '\0';
+            T value = 0;
+            std::from_chars( pStart, pEnd, value );
+            return value;
+        }
+        else
+        {
+            bool isNegative = false;
+            if ( pStart < pEnd && ( *pStart == '-' || *pStart == '+' ) )
+            {
+                isNegative = ( *pStart == '-' );
+                pStart++;
+            }
+
+            // Support '0x' prefixed hex values
+            int32_t base = 10;
+            if ( ( pEnd - pStart ) > 2 && pStart[0] == '0' && ( pStart[1] == 'x' || pStart[1] == 'X' ) )
+            {
+                base = 16;
+                pStart += 2;
+            }
 
-            pFloats[resIdx++] = std::strtof( substr, nullptr );
-            startIdx = endIdx + 1;
+            uint64_t value = 0;
+            std::from_chars( pStart, pEnd, value, base );
+            return (T) ( isNegative ? ( 0 - value ) : value );
         }
     }
 
-    void FloatArrayToString( float const* pFloats, int32_t const numFloats, String& strValue )
+    template<typename T>
+    EE_FORCE_INLINE static T ParseNumber( String const& str )
     {
-        strValue.clear();
+        return ParseNumber<T>( str.c_str(), str.c_str() + str.length() );
+    }
 
-        for ( int32_t i = 0; i < numFloats; i++ )
-        {
-            strValue.append_sprintf( "%g", pFloats[i] );
+    template<typename T>
+    static void AppendNumber( T value, String& strValue )
+    {
+        char buffer[32];
+        std::to_chars_result const result = std::to_chars( buffer, buffer + sizeof( buffer ), value );
+        EE_ASSERT( result.ec == std::errc() );
+        strValue.append( buffer, result.ptr );
+    }
 
-            if ( i != ( numFloats - 1 ) )
-            {
-                strValue += ',';
-            }
-        }
+    template<typename T>
+    EE_FORCE_INLINE static void NumberToString( T value, String& strValue )
+    {
+        strValue.clear();
+        AppendNumber( value, strValue );
     }
 
-    void StringToIntArray( String const& str, int32_t const numInts, int32_t* pInts )
+    template<typename T>
+    static void StringToNumberArray( String const& str, int32_t const numValues, T* pValues )
     {
-        char substr[128] = { 0 };
-        int32_t resIdx = 0;
+        char const* pCurrent = str.c_str();
+        char const* const pEnd = pCurrent + str.length();
 
+        int32_t resIdx = 0;
         bool complete = false;
-        size_t startIdx = 0;
-        while ( resIdx < numInts && !complete )
+        while ( resIdx < numValues && !complete )
         {
-            size_t endIdx = str.find_first_of( ',', startIdx );
-            if ( endIdx == String::npos )
-            {
-                endIdx = str.length();
-                complete = true;
-            }
+            char const* pSeparator = eastl::find( pCurrent, pEnd, ',' );
+            complete = ( pSeparator == pEnd );
 
-            size_t sizeToCopy = endIdx - startIdx;
-            EE_ASSERT( sizeToCopy < 128 );
-            memcpy( substr, &str.c_str()[startIdx], sizeToCopy );
-            substr[sizeToCopy] = '\0';
-
-            pInts[resIdx++] = std::strtoul( substr, nullptr, 0 );
-            startIdx = endIdx + 1;
+            pValues[resIdx++] = ParseNumber<T>( pCurrent, pSeparator );
+            pCurrent = pSeparator + 1;
         }
     }
 
-    void IntArrayToString( int32_t const* pInts, int32_t const numInts, String& strValue )
+    template<typename T>
+    static void NumberArrayToString( T const* pValues, int32_t const numValues, String& strValue )
     {
         strValue.clear();
 
-        for ( int32_t i = 0; i < numInts; i++ )
+        for ( int32_t i = 0; i < numValues; i++ )
         {
-            strValue += eastl::to_string( pInts[i] );
+            AppendNumber( pValues[i], strValue );
 
-            if ( i != ( numInts - 1 ) )
+            if ( i != ( numValues - 1 ) )
             {
                 strValue += ',';
             }
         }
     }
 
+    //-------------------------------------------------------------------------
+
+    void StringToFloatArray( String const& str, int32_t const numFloats, float* pFloats )
+    {
+        StringToNumberArray( str, numFloats, pFloats );
+    }
+
+    void FloatArrayToString( float const* pFloats, int32_t const numFloats, String& strValue )
+    {
+        NumberArrayToString( pFloats, numFloats, strValue );
+    }
+
+    void StringToIntArray( String const& str, int32_t const numInts, int32_t* pInts )
+    {
+        StringToNumberArray( str, numInts, pInts );
+    }
+
+    void IntArrayToString( int32_t const* pInts, int32_t const numInts, String& strValue )
+    {
+        NumberArrayToString( pInts, numInts, strValue );
+    }
+
+    //-------------------------------------------------------------------------
+
     inline static bool ConvertStringToBitFlags( EnumInfo const& enumInfo, String const& str, BitFlags& outFlags )
     {
         outFlags.ClearAllFlags();
@@ -334,61 +381,61 @@ namespace EE::TypeSystem::Conversion
 
                 case CoreTypeID::Uint8 :
                 {
-                    *reinterpret_cast<uint8_t*>( pValue ) = (uint8_t) std::strtoul( str.c_str(), nullptr, 0 );
+                    *reinterpret_cast<uint8_t*>( pValue ) = ParseNumber<uint8_t>( str );
                 }
                 break;
 
                 case CoreTypeID::Int8 :
                 {
-                    *reinterpret_cast<int8_t*>( pValue ) = (int8_t) std::strtol( str.c_str(), nullptr, 0 );
+                    *reinterpret_cast<int8_t*>( pValue ) = ParseNumber<int8_t>( str );
                 }
                 break;
 
                 case CoreTypeID::Uint16 :
                 {
-                    *reinterpret_cast<uint16_t*>( pValue ) = (uint16_t) std::strtoul( str.c_str(), nullptr, 0 );
+                    *reinterpret_cast<uint16_t*>( pValue ) = ParseNumber<uint16_t>( str );
                 }
                 break;
 
                 case CoreTypeID::Int16 :
                 {
-                    *reinterpret_cast<int16_t*>( pValue ) = (int16_t) std::strtol( str.c_str(), nullptr, 0 );
+                    *reinterpret_cast<int16_t*>( pValue ) = ParseNumber<int16_t>( str );
                 }
                 break;
 
                 case CoreTypeID::Uint32 :
                 {
-                    *reinterpret_cast<uint32_t*>( pValue ) = std::strtoul( str.c_str(), nullptr, 0 );
+                    *reinterpret_cast<uint32_t*>( pValue ) = ParseNumber<uint32_t>( str );
                 }
                 break;
 
                 case CoreTypeID::Int32 :
                 {
-                    *reinterpret_cast<int32_t*>( pValue ) = std::strtol( str.c_str(), nullptr, 0 );
+                    *reinterpret_cast<int32_t*>( pValue ) = ParseNumber<int32_t>( str );
                 }
                 break;
 
                 case CoreTypeID::Uint64 :
                 {
-                    *reinterpret_cast<uint64_t*>( pValue ) = std::strtoull( str.c_str(), nullptr, 0 );
+                    *reinterpret_cast<uint64_t*>( pValue ) = ParseNumber<uint64_t>( str );
                 }
                 break;
 
                 case CoreTypeID::Int64:
                 {
-                    *reinterpret_cast<int64_t*>( pValue ) = std::strtol( str.c_str(), nullptr, 0 );
+                    *reinterpret_cast<int64_t*>( pValue ) = ParseNumber<int64_t>( str );
                 }
                 break;
 
                 case CoreTypeID::Float :
                 {
-                    *reinterpret_cast<float*>( pValue ) = std::strtof( str.c_str(), nullptr );
+                    *reinterpret_cast<float*>( pValue ) = ParseNumber<float>( str );
                 }
                 break;
 
                 case CoreTypeID::Double :
                 {
-                    *reinterpret_cast<double*>( pValue ) = std::strtod( str.c_str(), nullptr );
+                    *reinterpret_cast<double*>( pValue ) = ParseNumber<double>( str );
                 }
                 break;
 
@@ -501,37 +548,37 @@ namespace EE::TypeSystem::Conversion
 
                 case CoreTypeID::Microseconds:
                 {
-                    *reinterpret_cast<Microseconds*>( pValue ) = Microseconds( std::strtof( str.c_str(), nullptr ) );
+                    *reinterpret_cast<Microseconds*>( pValue ) = Microseconds( ParseNumber<float>( str ) );
                 }
                 break;
 
                 case CoreTypeID::Milliseconds:
                 {
-                    *reinterpret_cast<Milliseconds*>( pValue ) = Milliseconds( std::strtof( str.c_str(), nullptr ) );
+                    *reinterpret_cast<Milliseconds*>( pValue ) = Milliseconds( ParseNumber<float>( str ) );
                 }
                 break;
 
                 case CoreTypeID::Seconds:
                 {
-                    *reinterpret_cast<Seconds*>( pValue ) = Seconds( std::strtof( str.c_str(), nullptr ) );
+                    *reinterpret_cast<Seconds*>( pValue ) = Seconds( ParseNumber<float>( str ) );
                 }
                 break;
 
                 case CoreTypeID::Percentage:
                 {
-                    *reinterpret_cast<Percentage*>( pValue ) = Percentage( std::strtof( str.c_str(), nullptr ) );
+                    *reinterpret_cast<Percentage*>( pValue ) = Percentage( ParseNumber<float>( str ) );
                 }
                 break;
 
                 case CoreTypeID::Degrees:
                 {
-                    *reinterpret_cast<Degrees*>( pValue ) = Degrees( std::strtof( str.c_str(), nullptr ) );
+                    *reinterpret_cast<Degrees*>( pValue ) = Degrees( ParseNumber<float>( str ) );
                 }
                 break;
 
                 case CoreTypeID::Radians:
                 {
-                    *reinterpret_cast<Radians*>( pValue ) = Radians( std::strtof( str.c_str(), nullptr ) );
+                    *reinterpret_cast<Radians*>( pValue ) = Radians( ParseNumber<float>( str ) );
                 }
                 break;
 
@@ -639,7 +686,7 @@ namespace EE::TypeSystem::Conversion
 
                 case CoreTypeID::BitFlags:
                 {
-                    reinterpret_cast<BitFlags*>( pValue )->Set( std::strtol( str.c_str(), nullptr, 0 ) );
+                    reinterpret_cast<BitFlags*>( pValue )->Set( ParseNumber<uint32_t>( str ) );
                 }
                 break;
 
@@ -762,61 +809,61 @@ namespace EE::TypeSystem::Conversion
 
                 case CoreTypeID::Uint8:
                 {
-                    strValue = eastl::to_string( *reinterpret_cast<uint8_t const*>( pValue ) );
+                    NumberToString( *reinterpret_cast<uint8_t const*>( pValue ), strValue );
                 }
                 break;
 
                 case CoreTypeID::Int8:
                 {
-                    strValue = eastl::to_string( *reinterpret_cast<int8_t const*>( pValue ) );
+                    NumberToString( *reinterpret_cast<int8_t const*>( pValue ), strValue );
                 }
                 break;
 
                 case CoreTypeID::Uint16:
                 {
-                    strValue = eastl::to_string( *reinterpret_cast<uint16_t const*>( pValue ) );
+                    NumberToString( *reinterpret_cast<uint16_t const*>( pValue ), strValue );
                 }
                 break;
 
                 case CoreTypeID::Int16:
                 {
-                    strValue = eastl::to_string( *reinterpret_cast<int16_t const*>( pValue ) );
+                    NumberToString( *reinterpret_cast<int16_t const*>( pValue ), strValue );
                 }
                 break;
 
                 case CoreTypeID::Uint32:
                 {
-                    strValue = eastl::to_string( *reinterpret_cast<uint32_t const*>( pValue ) );
+                    NumberToString( *reinterpret_cast<uint32_t const*>( pValue ), strValue );
                 }
                 break;
 
                 case CoreTypeID::Int32:
                 {
-                    strValue = eastl::to_string( *reinterpret_cast<int32_t const*>( pValue ) );
+                    NumberToString( *reinterpret_cast<int32_t const*>( pValue ), strValue );
                 }
                 break;
 
                 case CoreTypeID::Uint64:
                 {
-                    strValue = eastl::to_string( *reinterpret_cast<uint64_t const*>( pValue ) );
+                    NumberToString( *reinterpret_cast<uint64_t const*>( pValue ), strValue );
                 }
                 break;
 
                 case CoreTypeID::Int64:
                 {
-                    strValue = eastl::to_string( *reinterpret_cast<int64_t const*>( pValue ) );
+                    NumberToString( *reinterpret_cast<int64_t const*>( pValue ), strValue );
                 }
                 break;
 
                 case CoreTypeID::Float:
                 {
-                    strValue.sprintf( "%g", *reinterpret_cast<float const*>( pValue ) );
+                    NumberToString( *reinterpret_cast<float const*>( pValue ), strValue );
                 }
                 break;
 
                 case CoreTypeID::Double:
                 {
-                    strValue.sprintf( "%g", *reinterpret_cast<double const*>( pValue ) );
+                    NumberToString( *reinterpret_cast<double const*>( pValue ), strValue );
                 }
                 break;
 
@@ -967,37 +1014,37 @@ namespace EE::TypeSystem::Conversion
 
                 case CoreTypeID::Microseconds:
                 {
-                    strValue = eastl::to_string( reinterpret_cast<Microseconds const*>( pValue )->ToFloat() );
+                    NumberToString( reinterpret_cast<Microseconds const*>( pValue )->ToFloat(), strValue );
                 }
                 break;
 
                 case CoreTypeID::Milliseconds:
                 {
-                    strValue = eastl::to_string( reinterpret_cast<Milliseconds const*>( pValue )->ToFloat() );
+                    NumberToString( reinterpret_cast<Milliseconds const*>( pValue )->ToFloat(), strValue );
                 }
                 break;
 
                 case CoreTypeID::Seconds:
                 {
-                    strValue = eastl::to_string( reinterpret_cast<Seconds const*>( pValue )->ToFloat() );
+                    NumberToString( reinterpret_cast<Seconds const*>( pValue )->ToFloat(), strValue );
                 }
                 break;
 
                 case CoreTypeID::Percentage:
                 {
-                    strValue = eastl::to_string( reinterpret_cast<Percentage const*>( pValue )->ToFloat() );
+                    NumberToString( reinterpret_cast<Percentage const*>( pValue )->ToFloat(), strValue );
                 }
                 break;
 
                 case CoreTypeID::Degrees:
                 {
-                    strValue = eastl::to_string( reinterpret_cast<Degrees const*>( pValue )->ToFloat() );
+                    NumberToString( reinterpret_cast<Degrees const*>( pValue )->ToFloat(), strValue );
                 }
                 break;
 
                 case CoreTypeID::Radians:
                 {
-                    strValue = eastl::to_string( reinterpret_cast<Radians const*>( pValue )->ToFloat() );
+                    NumberToString( reinterpret_cast<Radians const*>( pValue )->ToFloat(), strValue );
                 }
                 break;
 
@@ -1050,7 +1097,7 @@ namespace EE::TypeSystem::Conversion
 
                 case CoreTypeID::BitFlags:
                 {
-                    strValue = eastl::to_string( reinterpret_cast<BitFlags const*>( pValue )->Get() );
+                    NumberToString( reinterpret_cast<BitFlags const*>( pValue )->Get(), strValue );
                 }
                 break;
 
@@ -132,6 +132,9 @@ namespace EE::TypeSystem
         inline PropertyDescriptor const* GetProperty( PropertyPath const& path ) const { return const_cast<TypeDescriptor*>( this )->GetProperty( path ); }
         void RemovePropertyValue( PropertyPath const& path );
 
+        // Set the described property values on an existing instance of the described type, any properties not in this descriptor are left untouched
+        inline void ApplyPropertyValues( TypeRegistry const& typeRegistry, IReflectedType* pTypeInstance ) const { RestorePropertyState( typeRegistry, pTypeInstance->GetTypeInfo(), pTypeInstance ); }
+
     private:
 
         void* RestorePropertyState( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, IReflectedType* pTypeInstance ) const;
@@ -0,0 +1,384 @@
+#include "AICrowd.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::AI
+{
+    static float CalculateTimeToCollision( Float2 const& relativePosition, Float2 const& relativeVelocity, float combinedRadius )
+    {
+        float const a = relativeVelocity.m_x * relativeVelocity.m_x + relativeVelocity.m_y * relativeVelocity.m_y;
+        float const b = relativePosition.m_x * relativeVelocity.m_x + relativePosition.m_y * relativeVelocity.m_y;
+        float const c = relativePosition.m_x * relativePosition.m_x + relativePosition.m_y * relativePosition.m_y - combinedRadius * combinedRadius;
+
+        // Already overlapping, we only care whether we are moving further into each other
+        if ( c < 0.0f )
+        {
+            return ( b > 0.0f ) ? 0.0f : FLT_MAX;
+        }
+
+        // Moving apart or not moving relative to each other
+        if ( b <= 0.0f || a <= 0.0f )
+        {
+            return FLT_MAX;
+        }
+
+        float const discriminant = b * b - a * c;
+        if ( discriminant <= 0.0f )
+        {
+            return FLT_MAX;
+        }
+
+        return ( b - Math::Sqrt( discriminant ) ) / a;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CrowdSimulation::CrowdSimulation()
+    {
+        // Offset every other ring by half a step to get a better coverage of the velocity space
+        for ( int32_t ringIdx = 0; ringIdx < s_numVelocitySampleRings; ringIdx++ )
+        {
+            float const ringScale = float( ringIdx + 1 ) / s_numVelocitySampleRings;
+            float const angleOffset = ( ringIdx % 2 ) * 0.5f;
+            for ( int32_t dirIdx = 0; dirIdx < s_numVelocitySampleDirections; dirIdx++ )
+            {
+                float const angle = Math::TwoPi * ( float( dirIdx ) + angleOffset ) / s_numVelocitySampleDirections;
+                m_sampleDirections[ringIdx][dirIdx] = Float2( Math::Cos( angle ), Math::Sin( angle ) ) * ringScale;
+            }
+        }
+    }
+
+    CrowdSimulation::AgentHandle CrowdSimulation::AddAgent( float radius, Float2 const& position, Float2 const& velocity )
+    {
+        EE_ASSERT( radius > 0.0f );
+
+        AgentHandle handle = s_invalidAgentHandle;
+        if ( m_freeSlots.empty() )
+        {
+            handle = (AgentHandle) m_slotToAgentIndex.size();
+            m_slotToAgentIndex.emplace_back( InvalidIndex );
+        }
+        else
+        {
+            handle = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_slotToAgentIndex[handle] = (int32_t) m_agentSlots.size();
+        m_agentSlots.emplace_back( handle );
+        m_positions.emplace_back( position );
+        m_desiredVelocities.emplace_back( velocity );
+        m_velocities.emplace_back( velocity );
+        m_newVelocities.emplace_back( velocity );
+        m_radii.emplace_back( radius );
+        m_isStateSet.emplace_back( false );
+
+        return handle;
+    }
+
+    void CrowdSimulation::RemoveAgent( AgentHandle handle )
+    {
+        int32_t const agentIdx = GetAgentIndex( handle );
+        int32_t const lastAgentIdx = (int32_t) m_agentSlots.size() - 1;
+
+        // Move the last agent into the freed index to keep the agent data packed
+        if ( agentIdx != lastAgentIdx )
+        {
+            m_positions[agentIdx] = m_positions[lastAgentIdx];
+            m_desiredVelocities[agentIdx] = m_desiredVelocities[lastAgentIdx];
+            m_velocities[agentIdx] = m_velocities[lastAgentIdx];
+            m_newVelocities[agentIdx] = m_newVelocities[lastAgentIdx];
+            m_radii[agentIdx] = m_radii[lastAgentIdx];
+            m_isStateSet[agentIdx] = m_isStateSet[lastAgentIdx];
+            m_agentSlots[agentIdx] = m_agentSlots[lastAgentIdx];
+            m_slotToAgentIndex[m_agentSlots[agentIdx]] = agentIdx;
+        }
+
+        m_positions.pop_back();
+        m_desiredVelocities.pop_back();
+        m_velocities.pop_back();
+        m_newVelocities.pop_back();
+        m_radii.pop_back();
+        m_isStateSet.pop_back();
+        m_agentSlots.pop_back();
+
+        m_slotToAgentIndex[handle] = InvalidIndex;
+        m_freeSlots.emplace_back( handle );
+    }
+
+    //-------------------------------------------------------------------------
+
+    uint32_t CrowdSimulation::GetCellHash( int32_t cellX, int32_t cellY ) const
+    {
+        uint32_t const hash = ( uint32_t( cellX ) * 73856093u ) ^ ( uint32_t( cellY ) * 19349663u );
+        return hash & m_cellHashMask;
+    }
+
+    void CrowdSimulation::BuildSpatialHash()
+    {
+        EE_PROFILE_FUNCTION_AI();
+
+        int32_t const numAgents = GetNumAgents();
+
+        // Use a power of two table with roughly two buckets per agent to keep collisions low
+        uint32_t numBuckets = 1;
+        while ( numBuckets < uint32_t( numAgents * 2 ) )
+        {
+            numBuckets <<= 1;
+        }
+        m_cellHashMask = numBuckets - 1;
+
+        // Counting sort of the agents by bucket, agents stay in index order within a bucket so the result is deterministic
+        // Agents without a state for this frame have stale (or initial) positions, so they are left out of the hash
+        //-------------------------------------------------------------------------
+
+        m_agentCellHashes.resize( numAgents );
+        m_cellStartIndices.clear();
+        m_cellStartIndices.resize( numBuckets + 1, 0 );
+
+        int32_t numHashedAgents = 0;
+        float const invCellSize = 1.0f / s_neighbourSearchRadius;
+        for ( int32_t i = 0; i < numAgents; i++ )
+        {
+            if ( !m_isStateSet[i] )
+            {
+                continue;
+            }
+
+            int32_t const cellX = (int32_t) Math::Floor( m_positions[i].m_x * invCellSize );
+            int32_t const cellY = (int32_t) Math::Floor( m_positions[i].m_y * invCellSize );
+            m_agentCellHashes[i] = GetCellHash( cellX, cellY );
+            m_cellStartIndices[m_agentCellHashes[i]]++;
+            numHashedAgents++;
+        }
+
+        // Calculate the end of each bucket, these become the bucket starts as we fill the buckets back to front
+        for ( uint32_t i = 1; i < numBuckets; i++ )
+        {
+            m_cellStartIndices[i] += m_cellStartIndices[i - 1];
+        }
+        m_cellStartIndices[numBuckets] = numHashedAgents;
+
+        m_sortedAgentIndices.resize( numHashedAgents );
+        for ( int32_t i = numAgents - 1; i >= 0; i-- )
+        {
+            if ( !m_isStateSet[i] )
+            {
+                continue;
+            }
+
+            m_sortedAgentIndices[--m_cellStartIndices[m_agentCellHashes[i]]] = i;
+        }
+    }
+
+    int32_t CrowdSimulation::FindNeighbours( int32_t agentIdx, int32_t* pNeighbours ) const
+    {
+        Float2 const& position = m_positions[agentIdx];
+        float const invCellSize = 1.0f / s_neighbourSearchRadius;
+        int32_t const cellX = (int32_t) Math::Floor( position.m_x * invCellSize );
+        int32_t const cellY = (int32_t) Math::Floor( position.m_y * invCellSize );
+
+        // Since the cell size is the search radius, we only need to check the surrounding cells
+        // Different cells can hash to the same bucket so we need to ensure that each bucket is only visited once
+        uint32_t visitedBuckets[9];
+        int32_t numVisitedBuckets = 0;
+
+        float neighbourDistancesSq[s_maxNeighbours];
+        int32_t numNeighbours = 0;
+        float const searchRadiusSq = s_neighbourSearchRadius * s_neighbourSearchRadius;
+
+        for ( int32_t y = cellY - 1; y <= cellY + 1; y++ )
+        {
+            for ( int32_t x = cellX - 1; x <= cellX + 1; x++ )
+            {
+                uint32_t const bucketIdx = GetCellHash( x, y );
+
+                bool wasVisited = false;
+                for ( int32_t i = 0; i < numVisitedBuckets; i++ )
+                {
+                    if ( visitedBuckets[i] == bucketIdx )
+                    {
+                        wasVisited = true;
+                        break;
+                    }
+                }
+
+                if ( wasVisited )
+                {
+                    continue;
+                }
+
+                visitedBuckets[numVisitedBuckets++] = bucketIdx;
+
+                //-------------------------------------------------------------------------
+
+                for ( int32_t i = m_cellStartIndices[bucketIdx]; i < m_cellStartIndices[bucketIdx + 1]; i++ )
+                {
+                    int32_t const otherAgentIdx = m_sortedAgentIndices[i];
+                    if ( otherAgentIdx == agentIdx )
+                    {
+                        continue;
+                    }
+
+                    Float2 const delta = m_positions[otherAgentIdx] - position;
+                    float const distanceSq = delta.m_x * delta.m_x + delta.m_y * delta.m_y;
+                    if ( distanceSq > searchRadiusSq )
+                    {
+                        continue;
+                    }
+
+                    // Insertion sort into the closest neighbour list, dropping the furthest neighbour when full
+                    if ( numNeighbours == s_maxNeighbours && distanceSq >= neighbourDistancesSq[s_maxNeighbours - 1] )
+                    {
+                        continue;
+                    }
+
+                    int32_t insertIdx = Math::Min( numNeighbours, s_maxNeighbours - 1 );
+                    while ( insertIdx > 0 && neighbourDistancesSq[insertIdx - 1] > distanceSq )
+                    {
+                        neighbourDistancesSq[insertIdx] = neighbourDistancesSq[insertIdx - 1];
+                        pNeighbours[insertIdx] = pNeighbours[insertIdx - 1];
+                        insertIdx--;
+                    }
+
+                    neighbourDistancesSq[insertIdx] = distanceSq;
+                    pNeighbours[insertIdx] = otherAgentIdx;
+                    numNeighbours = Math::Min( numNeighbours + 1, s_maxNeighbours );
+                }
+            }
+        }
+
+        return numNeighbours;
+    }
+
+    void CrowdSimulation::CalculateAgentVelocity( int32_t agentIdx )
+    {
+        // Agents that were not updated keep their current velocity
+        if ( !m_isStateSet[agentIdx] )
+        {
+            m_newVelocities[agentIdx] = m_velocities[agentIdx];
+            return;
+        }
+
+        Float2 const& desiredVelocity = m_desiredVelocities[agentIdx];
+
+        int32_t neighbours[s_maxNeighbours];
+        int32_t const numNeighbours = FindNeighbours( agentIdx, neighbours );
+        if ( numNeighbours == 0 )
+        {
+            m_newVelocities[agentIdx] = desiredVelocity;
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        Float2 const& position = m_positions[agentIdx];
+        Float2 const& currentVelocity = m_velocities[agentIdx];
+        float const radius = m_radii[agentIdx];
+
+        auto EvaluateCandidate = [&] ( Float2 const& candidateVelocity )
+        {
+            // Reciprocal velocity obstacle: each agent takes half the responsibility for avoiding the collision
+            float minTimeToCollision = FLT_MAX;
+            for ( int32_t i = 0; i < numNeighbours; i++ )
+            {
+                int32_t const neighbourIdx = neighbours[i];
+                Float2 const relativePosition = m_positions[neighbourIdx] - position;
+                Float2 const relativeVelocity = candidateVelocity * 2.0f - currentVelocity - m_velocities[neighbourIdx];
+                float const timeToCollision = CalculateTimeToCollision( relativePosition, relativeVelocity, radius + m_radii[neighbourIdx] );
+                minTimeToCollision = Math::Min( minTimeToCollision, timeToCollision );
+            }
+
+            Float2 const deviation = candidateVelocity - desiredVelocity;
+            float penalty = Math::Sqrt( deviation.m_x * deviation.m_x + deviation.m_y * deviation.m_y );
+            if ( minTimeToCollision < s_timeHorizon )
+            {
+                penalty += s_timeToCollisionWeight / Math::Max( minTimeToCollision, Math::Epsilon );
+            }
+
+            return penalty;
+        };
+
+        // Evaluate the desired velocity, standing still and a set of velocities around the agent
+        //-------------------------------------------------------------------------
+
+        Float2 bestVelocity = desiredVelocity;
+        float bestPenalty = EvaluateCandidate( desiredVelocity );
+
+        auto TryCandidate = [&] ( Float2 const& candidateVelocity )
+        {
+            float const penalty = EvaluateCandidate( candidateVelocity );
+            if ( penalty < bestPenalty )
+            {
+                bestPenalty = penalty;
+                bestVelocity = candidateVelocity;
+            }
+        };
+
+        TryCandidate( Float2::Zero );
+
+        float const desiredSpeed = Math::Sqrt( desiredVelocity.m_x * desiredVelocity.m_x + desiredVelocity.m_y * desiredVelocity.m_y );
+        float const maxSpeed = Math::Max( desiredSpeed, s_minAvoidanceSpeed );
+        for ( int32_t ringIdx = 0; ringIdx < s_numVelocitySampleRings; ringIdx++ )
+        {
+            for ( int32_t dirIdx = 0; dirIdx < s_numVelocitySampleDirections; dirIdx++ )
+            {
+                TryCandidate( m_sampleDirections[ringIdx][dirIdx] * maxSpeed );
+            }
+        }
+
+        m_newVelocities[agentIdx] = bestVelocity;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CrowdSimulation::Update( TaskSystem* pTaskSystem )
+    {
+        EE_PROFILE_FUNCTION_AI();
+
+        int32_t const numAgents = GetNumAgents();
+        if ( numAgents == 0 )
+        {
+            return;
+        }
+
+        BuildSpatialHash();
+
+        // Each agent only writes its own new velocity and only reads the previous velocities, so the order of evaluation doesnt matter
+        //-------------------------------------------------------------------------
+
+        if ( pTaskSystem != nullptr && numAgents > s_minAgentsPerTask )
+        {
+            AsyncTask avoidanceTask( (uint32_t) numAgents, [this] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    CalculateAgentVelocity( (int32_t) i );
+                }
+            } );
+            avoidanceTask.m_MinRange = s_minAgentsPerTask;
+
+            pTaskSystem->ScheduleTask( &avoidanceTask );
+            pTaskSystem->WaitForTask( &avoidanceTask );
+        }
+        else
+        {
+            for ( int32_t i = 0; i < numAgents; i++ )
+            {
+                CalculateAgentVelocity( i );
+            }
+        }
+
+        m_velocities.swap( m_newVelocities );
+
+        // Agents need to set their state again before the next update
+        for ( int32_t i = 0; i < numAgents; i++ )
+        {
+            m_isStateSet[i] = false;
+        }
+    }
+}
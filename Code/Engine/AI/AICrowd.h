@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Math/Math.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    class TaskSystem;
+}
+
+//-------------------------------------------------------------------------
+// Crowd local avoidance
+//-------------------------------------------------------------------------
+// Calculates collision free velocities for a set of agents moving on the XY plane using sampled reciprocal velocity obstacles (RVO)
+//
+// Agent data is stored as separate arrays (SoA) and neighbours are found via a uniform spatial hash that is rebuilt every update.
+// Only agents whose state was set since the last update are added to the spatial hash, so agents that were not updated dont act as obstacles.
+// Each agent picks the candidate velocity that best trades off the deviation from its desired velocity against the time to the
+// first collision with its neighbours. The results only depend on the agent data and not on the number of worker threads.
+
+namespace EE::AI
+{
+    class EE_ENGINE_API CrowdSimulation
+    {
+    public:
+
+        using AgentHandle = int32_t;
+        constexpr static AgentHandle const s_invalidAgentHandle = -1;
+
+        constexpr static float const s_neighbourSearchRadius = 4.0f;        // How far away (in meters) do we look for neighbours, also the spatial hash cell size
+        constexpr static int32_t const s_maxNeighbours = 10;                // Only the closest neighbours are considered
+        constexpr static float const s_timeHorizon = 2.0f;                  // Collisions further away in time than this are ignored
+        constexpr static float const s_timeToCollisionWeight = 1.5f;        // How much do we prefer avoiding collisions to following the desired velocity
+        constexpr static float const s_minAvoidanceSpeed = 1.0f;            // Lets stationary agents step out of the way of other agents
+        constexpr static int32_t const s_numVelocitySampleRings = 3;
+        constexpr static int32_t const s_numVelocitySampleDirections = 12;
+        constexpr static int32_t const s_minAgentsPerTask = 64;
+
+    public:
+
+        CrowdSimulation();
+
+        inline int32_t GetNumAgents() const { return (int32_t) m_agentSlots.size(); }
+
+        // Agents
+        //-------------------------------------------------------------------------
+
+        // Add an agent at the supplied position, the velocity is used as the agent's initial velocity
+        // The agent will only be considered by other agents once its state has been set
+        AgentHandle AddAgent( float radius, Float2 const& position, Float2 const& velocity );
+        void RemoveAgent( AgentHandle handle );
+
+        // Set the agent's current position and the velocity it would like to move at, this needs to be done every frame for the agent to participate in the avoidance
+        // This is threadsafe as long as each thread only updates its own agents and no agents are added/removed concurrently
+        inline void SetAgentState( AgentHandle handle, Float2 const& position, Float2 const& desiredVelocity )
+        {
+            int32_t const agentIdx = GetAgentIndex( handle );
+            m_positions[agentIdx] = position;
+            m_desiredVelocities[agentIdx] = desiredVelocity;
+            m_isStateSet[agentIdx] = true;
+        }
+
+        // Get the desired velocity that was used for the last avoidance update
+        inline Float2 const& GetAgentDesiredVelocity( AgentHandle handle ) const { return m_desiredVelocities[GetAgentIndex( handle )]; }
+
+        // Get the collision free velocity calculated by the last avoidance update
+        inline Float2 const& GetAgentVelocity( AgentHandle handle ) const { return m_velocities[GetAgentIndex( handle )]; }
+
+        // Update
+        //-------------------------------------------------------------------------
+
+        // Calculate new velocities for all agents, if a task system is supplied the agents will be split across the worker threads
+        void Update( TaskSystem* pTaskSystem = nullptr );
+
+    private:
+
+        inline int32_t GetAgentIndex( AgentHandle handle ) const
+        {
+            EE_ASSERT( handle >= 0 && handle < (int32_t) m_slotToAgentIndex.size() && m_slotToAgentIndex[handle] != InvalidIndex );
+            return m_slotToAgentIndex[handle];
+        }
+
+        void BuildSpatialHash();
+        uint32_t GetCellHash( int32_t cellX, int32_t cellY ) const;
+        int32_t FindNeighbours( int32_t agentIdx, int32_t* pNeighbours ) const;
+        void CalculateAgentVelocity( int32_t agentIdx );
+
+    private:
+
+        // Agent data (SoA)
+        TVector<Float2>                         m_positions;
+        TVector<Float2>                         m_desiredVelocities;
+        TVector<Float2>                         m_velocities;
+        TVector<Float2>                         m_newVelocities;
+        TVector<float>                          m_radii;
+        TVector<uint8_t>                        m_isStateSet;               // Has the agent's state been set since the last update, not a bool vector since agents are set from multiple threads
+        TVector<AgentHandle>                    m_agentSlots;               // The handle for each agent
+
+        // Stable handles
+        TVector<int32_t>                        m_slotToAgentIndex;
+        TVector<AgentHandle>                    m_freeSlots;
+
+        // Spatial hash
+        TVector<uint32_t>                       m_agentCellHashes;
+        TVector<int32_t>                        m_cellStartIndices;         // The start of each hash bucket in the sorted agent list, has an extra element for the end
+        TVector<int32_t>                        m_sortedAgentIndices;       // Only contains the agents that had their state set
+        uint32_t                                m_cellHashMask = 0;
+
+        // Candidate velocity directions
+        Float2                                  m_sampleDirections[s_numVelocitySampleRings][s_numVelocitySampleDirections];
+    };
+}
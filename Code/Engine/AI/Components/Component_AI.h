@@ -13,9 +13,45 @@ namespace EE::AI
     {
         EE_SINGLETON_ENTITY_COMPONENT( AIComponent );
 
+        friend class AIManager;
+
+    public:
+
+        // How important is this AI to the player, this determines how often it is allowed to reselect its behavior
+        enum class Significance : uint8_t
+        {
+            High = 0,
+            Medium,
+            Low,
+
+            NumLevels
+        };
+
     public:
 
         inline AIComponent() = default;
         inline AIComponent( StringID name ) : EntityComponent( name ) {}
+
+        // Time-slicing
+        //-------------------------------------------------------------------------
+
+        // Has the AI manager given this AI budget to reselect its behavior this frame
+        inline bool CanReselectBehavior() const { return m_canReselectBehavior; }
+
+        inline Significance GetSignificance() const { return m_significance; }
+
+        // Set by the AI's controller during its update, the AI manager uses this to schedule the next behavior reselection
+        inline void SetSignificance( Significance significance ) { EE_ASSERT( significance < Significance::NumLevels ); m_significance = significance; }
+
+        // Combat AIs are always considered highly significant
+        inline bool IsInCombat() const { return m_isInCombat; }
+        inline void SetInCombat( bool isInCombat ) { m_isInCombat = isInCombat; }
+
+    private:
+
+        Significance                m_significance = Significance::High;
+        uint32_t                    m_framesSinceBehaviorReselection = 0;
+        bool                        m_canReselectBehavior = true;
+        bool                        m_isInCombat = false;
     };
 }
\ No newline at end of file
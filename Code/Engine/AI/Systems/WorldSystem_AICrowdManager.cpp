@@ -0,0 +1,99 @@
+#include "WorldSystem_AICrowdManager.h"
+#include "Engine/AI/Components/Component_AI.h"
+#include "Engine/Physics/Components/Component_PhysicsCharacter.h"
+#include "Engine/Entity/Entity.h"
+#include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::AI
+{
+    void CrowdManager::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
+    }
+
+    void CrowdManager::ShutdownSystem()
+    {
+        EE_ASSERT( m_agentHandles.empty() );
+        m_pTaskSystem = nullptr;
+    }
+
+    void CrowdManager::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        // Only AI characters participate in the crowd avoidance
+        auto pCharacterComponent = TryCast<Physics::CharacterComponent>( pComponent );
+        if ( pCharacterComponent == nullptr )
+        {
+            return;
+        }
+
+        bool isAI = false;
+        for ( EntityComponent const* pEntityComponent : pEntity->GetComponents() )
+        {
+            if ( IsOfType<AIComponent>( pEntityComponent ) )
+            {
+                isAI = true;
+                break;
+            }
+        }
+
+        if ( isAI )
+        {
+            EE_ASSERT( m_agentHandles.find( pEntity->GetID() ) == m_agentHandles.end() );
+            Vector const position = pCharacterComponent->GetWorldTransform().GetTranslation();
+            Vector const& velocity = pCharacterComponent->GetCharacterVelocity();
+            m_agentHandles[pEntity->GetID()] = m_crowd.AddAgent( pCharacterComponent->GetCapsuleRadius(), Float2( position.GetX(), position.GetY() ), Float2( velocity.GetX(), velocity.GetY() ) );
+        }
+    }
+
+    void CrowdManager::UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        if ( !IsOfType<Physics::CharacterComponent>( pComponent ) )
+        {
+            return;
+        }
+
+        auto foundIter = m_agentHandles.find( pEntity->GetID() );
+        if ( foundIter != m_agentHandles.end() )
+        {
+            m_crowd.RemoveAgent( foundIter->second );
+            m_agentHandles.erase( foundIter );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    Vector CrowdManager::CalculateAgentVelocity( EntityID const& entityID, Vector const& position, Vector const& desiredVelocity )
+    {
+        auto foundIter = m_agentHandles.find( entityID );
+        if ( foundIter == m_agentHandles.end() )
+        {
+            return desiredVelocity;
+        }
+
+        CrowdSimulation::AgentHandle const agentHandle = foundIter->second;
+
+        // The last avoidance result was calculated for last frame's desired velocity, so we apply the correction it made to the new desired velocity
+        Float2 const desiredVelocity2D( desiredVelocity.GetX(), desiredVelocity.GetY() );
+        Float2 const correction = m_crowd.GetAgentVelocity( agentHandle ) - m_crowd.GetAgentDesiredVelocity( agentHandle );
+        m_crowd.SetAgentState( agentHandle, Float2( position.GetX(), position.GetY() ), desiredVelocity2D );
+
+        Float2 const avoidanceVelocity = desiredVelocity2D + correction;
+        return Vector( avoidanceVelocity.m_x, avoidanceVelocity.m_y, desiredVelocity.GetZ(), 0.0f );
+    }
+
+    bool CrowdManager::GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const
+    {
+        // The crowd simulation only uses the agent state set by the AI entity systems
+        return true;
+    }
+
+    void CrowdManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_FUNCTION_AI();
+        m_crowd.Update( m_pTaskSystem );
+    }
+}
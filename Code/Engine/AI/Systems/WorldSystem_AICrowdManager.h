@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Engine/AI/AICrowd.h"
+#include "Engine/Entity/EntityWorldSystem.h"
+#include "Base/Math/Vector.h"
+#include "Base/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+// AI Crowd Manager
+//-------------------------------------------------------------------------
+// Calculates avoidance velocities for all AI characters in the world
+//
+// AI controllers submit their desired velocity during their pre-physics update and get back a velocity that steers around the
+// other agents. The crowd update runs once all entities have been updated, so the avoidance result is always one frame old.
+
+namespace EE
+{
+    class TaskSystem;
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::AI
+{
+    class EE_ENGINE_API CrowdManager : public EntityWorldSystem
+    {
+    public:
+
+        EE_ENTITY_WORLD_SYSTEM( CrowdManager, RequiresUpdate( UpdateStage::PrePhysics ) );
+
+    public:
+
+        // Submit the desired velocity for an agent and get back the avoidance velocity, non-agents will just get back the desired velocity
+        // This is threadsafe as long as each entity only ever updates itself
+        Vector CalculateAgentVelocity( EntityID const& entityID, Vector const& position, Vector const& desiredVelocity );
+
+    private:
+
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
+        virtual void ShutdownSystem() override final;
+        virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual bool GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const override;
+
+    private:
+
+        TaskSystem*                                                 m_pTaskSystem = nullptr;
+        CrowdSimulation                                             m_crowd;
+        THashMap<EntityID, CrowdSimulation::AgentHandle>            m_agentHandles;
+    };
+}
@@ -6,6 +6,8 @@
 #include "Engine/Entity/EntityMap.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Threading/TaskSystem.h"
+#include "Base/Profiling.h"
+#include "EASTL/sort.h"
 
 //-------------------------------------------------------------------------
 
@@ -44,12 +46,79 @@ namespace EE::AI
 
     //-------------------------------------------------------------------------
 
+    bool AIManager::GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const
+    {
+        outAccess.ReadsComponent<AISpawnComponent>();
+        outAccess.WritesComponent<AIComponent>();
+        outAccess.WritesResource( WorldSystemDataAccess::s_persistentMapResourceID );
+        return true;
+    }
+
     void AIManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( ctx.IsGameWorld() && !m_hasSpawnedAI )
         {
             m_hasSpawnedAI = TrySpawnAI( ctx );
         }
+
+        ScheduleBehaviorReselection();
+    }
+
+    void AIManager::ScheduleBehaviorReselection()
+    {
+        EE_PROFILE_FUNCTION_AI();
+
+        // Gather all AIs that are due to reselect their behavior
+        //-------------------------------------------------------------------------
+
+        m_reselectionCandidates.clear();
+
+        int32_t const numAIs = (int32_t) m_AIs.size();
+        for ( int32_t i = 0; i < numAIs; i++ )
+        {
+            AIComponent* pAIComponent = m_AIs[i];
+            pAIComponent->m_canReselectBehavior = false;
+            pAIComponent->m_framesSinceBehaviorReselection++;
+
+            AIComponent::Significance const significance = pAIComponent->m_isInCombat ? AIComponent::Significance::High : pAIComponent->m_significance;
+            if ( pAIComponent->m_framesSinceBehaviorReselection >= s_behaviorReselectionIntervals[(uint8_t) significance] )
+            {
+                m_reselectionCandidates.emplace_back( i );
+            }
+        }
+
+        // If we are over budget, prioritize the AIs that are the most overdue relative to their interval
+        // Ties are broken by registration order so that the schedule is deterministic
+        //-------------------------------------------------------------------------
+
+        if ( m_reselectionCandidates.size() > m_maxBehaviorReselectionsPerFrame )
+        {
+            auto GetOverdueRatio = [this] ( int32_t idx )
+            {
+                AIComponent const* pAIComponent = m_AIs[idx];
+                AIComponent::Significance const significance = pAIComponent->m_isInCombat ? AIComponent::Significance::High : pAIComponent->m_significance;
+                return float( pAIComponent->m_framesSinceBehaviorReselection ) / s_behaviorReselectionIntervals[(uint8_t) significance];
+            };
+
+            eastl::sort( m_reselectionCandidates.begin(), m_reselectionCandidates.end(), [&GetOverdueRatio] ( int32_t a, int32_t b )
+            {
+                float const ratioA = GetOverdueRatio( a );
+                float const ratioB = GetOverdueRatio( b );
+                return ( ratioA != ratioB ) ? ratioA > ratioB : a < b;
+            } );
+
+            m_reselectionCandidates.resize( m_maxBehaviorReselectionsPerFrame );
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( int32_t idx : m_reselectionCandidates )
+        {
+            m_AIs[idx]->m_canReselectBehavior = true;
+            m_AIs[idx]->m_framesSinceBehaviorReselection = 0;
+        }
+
+        m_numBehaviorReselectionsScheduled = (uint32_t) m_reselectionCandidates.size();
     }
 
     bool AIManager::TrySpawnAI( EntityWorldUpdateContext const& ctx )
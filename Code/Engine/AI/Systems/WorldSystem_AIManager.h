@@ -20,15 +20,30 @@ namespace EE::AI
 
         EE_ENTITY_WORLD_SYSTEM( AIManager, RequiresUpdate( UpdateStage::PrePhysics ) );
 
+        constexpr static uint32_t const s_defaultMaxBehaviorReselectionsPerFrame = 32;
+
+        // How many frames can pass between behavior reselections for each significance level
+        constexpr static uint32_t const s_behaviorReselectionIntervals[] = { 1, 4, 16 };
+
+    public:
+
+        // Set the maximum number of AIs that are allowed to reselect their behavior each frame
+        inline void SetMaxBehaviorReselectionsPerFrame( uint32_t maxReselections ) { EE_ASSERT( maxReselections > 0 ); m_maxBehaviorReselectionsPerFrame = maxReselections; }
+        inline uint32_t GetMaxBehaviorReselectionsPerFrame() const { return m_maxBehaviorReselectionsPerFrame; }
+
     private:
 
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual bool GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const override;
 
         bool TrySpawnAI( EntityWorldUpdateContext const& ctx );
 
+        // Decide which AIs are allowed to reselect their behavior next frame
+        void ScheduleBehaviorReselection();
+
         // Hack
         void HackTrySpawnAI( EntityWorldUpdateContext const& ctx, int32_t numAIToSpawn );
 
@@ -36,6 +51,9 @@ namespace EE::AI
 
         TVector<AISpawnComponent*>          m_spawnPoints;
         TVector<AIComponent*>               m_AIs;
+        TVector<int32_t>                    m_reselectionCandidates;
+        uint32_t                            m_maxBehaviorReselectionsPerFrame = s_defaultMaxBehaviorReselectionsPerFrame;
+        uint32_t                            m_numBehaviorReselectionsScheduled = 0;
         bool                                m_hasSpawnedAI = false;
     };
 } 
\ No newline at end of file
@@ -15,6 +15,7 @@ namespace EE::Animation
         , m_graphContext( ownerID, pGraphDefinition->GetPrimarySkeleton() )
     {
         EE_ASSERT( pGraphDefinition != nullptr );
+        EE_MEMORY_TAG_SCOPE( Animation );
 
         //-------------------------------------------------------------------------
 
@@ -28,6 +28,12 @@ namespace EE::Animation
         }
     }
 
+    bool AnimationWorldSystem::GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const
+    {
+        outAccess.ReadsComponent<GraphComponent>();
+        return true;
+    }
+
     void AnimationWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         #if EE_DEVELOPMENT_TOOLS
@@ -30,6 +30,7 @@ namespace EE::Animation
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual bool GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const override;
 
     private:
 
@@ -94,6 +94,13 @@ namespace EE
         }
     }
 
+    bool CameraManager::GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const
+    {
+        // The debug camera entity is added to the persistent map
+        outAccess.WritesResource( WorldSystemDataAccess::s_persistentMapResourceID );
+        return true;
+    }
+
     void CameraManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         // Maintain valid active camera ptr
@@ -48,6 +48,7 @@ namespace EE
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual bool GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const override;
 
         #if EE_DEVELOPMENT_TOOLS
         #endif
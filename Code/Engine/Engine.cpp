@@ -1,5 +1,6 @@
 #include "Engine.h"
 #include "Engine/Console/Console.h"
+#include "Engine/Replay/SessionCapture.h"
 #include "Base/Network/NetworkSystem.h"
 #include "Base/Profiling.h"
 #include "Base/FileSystem/FileSystem.h"
@@ -119,6 +120,19 @@ namespace EE
         // Initialize core engine state
         //-------------------------------------------------------------------------
 
+        // Load the session to replay, the recorded startup map overrides the requested one
+        if ( m_sessionReplayPath.IsValid() )
+        {
+            m_pSessionPlayer = EE::New<Replay::SessionPlayer>();
+            if ( !m_pSessionPlayer->Load( m_sessionReplayPath ) || m_pSessionPlayer->IsComplete() )
+            {
+                EE::Delete( m_pSessionPlayer );
+                return m_fatalErrorHandler( "Failed to load session capture or the capture contains no frames!" );
+            }
+
+            m_startupMap = m_pSessionPlayer->GetStartupMap();
+        }
+
         m_initializationStageReached = Stage::InitializeEngine;
 
         // Initialize entity world manager and load startup map
@@ -129,6 +143,23 @@ namespace EE
             m_pEntityWorldManager->GetWorlds()[0]->LoadMap( mapResourceID );
         }
 
+        // Start session capture or replay
+        // Both need all world updates to be deterministic, otherwise random values are consumed in thread scheduling order and the replay diverges
+        if ( m_pSessionPlayer != nullptr )
+        {
+            m_pEntityWorldManager->SetDeterministicUpdateEnabled( true );
+
+            // Replays run as fast as possible using the recorded time deltas
+            m_updateContext.SetFrameRateLimit( 0 );
+            m_updateContext.m_deltaTime = m_pSessionPlayer->GetFrameDeltaTime();
+            m_pSessionPlayer->Start( m_pEntityWorldManager->GetWorlds()[0] );
+        }
+        else if ( m_sessionCapturePath.IsValid() )
+        {
+            m_pEntityWorldManager->SetDeterministicUpdateEnabled( true );
+            m_pSessionRecorder = EE::New<Replay::SessionRecorder>( m_pEntityWorldManager->GetWorlds()[0], m_startupMap );
+        }
+
         // Initialize rendering system
         m_renderingSystem.Initialize( m_pRenderDevice, Float2( windowDimensions ), pEngineModule->GetRendererRegistry(), m_pEntityWorldManager );
         m_pSystemRegistry->RegisterSystem( &m_renderingSystem );
@@ -177,6 +208,23 @@ namespace EE
 
         if ( m_initializationStageReached == Stage::InitializeEngine )
         {
+            // Save session capture and replay results
+            if ( m_pSessionRecorder != nullptr )
+            {
+                if ( !m_pSessionRecorder->Save( m_sessionCapturePath ) )
+                {
+                    EE_LOG_ERROR( "Replay", nullptr, "Failed to save session capture: %s", m_sessionCapturePath.c_str() );
+                }
+
+                EE::Delete( m_pSessionRecorder );
+            }
+
+            if ( m_pSessionPlayer != nullptr )
+            {
+                m_pSessionPlayer->SaveReport();
+                EE::Delete( m_pSessionPlayer );
+            }
+
             // Destroy development tools
             #if EE_DEVELOPMENT_TOOLS
             EE_ASSERT( m_pDevelopmentToolsUI != nullptr );
@@ -296,6 +344,16 @@ namespace EE
 
         Profiling::StartFrame();
 
+        // This needs to occur before anything in the frame generates random numbers
+        if ( m_pSessionPlayer != nullptr )
+        {
+            m_pSessionPlayer->BeginFrame();
+        }
+        else if ( m_pSessionRecorder != nullptr )
+        {
+            m_pSessionRecorder->BeginFrame( m_updateContext.GetDeltaTime() );
+        }
+
         Milliseconds deltaTime = 0;
         {
             ScopedTimer<PlatformClock> frameTimer( deltaTime );
@@ -424,7 +482,19 @@ namespace EE
 
                     {
                         EE_PROFILE_SCOPE_DEVTOOLS( "Input System" );
-                        m_pInputSystem->Update( m_updateContext.GetDeltaTime() );
+                        if ( m_pSessionPlayer != nullptr )
+                        {
+                            m_pSessionPlayer->ReplayInputState( *m_pInputSystem );
+                        }
+                        else
+                        {
+                            m_pInputSystem->Update( m_updateContext.GetDeltaTime() );
+
+                            if ( m_pSessionRecorder != nullptr )
+                            {
+                                m_pSessionRecorder->RecordInputState( *m_pInputSystem );
+                            }
+                        }
                     }
 
                     #if EE_DEVELOPMENT_TOOLS
@@ -499,6 +569,11 @@ namespace EE
 
                     m_pEntityWorldManager->UpdateWorlds( m_updateContext );
 
+                    if ( m_pSessionPlayer != nullptr )
+                    {
+                        m_pSessionPlayer->ReplayMapRequests();
+                    }
+
                     //-------------------------------------------------------------------------
 
                     #if EE_DEVELOPMENT_TOOLS
@@ -508,31 +583,59 @@ namespace EE
 
                     m_pEntityWorldManager->EndFrame();
 
-                    m_renderingSystem.Update( m_updateContext );
+                    // Replays only measure the simulation cost so skip rendering
+                    if ( m_pSessionPlayer == nullptr )
+                    {
+                        m_renderingSystem.Update( m_updateContext );
+                    }
+
                     m_pInputSystem->PrepareForNewMessages();
                 }
             }
         }
 
-        // Update Time
+        // Session Capture
         //-------------------------------------------------------------------------
 
-        // Ensure we dont get crazy time delta's when we hit breakpoints
-        #if EE_DEVELOPMENT_TOOLS
-        if ( deltaTime.ToSeconds() > 1.0f )
+        bool replayCompleted = false;
+
+        if ( m_pSessionPlayer != nullptr )
         {
-            deltaTime = m_updateContext.GetDeltaTime(); // Keep last frame delta
+            // Time always advances by the recorded delta so that the simulation matches the captured session
+            m_pSessionPlayer->EndFrame( deltaTime, *m_pEntityWorldManager );
+            replayCompleted = m_pSessionPlayer->IsComplete();
+            if ( !replayCompleted )
+            {
+                deltaTime = m_pSessionPlayer->GetFrameDeltaTime().ToMilliseconds();
+            }
         }
-        #endif
+        else if ( m_pSessionRecorder != nullptr )
+        {
+            m_pSessionRecorder->EndFrame();
+        }
+
+        // Update Time
+        //-------------------------------------------------------------------------
 
-        // Frame rate limiter
-        if ( m_updateContext.HasFrameRateLimit() )
+        if ( m_pSessionPlayer == nullptr )
         {
-            float const minimumFrameTime = m_updateContext.GetLimitedFrameTime();
-            if ( deltaTime < minimumFrameTime )
+            // Ensure we dont get crazy time delta's when we hit breakpoints
+            #if EE_DEVELOPMENT_TOOLS
+            if ( deltaTime.ToSeconds() > 1.0f )
             {
-                Threading::Sleep( minimumFrameTime - deltaTime );
-                deltaTime = minimumFrameTime;
+                deltaTime = m_updateContext.GetDeltaTime(); // Keep last frame delta
+            }
+            #endif
+
+            // Frame rate limiter
+            if ( m_updateContext.HasFrameRateLimit() )
+            {
+                float const minimumFrameTime = m_updateContext.GetLimitedFrameTime();
+                if ( deltaTime < minimumFrameTime )
+                {
+                    Threading::Sleep( minimumFrameTime - deltaTime );
+                    deltaTime = minimumFrameTime;
+                }
             }
         }
 
@@ -543,6 +646,12 @@ namespace EE
         // Should we exit?
         //-------------------------------------------------------------------------
 
+        if ( replayCompleted )
+        {
+            EE_LOG_INFO( "Replay", nullptr, "Session replay complete" );
+            return false;
+        }
+
         return true;
     }
 }
\ No newline at end of file
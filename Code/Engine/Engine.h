@@ -7,6 +7,15 @@
 #include "Engine/UpdateContext.h"
 #include "Base/_Module/BaseModule.h"
 #include "Base/Types/Function.h"
+#include "Base/FileSystem/FileSystemPath.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Replay
+{
+    class SessionRecorder;
+    class SessionPlayer;
+}
 
 //-------------------------------------------------------------------------
 
@@ -95,6 +104,14 @@ namespace EE
         Console*                                        m_pConsole = nullptr;
         #endif
 
+        // Session capture and replay
+        //-------------------------------------------------------------------------
+
+        FileSystem::Path                                m_sessionCapturePath; // If set, the game world session is recorded and saved to this path on shutdown
+        FileSystem::Path                                m_sessionReplayPath; // If set, the recorded session is replayed and the engine exits once the replay completes
+        Replay::SessionRecorder*                        m_pSessionRecorder = nullptr;
+        Replay::SessionPlayer*                          m_pSessionPlayer = nullptr;
+
         // Application data
         //-------------------------------------------------------------------------
 
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Engine/Entity/EntityComponent.h"
+#include "Engine/Entity/EntityMapStreaming.h"
+
+//-------------------------------------------------------------------------
+// Map Streaming Settings
+//-------------------------------------------------------------------------
+// Adding this component to a map will partition the map into streaming cells when it is compiled
+// This component has no runtime behavior, the settings are baked into the compiled map
+
+namespace EE::EntityModel
+{
+    class EE_ENGINE_API MapStreamingSettingsComponent : public EntityComponent
+    {
+        EE_SINGLETON_ENTITY_COMPONENT( MapStreamingSettingsComponent );
+
+    public:
+
+        inline MapStreamingSettingsComponent() = default;
+
+        inline MapStreamingSettings GetStreamingSettings() const
+        {
+            MapStreamingSettings settings;
+            settings.m_cellSize = m_cellSize;
+            settings.m_loadRadius = m_loadRadius;
+            settings.m_unloadRadius = Math::Max( m_unloadRadius, m_loadRadius );
+            settings.m_maxCellsToLoadPerFrame = m_maxCellsToLoadPerFrame;
+            settings.m_maxLoadingEntities = m_maxLoadingEntities;
+            return settings;
+        }
+
+    private:
+
+        EE_REFLECT( Category = "Partitioning" )
+        float                                   m_cellSize = 64.0f; // The size of each (square) streaming cell in meters
+
+        EE_REFLECT( Category = "Streaming" )
+        float                                   m_loadRadius = 128.0f; // Cells within this distance of a streaming source will be loaded
+
+        EE_REFLECT( Category = "Streaming" )
+        float                                   m_unloadRadius = 160.0f; // Loaded cells are only unloaded once they are further than this from all streaming sources
+
+        EE_REFLECT( Category = "Budgets" )
+        int32_t                                 m_maxCellsToLoadPerFrame = 1; // The maximum number of cells to instantiate per frame
+
+        EE_REFLECT( Category = "Budgets" )
+        int32_t                                 m_maxLoadingEntities = 256; // No new cells will be loaded while more than this number of entities are still loading
+    };
+}
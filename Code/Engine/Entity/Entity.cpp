@@ -12,6 +12,8 @@
 namespace EE
 {
     TEvent<Entity*> Entity::s_entityInternalStateUpdatedEvent;
+    TEvent<Entity*, EntityComponent*> Entity::s_entityComponentAddedEvent;
+    TEvent<Entity*, EntityComponent*> Entity::s_entityComponentDestroyedEvent;
 
     //-------------------------------------------------------------------------
 
@@ -127,6 +129,8 @@ namespace EE
 
         Threading::RecursiveScopeLock myLock( m_internalStateMutex );
 
+        m_pUpdateLayoutVersion = &initializationContext.m_updateLayoutVersion;
+
         // Initialize spatial hierarchy
         //-------------------------------------------------------------------------
         // Transforms are set at serialization time so we have all information available to update the world transforms
@@ -251,6 +255,8 @@ namespace EE
             {
                 m_systemUpdateLists[i].clear();
             }
+
+            initializationContext.m_updateLayoutVersion.fetch_add( 1, std::memory_order_relaxed );
         }
 
         for ( auto pSystem : m_systems )
@@ -278,6 +284,7 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
+        m_pUpdateLayoutVersion = nullptr;
         m_status = Status::Loaded;
     }
 
@@ -563,6 +570,9 @@ namespace EE
             pParentEntity->m_attachedEntities.emplace_back( this );
         }
 
+        IncrementUpdateLayoutVersion();
+        pParentEntity->IncrementUpdateLayoutVersion();
+
         //-------------------------------------------------------------------------
 
         // If we need to keep our current world position intact, calculate the required local transform offset to do so
@@ -601,6 +611,9 @@ namespace EE
         EE_ASSERT( iter != m_pParentSpatialEntity->m_attachedEntities.end() );
         m_pParentSpatialEntity->m_attachedEntities.erase_unsorted( iter );
 
+        IncrementUpdateLayoutVersion();
+        m_pParentSpatialEntity->IncrementUpdateLayoutVersion();
+
         // Clear attachment data
         m_parentAttachmentSocketID = StringID();
         m_pParentSpatialEntity = nullptr;
@@ -768,6 +781,8 @@ namespace EE
 
             eastl::sort( m_systemUpdateLists[i].begin(), m_systemUpdateLists[i].end(), comparator );
         }
+
+        IncrementUpdateLayoutVersion();
     }
 
     void Entity::CreateSystemImmediate( TypeSystem::TypeInfo const* pSystemTypeInfo )
@@ -1057,6 +1072,7 @@ namespace EE
 
         m_components.emplace_back( pComponent );
         pComponent->m_entityID = m_ID;
+        s_entityComponentAddedEvent.Execute( this, pComponent );
     }
 
     void Entity::DestroyComponentImmediate( EntityComponent* pComponent )
@@ -1080,6 +1096,7 @@ namespace EE
         // Remove component
         //-------------------------------------------------------------------------
 
+        s_entityComponentDestroyedEvent.Execute( this, pComponent );
         m_components.erase_unsorted( m_components.begin() + componentIdx );
         EE::Delete( pComponent );
     }
@@ -5,6 +5,7 @@
 #include "Engine/UpdateStage.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Types/Event.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 // Entity
@@ -80,6 +81,10 @@ namespace EE
         // Event that's fired whenever a component/system is added or removed
         static TEvent<Entity*>                  s_entityInternalStateUpdatedEvent;
 
+        // Events that are fired whenever a component is added to or destroyed from an entity
+        static TEvent<Entity*, EntityComponent*>    s_entityComponentAddedEvent;
+        static TEvent<Entity*, EntityComponent*>    s_entityComponentDestroyedEvent;
+
         // Registration state
         enum class UpdateRegistrationStatus : uint8_t
         {
@@ -107,6 +112,12 @@ namespace EE
         // Event that's fired whenever an entities internal state changes and it requires an state update
         static TEventHandle<Entity*> OnEntityInternalStateUpdated() { return s_entityInternalStateUpdatedEvent; }
 
+        // Event that's fired whenever a component is added to an entity (after the component has been added)
+        static TEventHandle<Entity*, EntityComponent*> OnEntityComponentAdded() { return s_entityComponentAddedEvent; }
+
+        // Event that's fired whenever a component is destroyed (before the component is deleted)
+        static TEventHandle<Entity*, EntityComponent*> OnEntityComponentDestroyed() { return s_entityComponentDestroyedEvent; }
+
     public:
 
         Entity() = default;
@@ -236,6 +247,9 @@ namespace EE
         // Run Entity Systems
         void UpdateSystems( EntityWorldUpdateContext const& context );
 
+        // Get the systems that need to be updated for the specified stage, in update order
+        inline SystemUpdateList const& GetSystemUpdateList( UpdateStage stage ) const { return m_systemUpdateLists[(int8_t) stage]; }
+
         // Get a specific system
         template<typename T>
         T* GetSystem()
@@ -325,6 +339,9 @@ namespace EE
         // Generate the per-stage update lists for this entity
         void GenerateSystemUpdateList();
 
+        // Notify the owning world that something affecting how this entity is updated has changed (systems, attachments), does nothing if not initialized
+        inline void IncrementUpdateLayoutVersion() { if ( m_pUpdateLayoutVersion != nullptr ) { m_pUpdateLayoutVersion->fetch_add( 1, std::memory_order_relaxed ); } }
+
         // Registers a component with all the local entity systems
         void RegisterComponentWithLocalSystems( EntityComponent* pComponent );
 
@@ -361,6 +378,7 @@ namespace EE
         EE_REFLECT( ReadOnly ) StringID     m_name;                                                                 // The name of the entity, only unique within the context of a map
         Status                                              m_status = Status::Unloaded;
         UpdateRegistrationStatus                            m_updateRegistrationStatus = UpdateRegistrationStatus::Unregistered;    // Is this entity registered for frame updates
+        std::atomic<uint32_t>*                              m_pUpdateLayoutVersion = nullptr;                                       // The update layout version of the world we are initialized in, see 'InitializationContext'
 
         TVector<EntitySystem*>                              m_systems;
         TVector<EntityComponent*>                           m_components;
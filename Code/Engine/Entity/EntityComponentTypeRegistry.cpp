@@ -0,0 +1,83 @@
+#include "EntityComponentTypeRegistry.h"
+#include "EntityComponent.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    // Get the position of the specified type in the component's type hierarchy (0 is the component's own type)
+    static uint32_t GetTypeHierarchyDepth( EntityComponent const* pComponent, TypeSystem::TypeID typeID )
+    {
+        uint32_t depth = 0;
+        TypeSystem::TypeInfo const* pTypeInfo = pComponent->GetTypeInfo();
+        while ( pTypeInfo->m_ID != typeID )
+        {
+            pTypeInfo = pTypeInfo->m_pParentTypeInfo;
+            EE_ASSERT( pTypeInfo != nullptr );
+            depth++;
+        }
+
+        return depth;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ComponentTypeRegistry::AddComponent( EntityComponent const* pComponent )
+    {
+        EE_ASSERT( pComponent != nullptr );
+
+        TInlineVector<uint32_t, 6>& listIndices = m_componentListIndices[pComponent];
+        EE_ASSERT( listIndices.empty() );
+
+        TypeSystem::TypeInfo const* pTypeInfo = pComponent->GetTypeInfo();
+        while ( pTypeInfo != nullptr )
+        {
+            TVector<EntityComponent const*>& components = m_componentsByType[pTypeInfo->m_ID];
+            listIndices.emplace_back( (uint32_t) components.size() );
+            components.emplace_back( pComponent );
+            pTypeInfo = pTypeInfo->m_pParentTypeInfo;
+        }
+    }
+
+    void ComponentTypeRegistry::RemoveComponent( EntityComponent const* pComponent )
+    {
+        EE_ASSERT( pComponent != nullptr );
+
+        auto indicesIter = m_componentListIndices.find( pComponent );
+        EE_ASSERT( indicesIter != m_componentListIndices.end() );
+
+        uint32_t depth = 0;
+        TypeSystem::TypeInfo const* pTypeInfo = pComponent->GetTypeInfo();
+        while ( pTypeInfo != nullptr )
+        {
+            auto iter = m_componentsByType.find( pTypeInfo->m_ID );
+            EE_ASSERT( iter != m_componentsByType.end() );
+
+            // Swap-remove, and fix up the index of the component we moved into the freed slot
+            TVector<EntityComponent const*>& components = iter->second;
+            uint32_t const listIdx = indicesIter->second[depth];
+            EE_ASSERT( components[listIdx] == pComponent );
+
+            EntityComponent const* pLastComponent = components.back();
+            if ( pLastComponent != pComponent )
+            {
+                components[listIdx] = pLastComponent;
+
+                auto lastIndicesIter = m_componentListIndices.find( pLastComponent );
+                EE_ASSERT( lastIndicesIter != m_componentListIndices.end() );
+                lastIndicesIter->second[GetTypeHierarchyDepth( pLastComponent, pTypeInfo->m_ID )] = listIdx;
+            }
+            components.pop_back();
+
+            pTypeInfo = pTypeInfo->m_pParentTypeInfo;
+            depth++;
+        }
+
+        m_componentListIndices.erase( indicesIter );
+    }
+
+    bool ComponentTypeRegistry::IsEmpty() const
+    {
+        return m_componentListIndices.empty();
+    }
+}
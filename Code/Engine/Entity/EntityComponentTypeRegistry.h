@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/TypeSystem/TypeID.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    class EntityComponent;
+}
+
+//-------------------------------------------------------------------------
+// Component Type Registry
+//-------------------------------------------------------------------------
+// Tracks a set of components by type so that we can find all components of a given type without having to iterate over all entities
+// Each component is tracked under its own type as well as all of its parent types, so lookups by a base type will also return all derived components
+// We also store each component's index in each of its type lists, so that removal is a constant time swap-remove per type
+// Note: this is not threadsafe, the owner is expected to synchronize access
+
+namespace EE::EntityModel
+{
+    class EE_ENGINE_API ComponentTypeRegistry
+    {
+    public:
+
+        void AddComponent( EntityComponent const* pComponent );
+        void RemoveComponent( EntityComponent const* pComponent );
+        void Clear() { m_componentsByType.clear(); m_componentListIndices.clear(); }
+
+        // Are there any components in the registry?
+        bool IsEmpty() const;
+
+        // Get all components of (or derived from) the specified type, returns nullptr if there are none
+        inline TVector<EntityComponent const*> const* GetComponentsOfType( TypeSystem::TypeID typeID ) const
+        {
+            auto iter = m_componentsByType.find( typeID );
+            if ( iter == m_componentsByType.end() || iter->second.empty() )
+            {
+                return nullptr;
+            }
+
+            return &iter->second;
+        }
+
+    private:
+
+        THashMap<TypeSystem::TypeID, TVector<EntityComponent const*>>       m_componentsByType;
+        THashMap<EntityComponent const*, TInlineVector<uint32_t, 6>>        m_componentListIndices; // The index in each type list, ordered as the type hierarchy (most derived first)
+    };
+}
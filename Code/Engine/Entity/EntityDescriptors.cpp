@@ -329,6 +329,9 @@ namespace EE::EntityModel
 
         // Generate spatial hierarchy depths
         //-------------------------------------------------------------------------
+        // The lookup map needs to match the new descriptors before we can resolve the parents
+
+        RebuildLookupMap();
 
         for ( int32_t i = 0; i < numEntities; i++ )
         {
@@ -406,4 +409,145 @@ namespace EE::EntityModel
         }
     }
     #endif
+
+    //-------------------------------------------------------------------------
+    // Entity Map Descriptor
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    void EntityMapDescriptor::PartitionIntoStreamingCells( TypeSystem::TypeRegistry const& typeRegistry, MapStreamingSettings const& settings, TInlineVector<TypeSystem::TypeID, 4> const& alwaysLoadedComponentTypes )
+    {
+        EE_ASSERT( settings.IsValid() );
+        EE_ASSERT( m_streamingCells.empty() );
+
+        int32_t const numEntities = (int32_t) m_entityDescriptors.size();
+
+        // Find the root entity of each attachment chain
+        //-------------------------------------------------------------------------
+        // Attached entities need to be in the same collection as their parents. Entities are sorted by hierarchy depth, so parents are always processed first.
+
+        TVector<int32_t> rootEntityIndices;
+        rootEntityIndices.resize( numEntities, InvalidIndex );
+
+        for ( int32_t i = 0; i < numEntities; i++ )
+        {
+            rootEntityIndices[i] = i;
+
+            EntityDescriptor const& entityDesc = m_entityDescriptors[i];
+            if ( entityDesc.IsSpatialEntity() && entityDesc.HasSpatialParent() )
+            {
+                int32_t const parentIdx = FindEntityIndex( entityDesc.m_spatialParentName );
+                if ( parentIdx != InvalidIndex )
+                {
+                    EE_ASSERT( parentIdx < i );
+                    rootEntityIndices[i] = rootEntityIndices[parentIdx];
+                }
+            }
+        }
+
+        // Flag all the attachment chains that need to always be loaded
+        //-------------------------------------------------------------------------
+
+        TVector<bool> isChainAlwaysLoaded;
+        isChainAlwaysLoaded.resize( numEntities, false );
+
+        for ( int32_t i = 0; i < numEntities; i++ )
+        {
+            EntityDescriptor const& entityDesc = m_entityDescriptors[i];
+            bool isAlwaysLoaded = !entityDesc.IsSpatialEntity();
+
+            for ( int32_t c = 0; c < (int32_t) entityDesc.m_components.size() && !isAlwaysLoaded; c++ )
+            {
+                TypeSystem::TypeInfo const* pComponentTypeInfo = typeRegistry.GetTypeInfo( entityDesc.m_components[c].m_typeID );
+                if ( pComponentTypeInfo == nullptr )
+                {
+                    continue;
+                }
+
+                for ( TypeSystem::TypeID const& alwaysLoadedTypeID : alwaysLoadedComponentTypes )
+                {
+                    if ( pComponentTypeInfo->IsDerivedFrom( alwaysLoadedTypeID ) )
+                    {
+                        isAlwaysLoaded = true;
+                        break;
+                    }
+                }
+            }
+
+            if ( isAlwaysLoaded )
+            {
+                isChainAlwaysLoaded[rootEntityIndices[i]] = true;
+            }
+        }
+
+        // Assign each attachment chain to a cell based on the position of its root entity
+        //-------------------------------------------------------------------------
+
+        THashMap<uint64_t, int32_t> cellLookupMap;
+        TVector<Int2> cellCoords;
+        TVector<int32_t> entityCellIndices;
+        entityCellIndices.resize( numEntities, InvalidIndex );
+
+        for ( int32_t i = 0; i < numEntities; i++ )
+        {
+            int32_t const rootIdx = rootEntityIndices[i];
+            if ( isChainAlwaysLoaded[rootIdx] )
+            {
+                continue;
+            }
+
+            if ( rootIdx != i )
+            {
+                entityCellIndices[i] = entityCellIndices[rootIdx];
+                continue;
+            }
+
+            // We need to instantiate the entity to get its world position since the transform is stored as a serialized property
+            Entity* pEntity = m_entityDescriptors[i].CreateEntity( typeRegistry );
+            Float3 const position = pEntity->GetWorldTransform().GetTranslation().ToFloat3();
+            EE::Delete( pEntity );
+
+            Int2 const coords( Math::FloorToInt( position.m_x / settings.m_cellSize ), Math::FloorToInt( position.m_y / settings.m_cellSize ) );
+            uint64_t const cellKey = ( uint64_t( uint32_t( coords.m_x ) ) << 32 ) | uint64_t( uint32_t( coords.m_y ) );
+
+            auto iter = cellLookupMap.find( cellKey );
+            if ( iter == cellLookupMap.end() )
+            {
+                iter = cellLookupMap.insert( TPair<uint64_t, int32_t>( cellKey, (int32_t) cellCoords.size() ) ).first;
+                cellCoords.emplace_back( coords );
+            }
+
+            entityCellIndices[i] = iter->second;
+        }
+
+        // Split the entity descriptors
+        //-------------------------------------------------------------------------
+
+        TVector<EntityDescriptor> alwaysLoadedEntities;
+        TVector<TVector<EntityDescriptor>> cellEntities;
+        cellEntities.resize( cellCoords.size() );
+
+        for ( int32_t i = 0; i < numEntities; i++ )
+        {
+            if ( entityCellIndices[i] == InvalidIndex )
+            {
+                alwaysLoadedEntities.emplace_back( eastl::move( m_entityDescriptors[i] ) );
+            }
+            else
+            {
+                cellEntities[entityCellIndices[i]].emplace_back( eastl::move( m_entityDescriptors[i] ) );
+            }
+        }
+
+        m_streamingSettings = settings;
+        m_streamingCells.resize( cellCoords.size() );
+        for ( int32_t c = 0; c < (int32_t) cellCoords.size(); c++ )
+        {
+            m_streamingCells[c].m_coords = cellCoords[c];
+            m_streamingCells[c].m_entities.SetCollectionData( eastl::move( cellEntities[c] ) );
+        }
+
+        SetCollectionData( eastl::move( alwaysLoadedEntities ) );
+    }
+    #endif
 }
\ No newline at end of file
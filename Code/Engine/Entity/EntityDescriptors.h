@@ -1,6 +1,7 @@
 #pragma once
 #include "Engine/_Module/API.h"
 #include "EntityIDs.h"
+#include "EntityMapStreaming.h"
 #include "Base/Resource/IResource.h"
 #include "Base/TypeSystem/TypeDescriptors.h"
 
@@ -271,10 +272,39 @@ namespace EE::EntityModel
 
     class EE_ENGINE_API EntityMapDescriptor final : public EntityCollection
     {
-        EE_RESOURCE( 'map', "Map", 4, false );
-        EE_SERIALIZE( EE_SERIALIZE_BASE( EntityCollection ) );
+        EE_RESOURCE( 'map', "Map", 5, false );
+        EE_SERIALIZE( EE_SERIALIZE_BASE( EntityCollection ), m_streamingSettings, m_streamingCells );
 
         friend class EntityCollectionCompiler;
         friend class EntityCollectionLoader;
+
+    public:
+
+        // A spatial cell of a partitioned map, each cell is a separate collection that is instantiated when the cell is streamed in
+        struct StreamingCell
+        {
+            EE_SERIALIZE( m_coords, m_entities );
+
+            Int2                                                    m_coords = Int2( 0 );
+            EntityCollection                                        m_entities;
+        };
+
+    public:
+
+        // Partitioned maps only contain the always-loaded entities in the base collection, all other entities are stored in the streaming cells
+        inline bool IsPartitioned() const { return !m_streamingCells.empty(); }
+        inline MapStreamingSettings const& GetStreamingSettings() const { return m_streamingSettings; }
+        inline TVector<StreamingCell> const& GetStreamingCells() const { return m_streamingCells; }
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Move all spatial entities into streaming cells based on the position of the root entity of their attachment chain
+        // Non-spatial entities and any attachment chains containing a component of one of the supplied types will remain in the always-loaded collection
+        void PartitionIntoStreamingCells( TypeSystem::TypeRegistry const& typeRegistry, MapStreamingSettings const& settings, TInlineVector<TypeSystem::TypeID, 4> const& alwaysLoadedComponentTypes );
+        #endif
+
+    private:
+
+        MapStreamingSettings                                        m_streamingSettings;
+        TVector<StreamingCell>                                      m_streamingCells;
     };
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "Base/Threading/Threading.h"
 #include "Base/TypeSystem/TypeID.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
@@ -19,6 +20,10 @@ namespace EE
 
 namespace EE::EntityModel
 {
+    class ComponentTypeRegistry;
+
+    //-------------------------------------------------------------------------
+
     struct EntityComponentPair
     {
         EntityComponentPair() = default;
@@ -28,8 +33,6 @@ namespace EE::EntityModel
         EntityComponent*    m_pComponent = nullptr;
     };
 
-    using EntityComponentTypeMap = THashMap<TypeSystem::TypeID, TVector<EntityComponent const*>>;
-
     //-------------------------------------------------------------------------
 
     struct InitializationContext
@@ -44,13 +47,13 @@ namespace EE::EntityModel
         {}
 
         #if EE_DEVELOPMENT_TOOLS
-        void SetComponentTypeMapPtr( EntityComponentTypeMap* pMap ) { m_pComponentTypeMap = pMap; }
+        void SetComponentTypeRegistryPtr( ComponentTypeRegistry* pRegistry ) { m_pComponentTypeRegistry = pRegistry; }
         #endif
 
         inline bool IsValid() const
         {
             #if EE_DEVELOPMENT_TOOLS
-            if ( m_pComponentTypeMap == nullptr ) return false;
+            if ( m_pComponentTypeRegistry == nullptr ) return false;
             #endif
 
             return m_pTaskSystem != nullptr && m_pTypeRegistry != nullptr;
@@ -69,13 +72,17 @@ namespace EE::EntityModel
         Threading::LockFreeQueue<Entity*>                           m_registerForEntityUpdate;
         Threading::LockFreeQueue<Entity*>                           m_unregisterForEntityUpdate;
 
+        // Incremented whenever anything affecting how this world's entities are updated changes (systems, attachments, update registration)
+        // Used by the world to know when its batched entity system update lists need to be rebuilt
+        std::atomic<uint32_t>                                       m_updateLayoutVersion = 0;
+
     private:
 
         TVector<EntityWorldSystem*> const&                          m_worldSystems;
         TVector<Entity*>&                                           m_entityUpdateList;
 
         #if EE_DEVELOPMENT_TOOLS
-        EntityComponentTypeMap*                                     m_pComponentTypeMap = nullptr;
+        ComponentTypeRegistry*                                      m_pComponentTypeRegistry = nullptr;
         #endif
     };
 }
\ No newline at end of file
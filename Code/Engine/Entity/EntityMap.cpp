@@ -14,22 +14,30 @@ namespace EE::EntityModel
 {
     EntityMap::EntityMap()
         : m_entityUpdateEventBindingID( Entity::OnEntityInternalStateUpdated().Bind( [this] ( Entity* pEntity ) { OnEntityStateUpdated( pEntity ); } ) )
+        , m_componentAddedEventBindingID( Entity::OnEntityComponentAdded().Bind( [this] ( Entity* pEntity, EntityComponent* pComponent ) { OnEntityComponentAdded( pEntity, pComponent ); } ) )
+        , m_componentDestroyedEventBindingID( Entity::OnEntityComponentDestroyed().Bind( [this] ( Entity* pEntity, EntityComponent* pComponent ) { OnEntityComponentDestroyed( pEntity, pComponent ); } ) )
         , m_isTransientMap( true )
     {}
 
     EntityMap::EntityMap( ResourceID mapResourceID )
         : m_pMapDesc( mapResourceID )
         , m_entityUpdateEventBindingID( Entity::OnEntityInternalStateUpdated().Bind( [this] ( Entity* pEntity ) { OnEntityStateUpdated( pEntity ); } ) )
+        , m_componentAddedEventBindingID( Entity::OnEntityComponentAdded().Bind( [this] ( Entity* pEntity, EntityComponent* pComponent ) { OnEntityComponentAdded( pEntity, pComponent ); } ) )
+        , m_componentDestroyedEventBindingID( Entity::OnEntityComponentDestroyed().Bind( [this] ( Entity* pEntity, EntityComponent* pComponent ) { OnEntityComponentDestroyed( pEntity, pComponent ); } ) )
     {}
 
     EntityMap::EntityMap( EntityMap const& map )
         : m_entityUpdateEventBindingID( Entity::OnEntityInternalStateUpdated().Bind( [this] ( Entity* pEntity ) { OnEntityStateUpdated( pEntity ); } ) )
+        , m_componentAddedEventBindingID( Entity::OnEntityComponentAdded().Bind( [this] ( Entity* pEntity, EntityComponent* pComponent ) { OnEntityComponentAdded( pEntity, pComponent ); } ) )
+        , m_componentDestroyedEventBindingID( Entity::OnEntityComponentDestroyed().Bind( [this] ( Entity* pEntity, EntityComponent* pComponent ) { OnEntityComponentDestroyed( pEntity, pComponent ); } ) )
     {
         operator=( map );
     }
 
     EntityMap::EntityMap( EntityMap&& map )
         : m_entityUpdateEventBindingID( Entity::OnEntityInternalStateUpdated().Bind( [this] ( Entity* pEntity ) { OnEntityStateUpdated( pEntity ); } ) )
+        , m_componentAddedEventBindingID( Entity::OnEntityComponentAdded().Bind( [this] ( Entity* pEntity, EntityComponent* pComponent ) { OnEntityComponentAdded( pEntity, pComponent ); } ) )
+        , m_componentDestroyedEventBindingID( Entity::OnEntityComponentDestroyed().Bind( [this] ( Entity* pEntity, EntityComponent* pComponent ) { OnEntityComponentDestroyed( pEntity, pComponent ); } ) )
     {
         operator=( eastl::move( map ) );
     }
@@ -37,15 +45,17 @@ namespace EE::EntityModel
     EntityMap::~EntityMap()
     {
         EE_ASSERT( IsUnloaded() );
-        EE_ASSERT( m_entities.empty() && m_entityIDLookupMap.empty() );
+        EE_ASSERT( m_entities.empty() && m_entityIDLookupMap.empty() && m_componentTypeRegistry.IsEmpty() );
         EE_ASSERT( m_entitiesToLoad.empty() && m_entitiesToRemove.empty() );
 
         #if EE_DEVELOPMENT_TOOLS
         EE_ASSERT( m_entitiesToHotReload.empty() );
-        EE_ASSERT( m_editedEntities.empty() );
+        EE_ASSERT( m_editedEntities.empty() && m_editedComponents.empty() );
         #endif
 
         Entity::OnEntityInternalStateUpdated().Unbind( m_entityUpdateEventBindingID );
+        Entity::OnEntityComponentAdded().Unbind( m_componentAddedEventBindingID );
+        Entity::OnEntityComponentDestroyed().Unbind( m_componentDestroyedEventBindingID );
     }
 
     //-------------------------------------------------------------------------
@@ -73,6 +83,9 @@ namespace EE::EntityModel
         m_ID = map.m_ID;
         m_entities.swap( map.m_entities );
         m_entityIDLookupMap.swap( map.m_entityIDLookupMap );
+        eastl::swap( m_componentTypeRegistry, map.m_componentTypeRegistry );
+        eastl::swap( m_cellStreamer, map.m_cellStreamer );
+        m_streamingCellEntities.swap( map.m_streamingCellEntities );
         m_pMapDesc = eastl::move( map.m_pMapDesc );
         m_entitiesCurrentlyLoading = eastl::move( map.m_entitiesCurrentlyLoading );
         m_status = map.m_status;
@@ -148,6 +161,11 @@ namespace EE::EntityModel
         #if EE_DEVELOPMENT_TOOLS
         m_entityNameLookupMap.insert( TPair<StringID, Entity*>( pEntity->m_name, pEntity ) );
         #endif
+
+        for ( auto pComponent : pEntity->GetComponents() )
+        {
+            m_componentTypeRegistry.AddComponent( pComponent );
+        }
     }
 
     void EntityMap::AddEntityCollection( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, EntityCollection const& entityCollectionDesc, Transform const& offsetTransform, TVector<Entity*>* pOutCreatedEntities )
@@ -203,6 +221,11 @@ namespace EE::EntityModel
         EE_ASSERT( IDLookupIter != m_entityIDLookupMap.end() );
         m_entityIDLookupMap.erase( IDLookupIter );
 
+        for ( auto pComponent : pEntityToRemove->GetComponents() )
+        {
+            m_componentTypeRegistry.RemoveComponent( pComponent );
+        }
+
         #if EE_DEVELOPMENT_TOOLS
         auto nameLookupIter = m_entityNameLookupMap.find( pEntityToRemove->m_name );
         EE_ASSERT( nameLookupIter != m_entityNameLookupMap.end() );
@@ -265,6 +288,100 @@ namespace EE::EntityModel
         }
     }
 
+    void EntityMap::OnEntityComponentAdded( Entity* pEntity, EntityComponent* pComponent )
+    {
+        if ( pEntity->GetMapID() == m_ID )
+        {
+            Threading::RecursiveScopeLock lock( m_mutex );
+
+            // Entities that have been removed from the map but not yet unloaded will still have a valid map ID
+            if ( FindEntity( pEntity->GetID() ) != nullptr )
+            {
+                m_componentTypeRegistry.AddComponent( pComponent );
+            }
+        }
+    }
+
+    void EntityMap::OnEntityComponentDestroyed( Entity* pEntity, EntityComponent* pComponent )
+    {
+        if ( pEntity->GetMapID() == m_ID )
+        {
+            Threading::RecursiveScopeLock lock( m_mutex );
+
+            // Entities that have been removed from the map but not yet unloaded will still have a valid map ID
+            if ( FindEntity( pEntity->GetID() ) != nullptr )
+            {
+                m_componentTypeRegistry.RemoveComponent( pComponent );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Streaming
+    //-------------------------------------------------------------------------
+
+    void EntityMap::UpdateStreaming( LoadingContext const& loadingContext, TInlineVector<Vector, 4> const& streamingSourcePositions )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Map Streaming" );
+        EE_ASSERT( Threading::IsMainThread() && loadingContext.IsValid() );
+
+        Threading::RecursiveScopeLock lock( m_mutex );
+
+        if ( m_status != Status::Loaded || !IsStreamingEnabled() )
+        {
+            return;
+        }
+
+        // Only allow new cells to be loaded if we are within the initialization budget
+        MapStreamingSettings const& settings = m_pMapDesc->GetStreamingSettings();
+        int32_t const numLoadingEntities = (int32_t) ( m_entitiesCurrentlyLoading.size() + m_entitiesToLoad.size() );
+        int32_t const maxCellsToLoad = ( numLoadingEntities < settings.m_maxLoadingEntities ) ? settings.m_maxCellsToLoadPerFrame : 0;
+
+        TInlineVector<int32_t, 8> cellsToLoad;
+        TInlineVector<int32_t, 8> cellsToUnload;
+        m_cellStreamer.Update( streamingSourcePositions, maxCellsToLoad, cellsToLoad, cellsToUnload );
+
+        for ( int32_t cellIdx : cellsToUnload )
+        {
+            UnloadStreamingCell( cellIdx );
+        }
+
+        for ( int32_t cellIdx : cellsToLoad )
+        {
+            LoadStreamingCell( loadingContext, cellIdx );
+        }
+    }
+
+    void EntityMap::LoadStreamingCell( LoadingContext const& loadingContext, int32_t cellIdx )
+    {
+        EE_ASSERT( m_streamingCellEntities[cellIdx].empty() );
+
+        EntityCollection const& cellCollection = m_pMapDesc->GetStreamingCells()[cellIdx].m_entities;
+        TVector<Entity*> const createdEntities = cellCollection.CreateEntities( *loadingContext.m_pTypeRegistry, loadingContext.m_pTaskSystem );
+        AddEntities( createdEntities );
+
+        TVector<EntityID>& cellEntities = m_streamingCellEntities[cellIdx];
+        cellEntities.reserve( createdEntities.size() );
+        for ( auto pEntity : createdEntities )
+        {
+            cellEntities.emplace_back( pEntity->GetID() );
+        }
+    }
+
+    void EntityMap::UnloadStreamingCell( int32_t cellIdx )
+    {
+        // Cell entities might have already been destroyed by other code so only remove the ones that are still present
+        for ( EntityID const& entityID : m_streamingCellEntities[cellIdx] )
+        {
+            if ( FindEntity( entityID ) != nullptr )
+            {
+                DestroyEntity( entityID );
+            }
+        }
+
+        m_streamingCellEntities[cellIdx].clear();
+    }
+
     //-------------------------------------------------------------------------
     // Loading
     //-------------------------------------------------------------------------
@@ -335,6 +452,20 @@ namespace EE::EntityModel
                 AddEntity( pEntity );
             }
 
+            // Set up streaming, the cells will be loaded by the streaming update
+            if ( m_pMapDesc->IsPartitioned() )
+            {
+                TVector<Int2> cellCoords;
+                cellCoords.reserve( m_pMapDesc->GetStreamingCells().size() );
+                for ( auto const& cell : m_pMapDesc->GetStreamingCells() )
+                {
+                    cellCoords.emplace_back( cell.m_coords );
+                }
+
+                m_cellStreamer.Initialize( m_pMapDesc->GetStreamingSettings(), cellCoords );
+                m_streamingCellEntities.resize( cellCoords.size() );
+            }
+
             m_status = Status::Loaded;
         }
         else // Invalid map data is treated as a failed load
@@ -343,7 +474,11 @@ namespace EE::EntityModel
         }
 
         // Release map resource ptr once loading has completed
-        loadingContext.m_pResourceSystem->UnloadResource( m_pMapDesc );
+        // Partitioned maps need to keep the descriptor loaded since we instantiate the cells from it, it will be released when the map is unloaded
+        if ( !IsStreamingEnabled() )
+        {
+            loadingContext.m_pResourceSystem->UnloadResource( m_pMapDesc );
+        }
     }
 
     void EntityMap::Unload( LoadingContext const& loadingContext, InitializationContext& initializationContext )
@@ -434,6 +569,7 @@ namespace EE::EntityModel
 
         m_entities.clear();
         m_entityIDLookupMap.clear();
+        m_componentTypeRegistry.Clear();
          
         #if EE_DEVELOPMENT_TOOLS
         m_entityNameLookupMap.clear();
@@ -442,6 +578,12 @@ namespace EE::EntityModel
         // Unload the map resource
         //-------------------------------------------------------------------------
 
+        if ( IsStreamingEnabled() )
+        {
+            m_cellStreamer.Shutdown();
+            m_streamingCellEntities.clear();
+        }
+
         if ( !m_isTransientMap && m_pMapDesc.WasRequested() )
         {
             loadingContext.m_pResourceSystem->UnloadResource( m_pMapDesc );
@@ -616,6 +758,7 @@ namespace EE::EntityModel
                 EE_ASSERT( pEntity != nullptr && pEntity->m_updateRegistrationStatus == Entity::UpdateRegistrationStatus::QueuedForUnregister );
                 initializationContext.m_entityUpdateList.erase_first_unsorted( pEntity );
                 pEntity->m_updateRegistrationStatus = Entity::UpdateRegistrationStatus::Unregistered;
+                initializationContext.m_updateLayoutVersion.fetch_add( 1, std::memory_order_relaxed );
             }
 
             //-------------------------------------------------------------------------
@@ -628,6 +771,7 @@ namespace EE::EntityModel
                 EE_ASSERT( !pEntity->HasSpatialParent() ); // Attached entities are not allowed to be directly updated
                 initializationContext.m_entityUpdateList.push_back( pEntity );
                 pEntity->m_updateRegistrationStatus = Entity::UpdateRegistrationStatus::Registered;
+                initializationContext.m_updateLayoutVersion.fetch_add( 1, std::memory_order_relaxed );
             }
         }
 
@@ -735,12 +879,7 @@ namespace EE::EntityModel
                 pair.m_pComponent->m_isRegisteredWithWorld = false;
 
                 #if EE_DEVELOPMENT_TOOLS
-                EntityComponentTypeMap& componentTypeMap = *initializationContext.m_pComponentTypeMap;
-                auto const castableTypeIDs = initializationContext.m_pTypeRegistry->GetAllCastableTypes( pair.m_pComponent );
-                for ( auto castableTypeID : castableTypeIDs )
-                {
-                    componentTypeMap[castableTypeID].erase_first_unsorted( pair.m_pComponent );
-                }
+                initializationContext.m_pComponentTypeRegistry->RemoveComponent( pair.m_pComponent );
                 #endif
             }
 
@@ -750,12 +889,7 @@ namespace EE::EntityModel
                 pair.m_pComponent->m_isRegisteredWithWorld = true;
 
                 #if EE_DEVELOPMENT_TOOLS
-                EntityComponentTypeMap& componentTypeMap = *initializationContext.m_pComponentTypeMap;
-                auto const castableTypeIDs = initializationContext.m_pTypeRegistry->GetAllCastableTypes( pair.m_pComponent );
-                for ( auto castableTypeID : castableTypeIDs )
-                {
-                    componentTypeMap[castableTypeID].emplace_back( pair.m_pComponent );
-                }
+                initializationContext.m_pComponentTypeRegistry->AddComponent( pair.m_pComponent );
                 #endif
             }
         }
@@ -770,7 +904,7 @@ namespace EE::EntityModel
 
         #if EE_DEVELOPMENT_TOOLS
         EE_ASSERT( m_entitiesToHotReload.empty() );
-        EE_ASSERT( m_editedEntities.empty() ); // You are missing a EndComponentEdit call somewhere!
+        EE_ASSERT( m_editedEntities.empty() && m_editedComponents.empty() ); // You are missing a EndComponentEdit call somewhere!
         #endif
 
         //-------------------------------------------------------------------------
@@ -939,6 +1073,69 @@ namespace EE::EntityModel
         m_editedEntities.erase_first_unsorted( pEntity );
     }
 
+    void EntityMap::BeginComponentEdit( LoadingContext const& loadingContext, InitializationContext& initializationContext, EntityComponent* pComponent, bool unloadResources )
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+        EE_ASSERT( pComponent != nullptr );
+
+        auto pEntity = FindEntity( pComponent->GetEntityID() );
+        EE_ASSERT( pEntity != nullptr );
+        EE_ASSERT( !VectorContains( m_editedEntities, pEntity ) ); // The whole entity is already being edited!
+        EE_ASSERT( !VectorContains( m_editedComponents, pComponent ) ); // Starting multiple edits for the same component?!
+
+        // Unregister and shutdown only this component, the rest of the entity remains initialized
+        if ( pComponent->IsInitialized() )
+        {
+            if ( pComponent->m_isRegisteredWithEntity )
+            {
+                pEntity->UnregisterComponentFromLocalSystems( pComponent );
+            }
+
+            if ( pComponent->m_isRegisteredWithWorld )
+            {
+                initializationContext.m_componentsToUnregister.enqueue( EntityComponentPair( pEntity, pComponent ) );
+                ProcessEntityRegistrationRequests( initializationContext );
+            }
+
+            pComponent->Shutdown();
+        }
+
+        // Resources need to be released before the resource pointers are modified
+        if ( unloadResources && !pComponent->IsUnloaded() )
+        {
+            pComponent->Unload( loadingContext, Resource::ResourceRequesterID( pEntity->GetID().m_value ) );
+        }
+
+        m_editedComponents.emplace_back( pComponent );
+    }
+
+    void EntityMap::EndComponentEdit( LoadingContext const& loadingContext, InitializationContext& initializationContext, EntityComponent* pComponent )
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+        EE_ASSERT( pComponent != nullptr );
+        EE_ASSERT( VectorContains( m_editedComponents, pComponent ) ); // Cant end an edit that was never started!
+
+        auto pEntity = FindEntity( pComponent->GetEntityID() );
+        EE_ASSERT( pEntity != nullptr );
+
+        // If the entity hasnt requested its components to be loaded yet, the component will be loaded along with the rest of the entity
+        if ( pEntity->HasRequestedComponentLoad() )
+        {
+            if ( pComponent->IsUnloaded() )
+            {
+                pComponent->Load( loadingContext, Resource::ResourceRequesterID( pEntity->GetID().m_value ) );
+            }
+
+            // The entity state update will initialize the component and register it with the systems once it is loaded
+            if ( !VectorContains( m_entitiesCurrentlyLoading, pEntity ) )
+            {
+                m_entitiesCurrentlyLoading.emplace_back( pEntity );
+            }
+        }
+
+        m_editedComponents.erase_first_unsorted( pComponent );
+    }
+
     //-------------------------------------------------------------------------
 
     void EntityMap::HotReload_UnloadEntities( LoadingContext const& loadingContext, InitializationContext& initializationContext, TInlineVector<Resource::ResourceRequesterID, 20> const& usersToReload )
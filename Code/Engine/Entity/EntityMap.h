@@ -2,6 +2,7 @@
 
 #include "Engine/_Module/API.h"
 #include "EntityDescriptors.h"
+#include "EntityComponentTypeRegistry.h"
 #include "Base/Types/Event.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Resource/ResourcePtr.h"
@@ -85,6 +86,7 @@ namespace EE
 
             bool IsLoading() const { return m_status == Status::Loading; }
             inline bool IsLoaded() const { return m_status == Status::Loaded; }
+            inline bool IsUnloading() const { return m_status == Status::Unloading; }
             inline bool IsUnloaded() const { return m_status == Status::Unloaded; }
             inline bool HasLoadingFailed() const { return m_status == Status::LoadFailed; }
 
@@ -132,66 +134,89 @@ namespace EE
             void DestroyEntity( EntityID entityID );
 
             //-------------------------------------------------------------------------
-            // Tools API
+            // Streaming
             //-------------------------------------------------------------------------
 
-            #if EE_DEVELOPMENT_TOOLS
-            // Gets a unique entity name for this map given a specified desired name
-            StringID GenerateUniqueEntityNameID( StringID desiredNameID ) const;
+            // Is this a partitioned map that streams its cells in and out around the streaming sources
+            inline bool IsStreamingEnabled() const { return m_cellStreamer.IsInitialized(); }
 
-            // Gets a unique entity name for this map given a specified desired name
-            inline StringID GenerateUniqueEntityNameID( char const* pName ) const { return GenerateUniqueEntityNameID( StringID( pName ) ); }
+            inline int32_t GetNumStreamingCells() const { return m_cellStreamer.GetNumCells(); }
+            inline int32_t GetNumRequestedStreamingCells() const { return m_cellStreamer.GetNumRequestedCells(); }
 
-            // Rename an existing entity - allow renaming of existing entities, will ensure that the new name is unique
-            void RenameEntity( Entity* pEntity, StringID newNameID );
+            // Update which cells should be loaded for the supplied streaming source positions
+            // This will add/remove the cell entities to/from the map, the actual loading/unloading occurs in the regular loading update
+            void UpdateStreaming( LoadingContext const& loadingContext, TInlineVector<Vector, 4> const& streamingSourcePositions );
 
-            // Find an entity by name
-            inline Entity* FindEntityByName( StringID nameID ) const
-            {
-                auto iter = m_entityNameLookupMap.find( nameID );
-                return ( iter != m_entityNameLookupMap.end() ) ? iter->second : nullptr;
-            }
+            //-------------------------------------------------------------------------
+            // Component Queries
+            //-------------------------------------------------------------------------
 
-            // Get all components of a given type
-            // Note: this is extremely slow
+            // Get all components of (or derived from) a given type, this includes components on entities that are still loading
+            // Note: this is a lookup into the per-type component registry and is not synchronized with entity loading, so do not call it during the loading update
             template<typename T>
             void GetAllComponentsOfType( TInlineVector<T*, 20>& outComponents )
             {
-                for ( auto pEntity : m_entities )
+                TVector<EntityComponent const*> const* pComponents = m_componentTypeRegistry.GetComponentsOfType( T::GetStaticTypeID() );
+                if ( pComponents != nullptr )
                 {
-                    for ( auto pComponent : pEntity->GetComponents() )
+                    outComponents.reserve( outComponents.size() + pComponents->size() );
+                    for ( auto pComponent : *pComponents )
                     {
-                        if ( T* pTypedComponent = TryCast<T>( pComponent ) )
-                        {
-                            outComponents.emplace_back( pTypedComponent );
-                        }
+                        outComponents.emplace_back( const_cast<T*>( static_cast<T const*>( pComponent ) ) );
                     }
                 }
             }
 
-            // Get all components of a given type
-            // Note: this is extremely slow
+            // Get all components of (or derived from) a given type, this includes components on entities that are still loading
+            // Note: this is a lookup into the per-type component registry and is not synchronized with entity loading, so do not call it during the loading update
             template<typename T>
             void GetAllComponentsOfType( TInlineVector<T const*, 20>& outComponents ) const
             {
-                for ( auto pEntity : m_entities )
+                TVector<EntityComponent const*> const* pComponents = m_componentTypeRegistry.GetComponentsOfType( T::GetStaticTypeID() );
+                if ( pComponents != nullptr )
                 {
-                    for ( auto pComponent : pEntity->GetComponents() )
+                    outComponents.reserve( outComponents.size() + pComponents->size() );
+                    for ( auto pComponent : *pComponents )
                     {
-                        if ( T const* pTypedComponent = TryCast<T>( pComponent ) )
-                        {
-                            outComponents.emplace_back( pTypedComponent );
-                        }
+                        outComponents.emplace_back( static_cast<T const*>( pComponent ) );
                     }
                 }
             }
 
+            //-------------------------------------------------------------------------
+            // Tools API
+            //-------------------------------------------------------------------------
+
+            #if EE_DEVELOPMENT_TOOLS
+            // Gets a unique entity name for this map given a specified desired name
+            StringID GenerateUniqueEntityNameID( StringID desiredNameID ) const;
+
+            // Gets a unique entity name for this map given a specified desired name
+            inline StringID GenerateUniqueEntityNameID( char const* pName ) const { return GenerateUniqueEntityNameID( StringID( pName ) ); }
+
+            // Rename an existing entity - allow renaming of existing entities, will ensure that the new name is unique
+            void RenameEntity( Entity* pEntity, StringID newNameID );
+
+            // Find an entity by name
+            inline Entity* FindEntityByName( StringID nameID ) const
+            {
+                auto iter = m_entityNameLookupMap.find( nameID );
+                return ( iter != m_entityNameLookupMap.end() ) ? iter->second : nullptr;
+            }
+
             // This function will shutdown and unload the entity, allowing its components' properties to be edited safely!
             void BeginComponentEdit( LoadingContext const& loadingContext, InitializationContext& initializationContext, EntityID const& entityID );
 
             // Completes a component edit operation
             void EndComponentEdit( LoadingContext const& loadingContext, InitializationContext& initializationContext, EntityID const& entityID );
 
+            // This function will only shutdown the specified component, allowing its properties to be edited safely while the rest of the entity stays initialized
+            // The component's resources are only unloaded if requested, this is only needed if the edit could change any resource pointers
+            void BeginComponentEdit( LoadingContext const& loadingContext, InitializationContext& initializationContext, EntityComponent* pComponent, bool unloadResources );
+
+            // Completes a single component edit operation, the component will be reloaded (if needed) and reinitialized during the next loading update
+            void EndComponentEdit( LoadingContext const& loadingContext, InitializationContext& initializationContext, EntityComponent* pComponent );
+
             // Shutdown and unload all entities that are affected by the hot-reload
             void HotReload_UnloadEntities( LoadingContext const& loadingContext, InitializationContext& initializationContext, TInlineVector<Resource::ResourceRequesterID, 20> const& usersToReload );
 
@@ -204,6 +229,10 @@ namespace EE
             // Called whenever the internal state of an entity changes, schedules the entity for loading
             void OnEntityStateUpdated( Entity* pEntity );
 
+            // Called whenever a component is added to/destroyed from an entity, keeps the component type registry up to date
+            void OnEntityComponentAdded( Entity* pEntity, EntityComponent* pComponent );
+            void OnEntityComponentDestroyed( Entity* pEntity, EntityComponent* pComponent );
+
             void ProcessMapLoading( LoadingContext const& loadingContext );
             void ProcessMapUnloading( LoadingContext const& loadingContext, InitializationContext& initializationContext );
             void ProcessEntityRegistrationRequests( InitializationContext& initializationContext );
@@ -214,6 +243,10 @@ namespace EE
             // Remove entity
             Entity* RemoveEntityInternal( EntityID entityID, bool destroyEntityOnceRemoved );
 
+            // Streaming
+            void LoadStreamingCell( LoadingContext const& loadingContext, int32_t cellIdx );
+            void UnloadStreamingCell( int32_t cellIdx );
+
         private:
 
             EntityMapID                                 m_ID = EntityMapID::GenerateID(); // ID is always regenerated at creation time, do not rely on the ID being the same for a map on different runs
@@ -221,10 +254,15 @@ namespace EE
             TResourcePtr<EntityMapDescriptor>           m_pMapDesc;
             TVector<Entity*>                            m_entities;
             THashMap<EntityID, Entity*>                 m_entityIDLookupMap;
+            ComponentTypeRegistry                       m_componentTypeRegistry;
             TVector<Entity*>                            m_entitiesCurrentlyLoading;
             TInlineVector<Entity*, 5>                   m_entitiesToLoad;
             TInlineVector<RemovalRequest, 5>            m_entitiesToRemove;
             EventBindingID                              m_entityUpdateEventBindingID;
+            EventBindingID                              m_componentAddedEventBindingID;
+            EventBindingID                              m_componentDestroyedEventBindingID;
+            CellStreamer                                m_cellStreamer;
+            TVector<TVector<EntityID>>                  m_streamingCellEntities; // The entities that we created for each loaded streaming cell
             Status                                      m_status = Status::Unloaded;
             bool const                                  m_isTransientMap = false; // If this is set, then this is a transient map i.e.created and managed at runtime and not loaded from disk
 
@@ -232,6 +270,7 @@ namespace EE
             THashMap<StringID, Entity*>                 m_entityNameLookupMap; // All entities that have attempted to load
             TVector<Entity*>                            m_entitiesToHotReload;
             TVector<Entity*>                            m_editedEntities;
+            TVector<EntityComponent*>                   m_editedComponents;
             #endif
         };
     }
@@ -0,0 +1,98 @@
+#include "EntityMapStreaming.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    void CellStreamer::Initialize( MapStreamingSettings const& settings, TVector<Int2> const& cellCoords )
+    {
+        EE_ASSERT( settings.IsValid() );
+        m_settings = settings;
+        m_cellCoords = cellCoords;
+        m_isCellRequested.resize( m_cellCoords.size(), false );
+        m_numRequestedCells = 0;
+    }
+
+    void CellStreamer::Shutdown()
+    {
+        m_settings = MapStreamingSettings();
+        m_cellCoords.clear();
+        m_isCellRequested.clear();
+        m_numRequestedCells = 0;
+    }
+
+    float CellStreamer::GetDistanceToCell( int32_t cellIdx, Vector const& position ) const
+    {
+        EE_ASSERT( cellIdx >= 0 && cellIdx < GetNumCells() );
+
+        Float3 const point = position.ToFloat3();
+        float const minX = m_cellCoords[cellIdx].m_x * m_settings.m_cellSize;
+        float const minY = m_cellCoords[cellIdx].m_y * m_settings.m_cellSize;
+        float const deltaX = Math::Max( Math::Max( minX - point.m_x, point.m_x - ( minX + m_settings.m_cellSize ) ), 0.0f );
+        float const deltaY = Math::Max( Math::Max( minY - point.m_y, point.m_y - ( minY + m_settings.m_cellSize ) ), 0.0f );
+        return Math::Sqrt( ( deltaX * deltaX ) + ( deltaY * deltaY ) );
+    }
+
+    void CellStreamer::Update( TInlineVector<Vector, 4> const& sourcePositions, int32_t maxCellsToLoad, TInlineVector<int32_t, 8>& outCellsToLoad, TInlineVector<int32_t, 8>& outCellsToUnload )
+    {
+        EE_ASSERT( IsInitialized() );
+        EE_ASSERT( maxCellsToLoad >= 0 );
+
+        outCellsToLoad.clear();
+        outCellsToUnload.clear();
+
+        struct LoadCandidate
+        {
+            int32_t     m_cellIdx;
+            float       m_distance;
+        };
+
+        TInlineVector<LoadCandidate, 16> loadCandidates;
+
+        //-------------------------------------------------------------------------
+
+        int32_t const numCells = GetNumCells();
+        for ( int32_t i = 0; i < numCells; i++ )
+        {
+            float closestDistance = FLT_MAX;
+            for ( Vector const& sourcePosition : sourcePositions )
+            {
+                closestDistance = Math::Min( closestDistance, GetDistanceToCell( i, sourcePosition ) );
+            }
+
+            if ( m_isCellRequested[i] )
+            {
+                if ( closestDistance > m_settings.m_unloadRadius )
+                {
+                    m_isCellRequested[i] = false;
+                    m_numRequestedCells--;
+                    outCellsToUnload.emplace_back( i );
+                }
+            }
+            else if ( closestDistance <= m_settings.m_loadRadius )
+            {
+                loadCandidates.push_back( { i, closestDistance } );
+            }
+        }
+
+        // Request the closest cells first
+        //-------------------------------------------------------------------------
+
+        auto SortComparator = [] ( LoadCandidate const& a, LoadCandidate const& b )
+        {
+            return ( a.m_distance != b.m_distance ) ? a.m_distance < b.m_distance : a.m_cellIdx < b.m_cellIdx;
+        };
+
+        eastl::sort( loadCandidates.begin(), loadCandidates.end(), SortComparator );
+
+        int32_t const numCellsToLoad = Math::Min( (int32_t) loadCandidates.size(), maxCellsToLoad );
+        for ( int32_t i = 0; i < numCellsToLoad; i++ )
+        {
+            int32_t const cellIdx = loadCandidates[i].m_cellIdx;
+            m_isCellRequested[cellIdx] = true;
+            m_numRequestedCells++;
+            outCellsToLoad.emplace_back( cellIdx );
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Math/Vector.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Serialization/BinarySerialization.h"
+
+//-------------------------------------------------------------------------
+// Entity Map Streaming
+//-------------------------------------------------------------------------
+// Partitioned maps split their spatial entities into a 2D grid of cells (on the XY plane) at compile time
+// At runtime, cells are streamed in and out around a set of streaming sources (i.e. camera/player positions)
+//
+// To prevent cells from thrashing when a source sits on a boundary, we use two radii: cells are requested once they are
+// within the load radius of any source and are only released once they are further than the unload radius from all sources
+
+namespace EE::EntityModel
+{
+    struct EE_ENGINE_API MapStreamingSettings
+    {
+        EE_SERIALIZE( m_cellSize, m_loadRadius, m_unloadRadius, m_maxCellsToLoadPerFrame, m_maxLoadingEntities );
+
+    public:
+
+        inline bool IsValid() const
+        {
+            return m_cellSize > 0.0f && m_loadRadius >= 0.0f && m_unloadRadius >= m_loadRadius && m_maxCellsToLoadPerFrame > 0 && m_maxLoadingEntities > 0;
+        }
+
+    public:
+
+        float                                   m_cellSize = 0.0f;              // The size of each (square) cell, a size of zero means that the map is not partitioned
+        float                                   m_loadRadius = 0.0f;            // Cells within this distance of any streaming source will be loaded
+        float                                   m_unloadRadius = 0.0f;          // Loaded cells are unloaded once they are further than this distance from all streaming sources
+        int32_t                                 m_maxCellsToLoadPerFrame = 1;   // Load budget: the maximum number of cells that we will instantiate in a single frame
+        int32_t                                 m_maxLoadingEntities = 256;     // Initialization budget: we will not start loading new cells while more than this number of entities are still loading/initializing
+    };
+
+    //-------------------------------------------------------------------------
+    // Cell Streamer
+    //-------------------------------------------------------------------------
+    // Decides which cells should be loaded, this has no dependencies on the map or world so it can be driven with synthetic data
+    // Note: this is linear in the number of cells and sources
+
+    class EE_ENGINE_API CellStreamer
+    {
+    public:
+
+        void Initialize( MapStreamingSettings const& settings, TVector<Int2> const& cellCoords );
+        void Shutdown();
+
+        inline bool IsInitialized() const { return m_settings.IsValid(); }
+
+        inline int32_t GetNumCells() const { return (int32_t) m_cellCoords.size(); }
+        inline bool IsCellRequested( int32_t cellIdx ) const { return m_isCellRequested[cellIdx]; }
+        inline int32_t GetNumRequestedCells() const { return m_numRequestedCells; }
+
+        // Get the distance on the XY plane from a point to a cell
+        float GetDistanceToCell( int32_t cellIdx, Vector const& position ) const;
+
+        // Update the set of requested cells
+        // Newly requested cells are returned nearest first and will be limited to the supplied number of cells, released cells are not limited
+        void Update( TInlineVector<Vector, 4> const& sourcePositions, int32_t maxCellsToLoad, TInlineVector<int32_t, 8>& outCellsToLoad, TInlineVector<int32_t, 8>& outCellsToUnload );
+
+    private:
+
+        MapStreamingSettings                    m_settings;
+        TVector<Int2>                           m_cellCoords;
+        TVector<bool>                           m_isCellRequested;
+        int32_t                                 m_numRequestedCells = 0;
+    };
+}
@@ -3,6 +3,7 @@
 #include "Engine/_Module/API.h"
 #include "Engine/UpdateStage.h"
 #include "Base/TypeSystem/ReflectedType.h"
+#include <EASTL/span.h>
 
 //-------------------------------------------------------------------------
 
@@ -19,6 +20,7 @@ namespace EE
         EE_REFLECT_TYPE( EntitySystem );
 
         friend class Entity;
+        friend class EntityWorld;
 
     public:
 
@@ -54,6 +56,17 @@ namespace EE
 
         // System Update
         virtual void Update( EntityWorldUpdateContext const& ctx ) = 0;
+
+        // Batched system update, called on the first system of a batch of instances of this system type (each belonging to a different entity)
+        // Override this to process all the instances' components in a single loop, the default simply updates each instance in turn
+        virtual void UpdateBatch( EntityWorldUpdateContext const& ctx, eastl::span<EntitySystem* const> systems )
+        {
+            for ( EntitySystem* pSystem : systems )
+            {
+                EE_ASSERT( pSystem->GetTypeInfo() == GetTypeInfo() );
+                pSystem->Update( ctx );
+            }
+        }
     };
 }
 
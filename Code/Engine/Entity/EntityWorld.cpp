@@ -1,9 +1,12 @@
 #include "EntityWorld.h"
 #include "EntityWorldUpdateContext.h"
 #include "EntityWorldSettings.h"
+#include "EntitySystem.h"
 #include "Base/Resource/ResourceSystem.h"
 #include "Base/Profiling.h"
 #include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/TypeSystem/TypeDescriptors.h"
+#include "Base/Time/Timers.h"
 #include <eastl/sort.h>
 
 //-------------------------------------------------------------------------
@@ -13,6 +16,7 @@ namespace EE
     EntityWorld::EntityWorld( EntityWorldType worldType )
         : m_initializationContext( m_worldSystems, m_entityUpdateList )
         , m_worldType( worldType )
+        , m_allowConcurrentUpdates( worldType != EntityWorldType::Game )
     {}
 
     EntityWorld::~EntityWorld()
@@ -29,10 +33,7 @@ namespace EE
         //-------------------------------------------------------------------------
 
         #if EE_DEVELOPMENT_TOOLS
-        for ( auto& v : m_componentTypeLookup )
-        {
-            EE_ASSERT( v.second.empty() );
-        }
+        EE_ASSERT( m_componentTypeLookup.IsEmpty() );
         #endif
     }
 
@@ -53,7 +54,7 @@ namespace EE
         const_cast<TypeSystem::TypeRegistry const*&>( m_initializationContext.m_pTypeRegistry ) = m_loadingContext.m_pTypeRegistry;
         
         #if EE_DEVELOPMENT_TOOLS
-        m_initializationContext.SetComponentTypeMapPtr( &m_componentTypeLookup );
+        m_initializationContext.SetComponentTypeRegistryPtr( &m_componentTypeLookup );
         #endif
 
         EE_ASSERT( m_initializationContext.IsValid() );
@@ -89,6 +90,8 @@ namespace EE
             }
         }
 
+        BuildSystemUpdateBatches();
+
         // Create World Settings
         //-------------------------------------------------------------------------
 
@@ -160,12 +163,167 @@ namespace EE
 
         m_worldSystems.clear();
 
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            m_systemUpdateBatches[i].clear();
+            m_entitySystemUpdateLists[i].clear();
+            m_entitySystemUpdatePasses[i].clear();
+        }
+
+        m_entityChainUpdateList.clear();
+        m_unattachedEntityUpdateList.clear();
+        m_entityUpdateLayoutVersion = 0xFFFFFFFF;
+
         //-------------------------------------------------------------------------
 
         m_pTaskSystem = nullptr;
         m_initialized = false;
     }
 
+    void EntityWorld::BuildSystemUpdateBatches()
+    {
+        TypeSystem::TypeRegistry const& typeRegistry = *m_loadingContext.m_pTypeRegistry;
+
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            UpdateStage const stage = (UpdateStage) i;
+            TVector<EntityWorldSystem*>& updateList = m_systemUpdateLists[i];
+            int32_t const numSystems = (int32_t) updateList.size();
+
+            // Get the declared data accesses, a system always writes its own state
+            //-------------------------------------------------------------------------
+
+            TVector<WorldSystemDataAccess> dataAccesses;
+            dataAccesses.resize( numSystems );
+
+            for ( int32_t s = 0; s < numSystems; s++ )
+            {
+                dataAccesses[s].m_isDeclared = updateList[s]->GetDataAccess( stage, dataAccesses[s] );
+                dataAccesses[s].WritesResource( updateList[s]->GetSystemID() );
+
+                #if EE_DEVELOPMENT_TOOLS
+                EE_ASSERT( !dataAccesses[s].IsDeclared() || dataAccesses[s].IsValid( typeRegistry ) );
+                #endif
+            }
+
+            // Place each system in the batch after the last batch containing a higher priority system that it conflicts with
+            //-------------------------------------------------------------------------
+            // The update list is already sorted by priority so this maintains the priority order between all conflicting systems
+
+            TVector<int32_t> systemBatchIndices;
+            systemBatchIndices.resize( numSystems, 0 );
+
+            int32_t numBatches = 0;
+            for ( int32_t s = 0; s < numSystems; s++ )
+            {
+                for ( int32_t p = 0; p < s; p++ )
+                {
+                    if ( dataAccesses[s].ConflictsWith( typeRegistry, dataAccesses[p] ) )
+                    {
+                        systemBatchIndices[s] = Math::Max( systemBatchIndices[s], systemBatchIndices[p] + 1 );
+                    }
+                }
+
+                numBatches = Math::Max( numBatches, systemBatchIndices[s] + 1 );
+            }
+
+            // Reorder the update list by batch, keeping the priority order within each batch
+            //-------------------------------------------------------------------------
+
+            TVector<EntityWorldSystem*> sortedUpdateList;
+            sortedUpdateList.reserve( numSystems );
+
+            m_systemUpdateBatches[i].clear();
+            for ( int32_t b = 0; b < numBatches; b++ )
+            {
+                for ( int32_t s = 0; s < numSystems; s++ )
+                {
+                    if ( systemBatchIndices[s] == b )
+                    {
+                        sortedUpdateList.emplace_back( updateList[s] );
+                    }
+                }
+
+                m_systemUpdateBatches[i].emplace_back( (int32_t) sortedUpdateList.size() );
+            }
+
+            updateList.swap( sortedUpdateList );
+        }
+    }
+
+    void EntityWorld::BuildEntitySystemUpdateBatches()
+    {
+        EE_PROFILE_FUNCTION_ENTITY();
+
+        m_entityUpdateLayoutVersion = m_initializationContext.m_updateLayoutVersion.load( std::memory_order_relaxed );
+
+        // Split the entities into spatial chains and individually updated entities
+        //-------------------------------------------------------------------------
+        // Chains need their parents updated before their children so they are always updated recursively, per entity
+
+        TVector<Entity*>& unattachedEntities = m_unattachedEntityUpdateList;
+        unattachedEntities.clear();
+        m_entityChainUpdateList.clear();
+
+        for ( Entity* pEntity : m_entityUpdateList )
+        {
+            // Ignore any entities with spatial parents, these will be updated by their parents
+            if ( pEntity->HasSpatialParent() )
+            {
+                continue;
+            }
+
+            if ( pEntity->HasAttachedEntities() )
+            {
+                m_entityChainUpdateList.emplace_back( pEntity );
+            }
+            else
+            {
+                unattachedEntities.emplace_back( pEntity );
+            }
+        }
+
+        // Group the systems into passes, the Nth pass contains the Nth system (in update order) of every entity
+        //-------------------------------------------------------------------------
+        // Each entity's systems are in a different pass so an entity's update order is maintained
+        // Within a pass, systems are sorted by type so that each type can be updated as a single batch
+
+        auto SortByType = [] ( EntitySystem const* pA, EntitySystem const* pB )
+        {
+            return pA->GetTypeInfo() < pB->GetTypeInfo();
+        };
+
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            UpdateStage const stage = (UpdateStage) i;
+            TVector<EntitySystem*>& updateList = m_entitySystemUpdateLists[i];
+            updateList.clear();
+            m_entitySystemUpdatePasses[i].clear();
+
+            int32_t numPasses = 0;
+            for ( Entity* pEntity : unattachedEntities )
+            {
+                numPasses = Math::Max( numPasses, (int32_t) pEntity->GetSystemUpdateList( stage ).size() );
+            }
+
+            for ( int32_t p = 0; p < numPasses; p++ )
+            {
+                int32_t const passStartIdx = (int32_t) updateList.size();
+                for ( Entity* pEntity : unattachedEntities )
+                {
+                    auto const& entitySystems = pEntity->GetSystemUpdateList( stage );
+                    if ( p < (int32_t) entitySystems.size() )
+                    {
+                        updateList.emplace_back( entitySystems[p] );
+                    }
+                }
+
+                eastl::sort( updateList.begin() + passStartIdx, updateList.end(), SortByType );
+                m_entitySystemUpdatePasses[i].emplace_back( (int32_t) updateList.size() );
+            }
+        }
+    }
+
     //-------------------------------------------------------------------------
     // Misc
     //-------------------------------------------------------------------------
@@ -191,6 +349,25 @@ namespace EE
     void EntityWorld::UpdateLoading()
     {
         EE_PROFILE_SCOPE_ENTITY( "World Loading" );
+        EE_MEMORY_TAG_SCOPE( Entity );
+
+        // Update map streaming
+        //-------------------------------------------------------------------------
+        // This needs to occur before the loading update so that any cell entities added are immediately processed
+
+        TInlineVector<Vector, 4> streamingSourcePositions = m_streamingSourcePositions;
+        if ( streamingSourcePositions.empty() )
+        {
+            streamingSourcePositions.emplace_back( m_viewport.GetViewPosition() );
+        }
+
+        for ( auto pMap : m_maps )
+        {
+            if ( pMap->IsStreamingEnabled() )
+            {
+                pMap->UpdateStreaming( m_loadingContext, streamingSourcePositions );
+            }
+        }
 
         // Update all maps internal loading state
         //-------------------------------------------------------------------------
@@ -212,7 +389,7 @@ namespace EE
 
     void EntityWorld::Update( UpdateContext const& context )
     {
-        EE_ASSERT( Threading::IsMainThread() );
+        EE_ASSERT( Threading::IsMainThread() || m_allowConcurrentUpdates );
         EE_ASSERT( !m_isSuspended );
 
         struct EntityUpdateTask final : public ITaskSet
@@ -292,21 +469,138 @@ namespace EE
         // Update entities
         //-------------------------------------------------------------------------
 
-        EntityUpdateTask entityUpdateTask( entityWorldUpdateContext, m_entityUpdateList );
-        m_pTaskSystem->ScheduleTask( &entityUpdateTask );
-        m_pTaskSystem->WaitForTask( &entityUpdateTask );
+        bool useBatchedEntitySystemUpdates = true;
+
+        #if EE_DEVELOPMENT_TOOLS
+        useBatchedEntitySystemUpdates = m_batchedEntitySystemUpdatesEnabled;
+        #endif
+
+        if ( useBatchedEntitySystemUpdates )
+        {
+            if ( m_entityUpdateLayoutVersion != m_initializationContext.m_updateLayoutVersion.load( std::memory_order_relaxed ) )
+            {
+                BuildEntitySystemUpdateBatches();
+            }
+
+            // Spatial chains are updated per entity, concurrently with the batched updates of all other entities
+            EntityUpdateTask entityChainUpdateTask( entityWorldUpdateContext, m_entityChainUpdateList );
+            if ( m_isDeterministicUpdateEnabled )
+            {
+                entityChainUpdateTask.ExecuteRange( { 0u, (uint32_t) m_entityChainUpdateList.size() }, 0 );
+            }
+            else
+            {
+                m_pTaskSystem->ScheduleTask( &entityChainUpdateTask );
+            }
+
+            // Update each pass in turn, runs of the same system type within a task range are updated as a single batch
+            TVector<EntitySystem*> const& updateList = m_entitySystemUpdateLists[(int8_t) updateStage];
+
+            int32_t passStartIdx = 0;
+            for ( int32_t const passEndIdx : m_entitySystemUpdatePasses[(int8_t) updateStage] )
+            {
+                AsyncTask passUpdateTask( (uint32_t) ( passEndIdx - passStartIdx ), [&] ( TaskSetPartition range, uint32_t threadnum )
+                {
+                    uint32_t batchStartIdx = passStartIdx + range.start;
+                    uint32_t const rangeEndIdx = passStartIdx + range.end;
+                    while ( batchStartIdx < rangeEndIdx )
+                    {
+                        EntitySystem* pBatchSystem = updateList[batchStartIdx];
+                        TypeSystem::TypeInfo const* pBatchTypeInfo = pBatchSystem->GetTypeInfo();
+
+                        uint32_t batchEndIdx = batchStartIdx + 1;
+                        while ( batchEndIdx < rangeEndIdx && updateList[batchEndIdx]->GetTypeInfo() == pBatchTypeInfo )
+                        {
+                            batchEndIdx++;
+                        }
+
+                        EE_PROFILE_SCOPE_ENTITY( "Update Entity System Batch" );
+                        EE_ASSERT( pBatchSystem->GetRequiredUpdatePriorities().IsStageEnabled( updateStage ) );
+                        pBatchSystem->UpdateBatch( entityWorldUpdateContext, eastl::span<EntitySystem* const>( updateList.data() + batchStartIdx, batchEndIdx - batchStartIdx ) );
+                        batchStartIdx = batchEndIdx;
+                    }
+                } );
+
+                if ( m_isDeterministicUpdateEnabled )
+                {
+                    passUpdateTask.ExecuteRange( { 0u, (uint32_t) ( passEndIdx - passStartIdx ) }, 0 );
+                }
+                else
+                {
+                    m_pTaskSystem->ScheduleTask( &passUpdateTask );
+                    m_pTaskSystem->WaitForTask( &passUpdateTask );
+                }
+                passStartIdx = passEndIdx;
+            }
 
-        // Force execution on main thread for debugging purposes
-        //entityUpdateTask.ExecuteRange( { 0u, (uint32_t) m_entityUpdateList.size() }, 0 );
+            if ( !m_isDeterministicUpdateEnabled )
+            {
+                m_pTaskSystem->WaitForTask( &entityChainUpdateTask );
+            }
+        }
+        else
+        {
+            EntityUpdateTask entityUpdateTask( entityWorldUpdateContext, m_entityUpdateList );
+            if ( m_isDeterministicUpdateEnabled )
+            {
+                entityUpdateTask.ExecuteRange( { 0u, (uint32_t) m_entityUpdateList.size() }, 0 );
+            }
+            else
+            {
+                m_pTaskSystem->ScheduleTask( &entityUpdateTask );
+                m_pTaskSystem->WaitForTask( &entityUpdateTask );
+            }
+        }
 
         // Update systems
         //-------------------------------------------------------------------------
+        // Systems are updated in batches, the systems within a batch have no conflicting data accesses so are updated concurrently
 
-        for ( auto pSystem : m_systemUpdateLists[(int8_t) updateStage] )
         {
             EE_PROFILE_SCOPE_ENTITY( "Update World Systems" );
-            EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( updateStage ) );
-            pSystem->UpdateSystem( entityWorldUpdateContext );
+            ScopedTimer<PlatformClock> updateTimer( m_systemUpdateTimes[(int8_t) updateStage] );
+
+            TVector<EntityWorldSystem*> const& updateList = m_systemUpdateLists[(int8_t) updateStage];
+
+            auto UpdateWorldSystem = [&entityWorldUpdateContext, updateStage] ( EntityWorldSystem* pSystem )
+            {
+                EE_PROFILE_SCOPE_ENTITY( "Update World System" );
+                EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( updateStage ) );
+                pSystem->UpdateSystem( entityWorldUpdateContext );
+            };
+
+            int32_t batchStartIdx = 0;
+            for ( int32_t const batchEndIdx : m_systemUpdateBatches[(int8_t) updateStage] )
+            {
+                bool updateSequentially = ( batchEndIdx - batchStartIdx ) == 1 || m_isDeterministicUpdateEnabled;
+
+                #if EE_DEVELOPMENT_TOOLS
+                updateSequentially |= !m_parallelSystemUpdatesEnabled;
+                #endif
+
+                if ( updateSequentially )
+                {
+                    for ( int32_t i = batchStartIdx; i < batchEndIdx; i++ )
+                    {
+                        UpdateWorldSystem( updateList[i] );
+                    }
+                }
+                else
+                {
+                    AsyncTask batchUpdateTask( (uint32_t) ( batchEndIdx - batchStartIdx ), [&] ( TaskSetPartition range, uint32_t threadnum )
+                    {
+                        for ( uint32_t i = range.start; i < range.end; i++ )
+                        {
+                            UpdateWorldSystem( updateList[batchStartIdx + i] );
+                        }
+                    } );
+
+                    m_pTaskSystem->ScheduleTask( &batchUpdateTask );
+                    m_pTaskSystem->WaitForTask( &batchUpdateTask );
+                }
+
+                batchStartIdx = batchEndIdx;
+            }
         }
 
         //-------------------------------------------------------------------------
@@ -431,6 +725,7 @@ namespace EE
         EE_ASSERT( !HasMap( mapResourceID ) );
         auto pNewMap = m_maps.emplace_back( EE::New<EntityModel::EntityMap>( mapResourceID ) );
         pNewMap->Load( m_loadingContext, m_initializationContext );
+        m_mapRequestedEvent.Execute( mapResourceID, true );
         return pNewMap->GetID();
     }
 
@@ -441,6 +736,7 @@ namespace EE
         auto const foundMapIter = VectorFind( m_maps, mapResourceID, [] ( EntityModel::EntityMap const* pMap, ResourceID const& mapResourceID ) { return pMap->GetMapResourceID() == mapResourceID; } );
         EE_ASSERT( foundMapIter != m_maps.end() );
         ( *foundMapIter )->Unload( m_loadingContext, m_initializationContext );
+        m_mapRequestedEvent.Execute( mapResourceID, false );
     }
 
     //-------------------------------------------------------------------------
@@ -467,7 +763,7 @@ namespace EE
         pMap->EndComponentEdit( m_loadingContext, m_initializationContext, pEntity->GetID() );
     }
 
-    void EntityWorld::BeginComponentEdit( EntityComponent* pComponent )
+    void EntityWorld::BeginComponentEdit( EntityComponent* pComponent, bool unloadResources )
     {
         EE_ASSERT( pComponent != nullptr );
 
@@ -476,7 +772,7 @@ namespace EE
 
         auto pMap = GetMap( pEntity->GetMapID() );
         EE_ASSERT( pMap != nullptr );
-        pMap->BeginComponentEdit( m_loadingContext, m_initializationContext, pEntity->GetID() );
+        pMap->BeginComponentEdit( m_loadingContext, m_initializationContext, pComponent, unloadResources );
     }
 
     void EntityWorld::EndComponentEdit( EntityComponent* pComponent )
@@ -488,7 +784,47 @@ namespace EE
 
         auto pMap = GetMap( pEntity->GetMapID() );
         EE_ASSERT( pMap != nullptr );
-        pMap->EndComponentEdit( m_loadingContext, m_initializationContext, pEntity->GetID() );
+        pMap->EndComponentEdit( m_loadingContext, m_initializationContext, pComponent );
+    }
+
+    void EntityWorld::ApplyComponentPatch( EntityComponent* pComponent, TypeSystem::TypeDescriptor const& patch )
+    {
+        EE_ASSERT( pComponent != nullptr );
+        EE_ASSERT( patch.IsValid() && patch.m_typeID == pComponent->GetTypeID() );
+
+        TypeSystem::TypeRegistry const& typeRegistry = *m_loadingContext.m_pTypeRegistry;
+        TypeSystem::TypeInfo const* pComponentTypeInfo = pComponent->GetTypeInfo();
+
+        bool unloadResources = false;
+        for ( auto const& propertyDesc : patch.m_properties )
+        {
+            if ( DoesPropertyEditRequireResourceReload( typeRegistry.ResolvePropertyPath( pComponentTypeInfo, propertyDesc.m_path ) ) )
+            {
+                unloadResources = true;
+                break;
+            }
+        }
+
+        BeginComponentEdit( pComponent, unloadResources );
+        patch.ApplyPropertyValues( typeRegistry, pComponent );
+        EndComponentEdit( pComponent );
+    }
+
+    bool EntityWorld::DoesPropertyEditRequireResourceReload( TypeSystem::PropertyInfo const* pPropertyInfo )
+    {
+        // Unknown edits (e.g. type instance changes) could change anything
+        if ( pPropertyInfo == nullptr )
+        {
+            return true;
+        }
+
+        if ( pPropertyInfo->IsResourcePtrProperty() )
+        {
+            return true;
+        }
+
+        // Structures and type instances could contain resource pointers, core types (other than resource pointers) and enums cannot
+        return !pPropertyInfo->IsEnumProperty() && !TypeSystem::IsCoreType( pPropertyInfo->m_typeID );
     }
 
     //-------------------------------------------------------------------------
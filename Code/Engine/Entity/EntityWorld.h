@@ -19,6 +19,7 @@ namespace EE
     class DebugView;
 
     namespace Settings { class SettingsRegistry; }
+    namespace TypeSystem { class TypeDescriptor; class PropertyInfo; }
 
     //-------------------------------------------------------------------------
 
@@ -56,6 +57,10 @@ namespace EE
         // Run entity and system updates
         void Update( UpdateContext const& context );
 
+        // Can this world be updated on a worker thread concurrently with other worlds? The game world is always updated on the main thread.
+        inline bool AllowsConcurrentUpdates() const { return m_allowConcurrentUpdates; }
+        inline void SetAllowConcurrentUpdates( bool allowConcurrentUpdates ) { EE_ASSERT( !allowConcurrentUpdates || !IsGameWorld() ); m_allowConcurrentUpdates = allowConcurrentUpdates; }
+
         // This function will handle all actual loading/unloading operations for the world/maps.
         // Any queued requests will be handled here as will any requests to the resource system.
         void UpdateLoading();
@@ -69,6 +74,27 @@ namespace EE
         template<typename T>
         inline T* GetWorldSystem() const { return reinterpret_cast<T*>( GetWorldSystem( T::s_entitySystemID ) ); }
 
+        // Get the time taken by the last update of all world systems for the specified stage
+        inline Milliseconds GetWorldSystemsUpdateTime( UpdateStage stage ) const { return m_systemUpdateTimes[(int8_t) stage]; }
+
+        // Get the number of sequential batches the world systems for a stage are updated in, all systems within a batch are updated concurrently
+        inline int32_t GetNumWorldSystemUpdateBatches( UpdateStage stage ) const { return (int32_t) m_systemUpdateBatches[(int8_t) stage].size(); }
+
+        // Deterministic updates run all entity and world system updates sequentially on the calling thread, in a fixed order
+        // Needed for session capture/replay, since shared state (i.e. the global random generator) is otherwise consumed in thread scheduling order
+        inline bool IsDeterministicUpdateEnabled() const { return m_isDeterministicUpdateEnabled; }
+        inline void SetDeterministicUpdateEnabled( bool isEnabled ) { m_isDeterministicUpdateEnabled = isEnabled; }
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Disabling this will update all world systems sequentially on the main thread, useful for tracking down threading issues
+        inline bool AreParallelWorldSystemUpdatesEnabled() const { return m_parallelSystemUpdatesEnabled; }
+        inline void SetParallelWorldSystemUpdatesEnabled( bool isEnabled ) { m_parallelSystemUpdatesEnabled = isEnabled; }
+
+        // Disabling this will update each entity's systems individually rather than in batches of the same system type, useful for comparing the two paths
+        inline bool AreBatchedEntitySystemUpdatesEnabled() const { return m_batchedEntitySystemUpdatesEnabled; }
+        inline void SetBatchedEntitySystemUpdatesEnabled( bool isEnabled ) { m_batchedEntitySystemUpdatesEnabled = isEnabled; }
+        #endif
+
         //-------------------------------------------------------------------------
         // Settings
         //-------------------------------------------------------------------------
@@ -172,6 +198,11 @@ namespace EE
         // Do we have a map with this ID?
         bool HasMap( EntityMapID const& mapID ) const;
 
+        // Set the positions around which partitioned maps will stream in their cells, if no sources are set, the viewport position is used
+        inline void SetStreamingSources( TInlineVector<Vector, 4> const& sourcePositions ) { m_streamingSourcePositions = sourcePositions; }
+        inline void ClearStreamingSources() { m_streamingSourcePositions.clear(); }
+        inline TInlineVector<Vector, 4> const& GetStreamingSources() const { return m_streamingSourcePositions; }
+
         // Does the specified map exist and is fully loaded
         bool IsMapLoaded( ResourceID const& mapResourceID ) const;
 
@@ -182,6 +213,9 @@ namespace EE
         EntityMapID LoadMap( ResourceID const& mapResourceID );
         void UnloadMap( ResourceID const& mapResourceID );
 
+        // Fired whenever a map load (true) or unload (false) is requested for this world
+        inline TEventHandle<ResourceID const&, bool> OnMapRequested() { return m_mapRequestedEvent; }
+
         // Find an entity in the map
         inline Entity* FindEntity( EntityID entityID ) const
         {
@@ -198,6 +232,19 @@ namespace EE
             return pEntity;
         }
 
+        // Get all components of (or derived from) the specified type across all maps, this includes components that are still loading
+        // Note: this uses each map's component type registry so is proportional to the number of results, do not call this during the loading update
+        template<typename T>
+        inline TInlineVector<T const*, 20> GetAllComponentsOfType() const
+        {
+            TInlineVector<T const*, 20> results;
+            for ( EntityModel::EntityMap const* pMap : m_maps )
+            {
+                pMap->GetAllComponentsOfType<T>( results );
+            }
+            return results;
+        }
+
         //-------------------------------------------------------------------------
         // Editor
         //-------------------------------------------------------------------------
@@ -209,24 +256,26 @@ namespace EE
         // End a bulk component edit operation, will request all components to be reloaded
         void EndComponentEdit( Entity* pEntity );
 
-        // This function will immediately shutdown and unload the specified component so that its properties can be edited
+        // This function will immediately shutdown the specified component (and unload its resources if requested) so that its properties can be edited
+        // The rest of the entity is left untouched, only unload the resources if the edit could change any resource pointers
         // Note:  do not call this multiple times in a row, if you need to modify multiple components on the same entity use the functions above
-        void BeginComponentEdit( EntityComponent* pComponent );
+        void BeginComponentEdit( EntityComponent* pComponent, bool unloadResources = true );
 
-        // End a component edit operation, will request the unloaded component to be reloaded
+        // End a component edit operation, will request the component to be reloaded (if needed) and reinitialized
         void EndComponentEdit( EntityComponent* pComponent );
 
+        // Apply a set of property values to a live component, only the patched component is shutdown and reinitialized
+        // The component's resources are only reloaded if the patch contains any properties that could change resource pointers
+        void ApplyComponentPatch( EntityComponent* pComponent, TypeSystem::TypeDescriptor const& patch );
+
+        // Could an edit of the specified property change any resource pointers (i.e. does the owning component need to reload its resources)
+        static bool DoesPropertyEditRequireResourceReload( TypeSystem::PropertyInfo const* pPropertyInfo );
+
         // Get all the registered components of the specified type
         // Note: this will only find components that have successfully initialized
         inline TVector<EntityComponent const*> const* GetAllRegisteredComponentsOfType( TypeSystem::TypeID typeID ) const 
         {
-            auto iter = m_componentTypeLookup.find( typeID );
-            if ( iter == m_componentTypeLookup.end() )
-            {
-                return nullptr;
-            }
-
-            return &iter->second;
+            return m_componentTypeLookup.GetComponentsOfType( typeID );
         }
 
         // Get all the registered components of the specified type
@@ -246,17 +295,6 @@ namespace EE
             return results;
         }
 
-        template<typename T>
-        inline TInlineVector<T const*, 20> GetAllComponentsOfType() const
-        {
-            TInlineVector<T const*, 20> results;
-            for ( EntityModel::EntityMap const* pMap : m_maps )
-            {
-                pMap->GetAllComponentsOfType<T>( results );
-            }
-            return results;
-        }
-
         // Are any maps currently in the process of loading or have any add/remove entity actions pending
         inline bool HasPendingMapChangeActions() const
         {
@@ -311,6 +349,14 @@ namespace EE
         void HotReload_ReloadEntities( TInlineVector<Resource::ResourceRequesterID, 20> const& usersToReload );
         #endif
 
+    private:
+
+        // Split the world systems for each stage into batches of systems with no conflicting data accesses
+        void BuildSystemUpdateBatches();
+
+        // Group the entity systems of all unattached entities by update pass and system type, so that each system type can be updated in a single batch
+        void BuildEntitySystemUpdateBatches();
+
     private:
 
         EntityWorldID                                                           m_worldID = EntityWorldID::Generate();
@@ -322,24 +368,37 @@ namespace EE
         EntityWorldType                                                         m_worldType = EntityWorldType::Game;
         bool                                                                    m_initialized = false;
         bool                                                                    m_isSuspended = false;
+        bool                                                                    m_allowConcurrentUpdates = false;
         Render::Viewport                                                        m_viewport = Render::Viewport( Int2::Zero, Int2( 640, 480 ), Math::ViewVolume( Float2( 640, 480 ), FloatRange( 0.1f, 100.0f ) ) );
 
         // Maps
         TInlineVector<EntityModel::EntityMap*, 3>                               m_maps;
+        TInlineVector<Vector, 4>                                                m_streamingSourcePositions;
+        TEvent<ResourceID const&, bool>                                         m_mapRequestedEvent;
 
         // Entities
         TVector<Entity*>                                                        m_entityUpdateList;
-        TVector<EntityWorldSystem*>                                             m_systemUpdateLists[(int8_t) UpdateStage::NumStages];
+        TVector<Entity*>                                                        m_entityChainUpdateList; // Entities with attached entities, these are updated recursively
+        TVector<Entity*>                                                        m_unattachedEntityUpdateList; // Scratch list used when building the batched entity system updates
+        TVector<EntitySystem*>                                                  m_entitySystemUpdateLists[(int8_t) UpdateStage::NumStages]; // Sorted by pass and then by system type
+        TVector<int32_t>                                                        m_entitySystemUpdatePasses[(int8_t) UpdateStage::NumStages]; // The end index (in the update list) of each pass
+        uint32_t                                                                m_entityUpdateLayoutVersion = 0xFFFFFFFF;
+        TVector<EntityWorldSystem*>                                             m_systemUpdateLists[(int8_t) UpdateStage::NumStages]; // Sorted by batch and then by priority
+        TVector<int32_t>                                                        m_systemUpdateBatches[(int8_t) UpdateStage::NumStages]; // The end index (in the update list) of each batch
+        Milliseconds                                                            m_systemUpdateTimes[(int8_t) UpdateStage::NumStages];
 
         // Time Scaling + Pause
         float                                                                   m_timeScale = 1.0f; // <= 0 means that the world is paused
         Seconds                                                                 m_timeStepLength = 1.0f / 30.0f;
         bool                                                                    m_timeStepRequested = false;
+        bool                                                                    m_isDeterministicUpdateEnabled = false;
 
         #if EE_DEVELOPMENT_TOOLS
-        EntityModel::EntityComponentTypeMap                                     m_componentTypeLookup;
+        EntityModel::ComponentTypeRegistry                                      m_componentTypeLookup;
         Drawing::DrawingSystem                                                  m_debugDrawingSystem;
         String                                                                  m_debugName;
+        bool                                                                    m_parallelSystemUpdatesEnabled = true;
+        bool                                                                    m_batchedEntitySystemUpdatesEnabled = true;
         #endif
     };
 }
\ No newline at end of file
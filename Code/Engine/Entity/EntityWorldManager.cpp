@@ -6,12 +6,52 @@
 #include "Engine/Camera/Components/Component_Camera.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Engine/UpdateContext.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Time/Timers.h"
+#include "Base/Profiling.h"
 #include "Base/Systems.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    static void UpdateWorldAndView( EntityWorld* pWorld, UpdateContext const& context )
+    {
+        // Run world updates
+        //-------------------------------------------------------------------------
+
+        pWorld->Update( context );
+
+        // Update world view
+        //-------------------------------------------------------------------------
+
+        if ( pWorld->GetViewport() != nullptr )
+        {
+            auto pViewport = pWorld->GetViewport();
+            auto pCameraManager = pWorld->GetWorldSystem<CameraManager>();
+            if ( pCameraManager->HasActiveCamera() )
+            {
+                auto pActiveCamera = pCameraManager->GetActiveCamera();
+
+                // Update camera view dimensions if they differ (needed when we resize the viewport even if the camera hasn't updated)
+                if ( pViewport->GetDimensions() != pActiveCamera->GetViewVolume().GetViewDimensions() )
+                {
+                    pActiveCamera->UpdateViewDimensions( pViewport->GetDimensions() );
+                    pViewport->SetViewVolume( pActiveCamera->GetViewVolume() );
+                }
+
+                // Update world view volume only if camera has been updated
+                if ( pActiveCamera->ShouldReflectViewVolume() )
+                {
+                    Math::ViewVolume const& cameraViewVolume = pActiveCamera->ReflectViewVolume();
+                    pViewport->SetViewVolume( cameraViewVolume );
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     EntityWorldManager::~EntityWorldManager()
     {
         EE_ASSERT( m_worlds.empty() && m_worldSystemTypeInfos.empty() );
@@ -20,6 +60,8 @@ namespace EE
     void EntityWorldManager::Initialize( SystemRegistry const& systemsRegistry )
     {
         m_pSystemsRegistry = &systemsRegistry;
+        m_pTaskSystem = systemsRegistry.GetSystem<TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
 
         //-------------------------------------------------------------------------
 
@@ -45,6 +87,7 @@ namespace EE
         //-------------------------------------------------------------------------
 
         m_worldSystemTypeInfos.clear();
+        m_pTaskSystem = nullptr;
         m_pSystemsRegistry = nullptr;
     }
 
@@ -100,6 +143,7 @@ namespace EE
 
         auto pNewWorld = EE::New<EntityWorld>( worldType );
         pNewWorld->Initialize( *m_pSystemsRegistry, m_worldSystemTypeInfos );
+        pNewWorld->SetDeterministicUpdateEnabled( m_isDeterministicUpdateEnabled );
         m_worlds.emplace_back( pNewWorld );
 
         //-------------------------------------------------------------------------
@@ -155,49 +199,82 @@ namespace EE
         }
     }
 
+    void EntityWorldManager::SetDeterministicUpdateEnabled( bool isEnabled )
+    {
+        m_isDeterministicUpdateEnabled = isEnabled;
+        for ( auto pWorld : m_worlds )
+        {
+            pWorld->SetDeterministicUpdateEnabled( isEnabled );
+        }
+    }
+
     void EntityWorldManager::UpdateWorlds( UpdateContext const& context )
     {
+        EE_ASSERT( Threading::IsMainThread() );
+
         //-------------------------------------------------------------------------
         // World Update
         //-------------------------------------------------------------------------
+        // Worlds are completely independent of each other, so all worlds that allow it are updated concurrently on the task system
+        // The remaining worlds are updated on the main thread while the concurrent updates are running
 
-        for ( auto const& pWorld : m_worlds )
         {
-            if ( pWorld->IsSuspended() )
+            EE_PROFILE_SCOPE_ENTITY( "Update Worlds" );
+            ScopedTimer<PlatformClock> updateTimer( m_worldUpdateTimes[(int8_t) context.GetUpdateStage()] );
+
+            m_concurrentUpdateWorlds.clear();
+
+            bool concurrentUpdatesEnabled = !m_isDeterministicUpdateEnabled;
+            #if EE_DEVELOPMENT_TOOLS
+            concurrentUpdatesEnabled &= m_concurrentWorldUpdatesEnabled;
+            #endif
+
+            if ( concurrentUpdatesEnabled )
             {
-                continue;
+                for ( auto const& pWorld : m_worlds )
+                {
+                    if ( !pWorld->IsSuspended() && pWorld->AllowsConcurrentUpdates() )
+                    {
+                        m_concurrentUpdateWorlds.emplace_back( pWorld );
+                    }
+                }
             }
 
-            // Run world updates
-            //-------------------------------------------------------------------------
+            // Only use the task system if there is more than one world to update
+            bool const useTaskSystem = !m_concurrentUpdateWorlds.empty() && m_worlds.size() > 1;
 
-            pWorld->Update( context );
+            AsyncTask worldUpdateTask( (uint32_t) m_concurrentUpdateWorlds.size(), [this, &context] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    EE_PROFILE_SCOPE_ENTITY( "Update World" );
+                    UpdateWorldAndView( m_concurrentUpdateWorlds[i], context );
+                }
+            } );
 
-            // Update world view
-            //-------------------------------------------------------------------------
+            if ( useTaskSystem )
+            {
+                m_pTaskSystem->ScheduleTask( &worldUpdateTask );
+            }
 
-            if ( pWorld->GetViewport() != nullptr )
+            for ( auto const& pWorld : m_worlds )
             {
-                auto pViewport = pWorld->GetViewport();
-                auto pCameraManager = pWorld->GetWorldSystem<CameraManager>();
-                if ( pCameraManager->HasActiveCamera() )
+                if ( pWorld->IsSuspended() )
                 {
-                    auto pActiveCamera = pCameraManager->GetActiveCamera();
-
-                    // Update camera view dimensions if they differ (needed when we resize the viewport even if the camera hasn't updated)
-                    if ( pViewport->GetDimensions() != pActiveCamera->GetViewVolume().GetViewDimensions() )
-                    {
-                        pActiveCamera->UpdateViewDimensions( pViewport->GetDimensions() );
-                        pViewport->SetViewVolume( pActiveCamera->GetViewVolume() );
-                    }
+                    continue;
+                }
 
-                    // Update world view volume only if camera has been updated
-                    if ( pActiveCamera->ShouldReflectViewVolume() )
-                    {
-                        Math::ViewVolume const& cameraViewVolume = pActiveCamera->ReflectViewVolume();
-                        pViewport->SetViewVolume( cameraViewVolume );
-                    }
+                if ( useTaskSystem && VectorContains( m_concurrentUpdateWorlds, pWorld ) )
+                {
+                    continue;
                 }
+
+                UpdateWorldAndView( pWorld, context );
+            }
+
+            if ( useTaskSystem )
+            {
+                m_pTaskSystem->WaitForTask( &worldUpdateTask );
             }
         }
 
@@ -2,7 +2,9 @@
 
 #include "Engine/_Module/API.h"
 #include "EntityWorldType.h"
+#include "Engine/UpdateStage.h"
 #include "Base/Resource/ResourceRequesterID.h"
+#include "Base/Time/Time.h"
 #include "Base/Systems.h"
 
 //-------------------------------------------------------------------------
@@ -12,6 +14,7 @@ namespace EE
     class UpdateContext;
     class EntityWorld;
     class SystemRegistry;
+    class TaskSystem;
     namespace TypeSystem { class TypeInfo; }
     namespace Render { class Viewport; }
 
@@ -65,8 +68,22 @@ namespace EE
         TInlineVector<EntityWorld*, 5> const& GetWorlds() const { return m_worlds; }
 
         // Run the world update - updates all entities, systems and camera
+        // Worlds that allow concurrent updates are updated on the task system while the remaining worlds are updated on the main thread
         void UpdateWorlds( UpdateContext const& context );
 
+        // Get the time taken by the last update of all worlds for the specified stage
+        inline Milliseconds GetWorldsUpdateTime( UpdateStage stage ) const { return m_worldUpdateTimes[(int8_t) stage]; }
+
+        // Update all worlds (and their entities and systems) sequentially on the main thread in a fixed order, see 'EntityWorld::SetDeterministicUpdateEnabled'
+        inline bool IsDeterministicUpdateEnabled() const { return m_isDeterministicUpdateEnabled; }
+        void SetDeterministicUpdateEnabled( bool isEnabled );
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Disabling this will update all worlds sequentially on the main thread, useful for tracking down threading issues
+        inline bool AreConcurrentWorldUpdatesEnabled() const { return m_concurrentWorldUpdatesEnabled; }
+        inline void SetConcurrentWorldUpdatesEnabled( bool isEnabled ) { m_concurrentWorldUpdatesEnabled = isEnabled; }
+        #endif
+
         // Hot Reload
         //-------------------------------------------------------------------------
 
@@ -78,7 +95,15 @@ namespace EE
     private:
 
         SystemRegistry const*                               m_pSystemsRegistry = nullptr;
+        TaskSystem*                                         m_pTaskSystem = nullptr;
         TInlineVector<EntityWorld*, 5>                      m_worlds;
         TVector<TypeSystem::TypeInfo const*>                m_worldSystemTypeInfos;
+        TInlineVector<EntityWorld*, 5>                      m_concurrentUpdateWorlds;
+        Milliseconds                                        m_worldUpdateTimes[(int8_t) UpdateStage::NumStages];
+        bool                                                m_isDeterministicUpdateEnabled = false;
+
+        #if EE_DEVELOPMENT_TOOLS
+        bool                                                m_concurrentWorldUpdatesEnabled = true;
+        #endif
     };
 }
\ No newline at end of file
@@ -1,10 +1,87 @@
 #include "EntityWorldSystem.h"
 #include "EntityWorld.h"
+#include "EntityComponent.h"
+#include "Base/TypeSystem/TypeRegistry.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    static bool DoComponentTypesOverlap( TypeSystem::TypeRegistry const& typeRegistry, TypeSystem::TypeID typeA, TypeSystem::TypeID typeB )
+    {
+        return typeA == typeB || typeRegistry.IsTypeDerivedFrom( typeA, typeB ) || typeRegistry.IsTypeDerivedFrom( typeB, typeA );
+    }
+
+    template<typename T, typename F>
+    static bool DoAnyOverlap( T const& listA, T const& listB, F&& overlapFunction )
+    {
+        for ( auto const& a : listA )
+        {
+            for ( auto const& b : listB )
+            {
+                if ( overlapFunction( a, b ) )
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    bool WorldSystemDataAccess::ConflictsWith( TypeSystem::TypeRegistry const& typeRegistry, WorldSystemDataAccess const& other ) const
+    {
+        if ( !m_isDeclared || !other.m_isDeclared )
+        {
+            return true;
+        }
+
+        // Components - a write conflicts with any read or write of the same (or a derived/parent) type
+        //-------------------------------------------------------------------------
+
+        auto ComponentOverlap = [&typeRegistry] ( TypeSystem::TypeID a, TypeSystem::TypeID b ) { return DoComponentTypesOverlap( typeRegistry, a, b ); };
+
+        if ( DoAnyOverlap( m_componentWrites, other.m_componentWrites, ComponentOverlap ) || DoAnyOverlap( m_componentWrites, other.m_componentReads, ComponentOverlap ) || DoAnyOverlap( m_componentReads, other.m_componentWrites, ComponentOverlap ) )
+        {
+            return true;
+        }
+
+        // Resources
+        //-------------------------------------------------------------------------
+
+        auto ResourceOverlap = [] ( uint32_t a, uint32_t b ) { return a == b; };
+
+        if ( DoAnyOverlap( m_resourceWrites, other.m_resourceWrites, ResourceOverlap ) || DoAnyOverlap( m_resourceWrites, other.m_resourceReads, ResourceOverlap ) || DoAnyOverlap( m_resourceReads, other.m_resourceWrites, ResourceOverlap ) )
+        {
+            return true;
+        }
+
+        return false;
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    bool WorldSystemDataAccess::IsValid( TypeSystem::TypeRegistry const& typeRegistry ) const
+    {
+        auto AreValidComponentTypes = [&typeRegistry] ( TInlineVector<TypeSystem::TypeID, 4> const& typeIDs )
+        {
+            for ( auto typeID : typeIDs )
+            {
+                auto pTypeInfo = typeRegistry.GetTypeInfo( typeID );
+                if ( pTypeInfo == nullptr || !pTypeInfo->IsDerivedFrom<EntityComponent>() )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        };
+
+        return AreValidComponentTypes( m_componentReads ) && AreValidComponentTypes( m_componentWrites );
+    }
+    #endif
+
+    //-------------------------------------------------------------------------
+
     bool EntityWorldSystem::IsInAGameWorld() const
     {
         return m_pWorld->GetWorldType() == EntityWorldType::Game;
@@ -21,6 +21,55 @@ namespace EE
     class Entity;
     class EntityComponent;
     namespace EntityModel { class EntityMap; }
+    namespace TypeSystem { class TypeRegistry; }
+
+    //-------------------------------------------------------------------------
+    // World System Data Access
+    //-------------------------------------------------------------------------
+    // Declares the shared data that a world system reads/writes during a specific update stage
+    // Shared data is either a component type (this includes all derived types) or a world resource (e.g. the persistent map or another world system)
+    // World systems whose accesses don't overlap will be updated concurrently, a world system's own state is always considered to be written
+
+    class EE_ENGINE_API WorldSystemDataAccess
+    {
+        friend class EntityWorld;
+
+    public:
+
+        // Common world resources, any world system can also be used as a resource via its system ID
+        constexpr static uint32_t const s_persistentMapResourceID = Hash::FNV1a::GetHash32( "PersistentMap" );
+        constexpr static uint32_t const s_viewportResourceID = Hash::FNV1a::GetHash32( "Viewport" );
+
+    public:
+
+        template<typename T> inline WorldSystemDataAccess& ReadsComponent() { m_componentReads.emplace_back( T::GetStaticTypeID() ); return *this; }
+        template<typename T> inline WorldSystemDataAccess& WritesComponent() { m_componentWrites.emplace_back( T::GetStaticTypeID() ); return *this; }
+
+        template<typename T> inline WorldSystemDataAccess& ReadsWorldSystem() { return ReadsResource( T::s_entitySystemID ); }
+        template<typename T> inline WorldSystemDataAccess& WritesWorldSystem() { return WritesResource( T::s_entitySystemID ); }
+
+        inline WorldSystemDataAccess& ReadsResource( uint32_t resourceID ) { m_resourceReads.emplace_back( resourceID ); return *this; }
+        inline WorldSystemDataAccess& WritesResource( uint32_t resourceID ) { m_resourceWrites.emplace_back( resourceID ); return *this; }
+
+        // Systems that haven't declared their data access are assumed to read and write everything
+        inline bool IsDeclared() const { return m_isDeclared; }
+
+        // Can two systems with these accesses not be updated at the same time?
+        bool ConflictsWith( TypeSystem::TypeRegistry const& typeRegistry, WorldSystemDataAccess const& other ) const;
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Ensure that all the declared component types are valid
+        bool IsValid( TypeSystem::TypeRegistry const& typeRegistry ) const;
+        #endif
+
+    private:
+
+        TInlineVector<TypeSystem::TypeID, 4>        m_componentReads;
+        TInlineVector<TypeSystem::TypeID, 4>        m_componentWrites;
+        TInlineVector<uint32_t, 4>                  m_resourceReads;
+        TInlineVector<uint32_t, 4>                  m_resourceWrites;
+        bool                                        m_isDeclared = false;
+    };
 
     //-------------------------------------------------------------------------
 
@@ -46,6 +95,9 @@ namespace EE
         // Get the required update stages and priorities for this component
         virtual UpdatePriorityList const& GetRequiredUpdatePriorities() = 0;
 
+        // Declare the shared data accessed when updating the specified stage, return false if the accesses are unknown (the system will then never be updated concurrently)
+        virtual bool GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const { return false; }
+
         // Called when the system is registered with the world - using explicit "EntitySystem" name to allow for a standalone initialize function
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) {};
 
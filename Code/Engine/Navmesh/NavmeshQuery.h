@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Math/Vector.h"
+
+//-------------------------------------------------------------------------
+// Navmesh Queries
+//-------------------------------------------------------------------------
+// Queries are executed in batches by the navmesh world system, see NavmeshWorldSystem::FindNearestPoints etc...
+// The actual queries are performed by a query provider, this allows us to swap out the navmesh backend (i.e. for headless testing)
+
+namespace EE::Navmesh
+{
+    // Find the closest point on the navmesh to the specified position
+    struct NearestPointQuery
+    {
+        Vector          m_position;
+        Vector          m_searchExtents = Vector( 2.0f, 2.0f, 2.0f, 0.0f );
+    };
+
+    // Check whether we can move in a straight line along the navmesh from the start to the end position
+    struct RaycastQuery
+    {
+        Vector          m_start;
+        Vector          m_end;
+    };
+
+    // Find a random point on the navmesh within the specified radius that is reachable from the origin
+    struct RandomPointQuery
+    {
+        Vector          m_origin;
+        float           m_radius = 10.0f;
+        uint32_t        m_seed = 0;             // Results are deterministic for a given seed
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct PointQueryResult
+    {
+        inline bool IsValid() const { return m_isValid; }
+
+        Vector          m_position = Vector::Zero;
+        bool            m_isValid = false;
+    };
+
+    struct RaycastResult
+    {
+        inline bool HasHit() const { return m_hasHit; }
+
+        Vector          m_hitPosition = Vector::Zero;   // The furthest point we could reach along the ray
+        bool            m_hasHit = false;
+    };
+
+    //-------------------------------------------------------------------------
+    // Query Provider
+    //-------------------------------------------------------------------------
+    // Batches are only split across the worker threads if the provider states that its queries are threadsafe
+
+    class EE_ENGINE_API NavmeshQueryProvider
+    {
+    public:
+
+        virtual ~NavmeshQueryProvider() = default;
+
+        // Can the queries be executed from multiple threads at once, if not then batches are executed serially on the calling thread
+        virtual bool SupportsConcurrentQueries() const { return false; }
+
+        virtual PointQueryResult FindNearestPoint( NearestPointQuery const& query ) const = 0;
+        virtual RaycastResult Raycast( RaycastQuery const& query ) const = 0;
+        virtual PointQueryResult FindRandomReachablePoint( RandomPointQuery const& query ) const = 0;
+    };
+}
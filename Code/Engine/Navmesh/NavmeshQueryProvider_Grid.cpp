@@ -0,0 +1,255 @@
+#include "NavmeshQueryProvider_Grid.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Math/MathConstants.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Navmesh
+{
+    GridNavmeshQueryProvider::GridNavmeshQueryProvider( Float3 const& origin, float cellSize, int32_t numCellsX, int32_t numCellsY )
+        : m_origin( origin )
+        , m_cellSize( cellSize )
+        , m_numCellsX( numCellsX )
+        , m_numCellsY( numCellsY )
+    {
+        EE_ASSERT( cellSize > 0.0f && numCellsX > 0 && numCellsY > 0 );
+
+        int32_t const numCells = numCellsX * numCellsY;
+        m_heights.resize( numCells, origin.m_z );
+        m_isWalkable.resize( numCells, false );
+        m_regionIDs.resize( numCells, InvalidIndex );
+    }
+
+    void GridNavmeshQueryProvider::SetCellWalkable( int32_t cellX, int32_t cellY, bool isWalkable, float height )
+    {
+        int32_t const cellIdx = GetCellIndex( cellX, cellY );
+        m_isWalkable[cellIdx] = isWalkable;
+        m_heights[cellIdx] = height;
+    }
+
+    void GridNavmeshQueryProvider::UpdateConnectivity()
+    {
+        int32_t const numCells = m_numCellsX * m_numCellsY;
+        for ( int32_t i = 0; i < numCells; i++ )
+        {
+            m_regionIDs[i] = InvalidIndex;
+        }
+
+        // Flood fill each unvisited walkable cell, connectivity is only via the 4 direct neighbours
+        //-------------------------------------------------------------------------
+
+        int32_t const neighbourOffsets[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+
+        TVector<int32_t> openCells;
+        int32_t numRegions = 0;
+
+        for ( int32_t i = 0; i < numCells; i++ )
+        {
+            if ( !m_isWalkable[i] || m_regionIDs[i] != InvalidIndex )
+            {
+                continue;
+            }
+
+            int32_t const regionID = numRegions++;
+            m_regionIDs[i] = regionID;
+            openCells.emplace_back( i );
+
+            while ( !openCells.empty() )
+            {
+                int32_t const cellIdx = openCells.back();
+                openCells.pop_back();
+
+                int32_t const cellX = cellIdx % m_numCellsX;
+                int32_t const cellY = cellIdx / m_numCellsX;
+
+                for ( auto const& offset : neighbourOffsets )
+                {
+                    int32_t const neighbourX = cellX + offset[0];
+                    int32_t const neighbourY = cellY + offset[1];
+                    if ( !IsValidCell( neighbourX, neighbourY ) )
+                    {
+                        continue;
+                    }
+
+                    int32_t const neighbourIdx = GetCellIndex( neighbourX, neighbourY );
+                    if ( m_isWalkable[neighbourIdx] && m_regionIDs[neighbourIdx] == InvalidIndex )
+                    {
+                        m_regionIDs[neighbourIdx] = regionID;
+                        openCells.emplace_back( neighbourIdx );
+                    }
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    PointQueryResult GridNavmeshQueryProvider::FindNearestPoint( NearestPointQuery const& query ) const
+    {
+        PointQueryResult result;
+
+        Float3 const position = query.m_position.ToFloat3();
+        Float3 const extents = query.m_searchExtents.ToFloat3();
+
+        int32_t const minCellX = Math::Max( GetCellX( position.m_x - extents.m_x ), 0 );
+        int32_t const maxCellX = Math::Min( GetCellX( position.m_x + extents.m_x ), m_numCellsX - 1 );
+        int32_t const minCellY = Math::Max( GetCellY( position.m_y - extents.m_y ), 0 );
+        int32_t const maxCellY = Math::Min( GetCellY( position.m_y + extents.m_y ), m_numCellsY - 1 );
+
+        float closestDistanceSq = FLT_MAX;
+        for ( int32_t cellY = minCellY; cellY <= maxCellY; cellY++ )
+        {
+            for ( int32_t cellX = minCellX; cellX <= maxCellX; cellX++ )
+            {
+                int32_t const cellIdx = GetCellIndex( cellX, cellY );
+                if ( !m_isWalkable[cellIdx] )
+                {
+                    continue;
+                }
+
+                float const cellHeight = m_heights[cellIdx];
+                if ( Math::Abs( cellHeight - position.m_z ) > extents.m_z )
+                {
+                    continue;
+                }
+
+                // Clamp the query position onto the cell
+                float const cellMinX = m_origin.m_x + cellX * m_cellSize;
+                float const cellMinY = m_origin.m_y + cellY * m_cellSize;
+                Float3 const closestPoint( Math::Clamp( position.m_x, cellMinX, cellMinX + m_cellSize ), Math::Clamp( position.m_y, cellMinY, cellMinY + m_cellSize ), cellHeight );
+
+                float const distanceSq = Math::Sqr( closestPoint.m_x - position.m_x ) + Math::Sqr( closestPoint.m_y - position.m_y ) + Math::Sqr( closestPoint.m_z - position.m_z );
+                if ( distanceSq < closestDistanceSq )
+                {
+                    closestDistanceSq = distanceSq;
+                    result.m_position = Vector( closestPoint );
+                    result.m_isValid = true;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    RaycastResult GridNavmeshQueryProvider::Raycast( RaycastQuery const& query ) const
+    {
+        RaycastResult result;
+
+        Float3 const start = query.m_start.ToFloat3();
+        Float3 const end = query.m_end.ToFloat3();
+
+        int32_t cellX = GetCellX( start.m_x );
+        int32_t cellY = GetCellY( start.m_y );
+        if ( !IsCellWalkable( cellX, cellY ) )
+        {
+            result.m_hitPosition = query.m_start;
+            result.m_hasHit = true;
+            return result;
+        }
+
+        // Walk the grid cells along the ray (DDA)
+        //-------------------------------------------------------------------------
+
+        float const deltaX = end.m_x - start.m_x;
+        float const deltaY = end.m_y - start.m_y;
+        int32_t const endCellX = GetCellX( end.m_x );
+        int32_t const endCellY = GetCellY( end.m_y );
+        int32_t const stepX = ( deltaX > 0.0f ) ? 1 : -1;
+        int32_t const stepY = ( deltaY > 0.0f ) ? 1 : -1;
+
+        // The ray parameter 't' at which we cross the next cell boundary in each axis and the 't' needed to cross a whole cell
+        float const tDeltaX = ( deltaX != 0.0f ) ? Math::Abs( m_cellSize / deltaX ) : FLT_MAX;
+        float const tDeltaY = ( deltaY != 0.0f ) ? Math::Abs( m_cellSize / deltaY ) : FLT_MAX;
+        float const nextBoundaryX = m_origin.m_x + ( cellX + ( stepX > 0 ? 1 : 0 ) ) * m_cellSize;
+        float const nextBoundaryY = m_origin.m_y + ( cellY + ( stepY > 0 ? 1 : 0 ) ) * m_cellSize;
+        float tMaxX = ( deltaX != 0.0f ) ? ( nextBoundaryX - start.m_x ) / deltaX : FLT_MAX;
+        float tMaxY = ( deltaY != 0.0f ) ? ( nextBoundaryY - start.m_y ) / deltaY : FLT_MAX;
+
+        int32_t lastWalkableCellIdx = GetCellIndex( cellX, cellY );
+        while ( cellX != endCellX || cellY != endCellY )
+        {
+            float t;
+            if ( tMaxX < tMaxY )
+            {
+                t = tMaxX;
+                tMaxX += tDeltaX;
+                cellX += stepX;
+            }
+            else
+            {
+                t = tMaxY;
+                tMaxY += tDeltaY;
+                cellY += stepY;
+            }
+
+            // Guard against floating point drift past the end of the ray
+            if ( t > 1.0f )
+            {
+                break;
+            }
+
+            if ( !IsCellWalkable( cellX, cellY ) )
+            {
+                result.m_hitPosition = Vector( start.m_x + deltaX * t, start.m_y + deltaY * t, m_heights[lastWalkableCellIdx] );
+                result.m_hasHit = true;
+                return result;
+            }
+
+            lastWalkableCellIdx = GetCellIndex( cellX, cellY );
+        }
+
+        result.m_hitPosition = Vector( end.m_x, end.m_y, m_heights[lastWalkableCellIdx] );
+        return result;
+    }
+
+    PointQueryResult GridNavmeshQueryProvider::FindRandomReachablePoint( RandomPointQuery const& query ) const
+    {
+        PointQueryResult result;
+
+        // Find the region we start in
+        //-------------------------------------------------------------------------
+
+        NearestPointQuery startQuery;
+        startQuery.m_position = query.m_origin;
+        startQuery.m_searchExtents = Vector( m_cellSize, m_cellSize, m_cellSize, 0.0f );
+
+        PointQueryResult const startPoint = FindNearestPoint( startQuery );
+        if ( !startPoint.IsValid() )
+        {
+            return result;
+        }
+
+        Float3 const origin = startPoint.m_position.ToFloat3();
+        int32_t const startRegionID = m_regionIDs[GetCellIndex( GetCellX( origin.m_x ), GetCellY( origin.m_y ) )];
+        EE_ASSERT( startRegionID != InvalidIndex );
+
+        // Sample the disc around the origin until we find a cell in the same region
+        //-------------------------------------------------------------------------
+
+        Math::RNG rng( query.m_seed );
+        for ( int32_t i = 0; i < s_maxRandomPointAttempts; i++ )
+        {
+            float const distance = query.m_radius * Math::Sqrt( rng.GetFloat() );
+            float const angle = rng.GetFloat( 0.0f, Math::TwoPi );
+            float const x = origin.m_x + distance * Math::Cos( angle );
+            float const y = origin.m_y + distance * Math::Sin( angle );
+
+            int32_t const cellX = GetCellX( x );
+            int32_t const cellY = GetCellY( y );
+            if ( !IsValidCell( cellX, cellY ) )
+            {
+                continue;
+            }
+
+            int32_t const cellIdx = GetCellIndex( cellX, cellY );
+            if ( m_regionIDs[cellIdx] == startRegionID )
+            {
+                result.m_position = Vector( x, y, m_heights[cellIdx] );
+                result.m_isValid = true;
+                break;
+            }
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Engine/Navmesh/NavmeshQuery.h"
+#include "Base/Math/Math.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Grid Navmesh Query Provider
+//-------------------------------------------------------------------------
+// A simple built-in navmesh backend made up of a regular grid of walkable cells (each with a height)
+// This has no external dependencies so can be used for headless tests and benchmarks of the batched query API
+
+namespace EE::Navmesh
+{
+    class EE_ENGINE_API GridNavmeshQueryProvider final : public NavmeshQueryProvider
+    {
+        constexpr static int32_t const s_maxRandomPointAttempts = 16;
+
+    public:
+
+        GridNavmeshQueryProvider( Float3 const& origin, float cellSize, int32_t numCellsX, int32_t numCellsY );
+
+        inline int32_t GetNumCellsX() const { return m_numCellsX; }
+        inline int32_t GetNumCellsY() const { return m_numCellsY; }
+        inline float GetCellSize() const { return m_cellSize; }
+
+        // Cells are not walkable by default, you need to call 'UpdateConnectivity' once all cells have been set
+        void SetCellWalkable( int32_t cellX, int32_t cellY, bool isWalkable, float height = 0.0f );
+        inline bool IsCellWalkable( int32_t cellX, int32_t cellY ) const { return IsValidCell( cellX, cellY ) && m_isWalkable[GetCellIndex( cellX, cellY )]; }
+
+        // Calculate the connected regions of the grid, needed for the reachability checks
+        void UpdateConnectivity();
+
+        // Queries
+        //-------------------------------------------------------------------------
+
+        // The grid is immutable while querying and each random query uses its own generator
+        virtual bool SupportsConcurrentQueries() const override { return true; }
+
+        virtual PointQueryResult FindNearestPoint( NearestPointQuery const& query ) const override;
+        virtual RaycastResult Raycast( RaycastQuery const& query ) const override;
+        virtual PointQueryResult FindRandomReachablePoint( RandomPointQuery const& query ) const override;
+
+    private:
+
+        inline bool IsValidCell( int32_t cellX, int32_t cellY ) const { return cellX >= 0 && cellX < m_numCellsX && cellY >= 0 && cellY < m_numCellsY; }
+        inline int32_t GetCellIndex( int32_t cellX, int32_t cellY ) const { EE_ASSERT( IsValidCell( cellX, cellY ) ); return cellY * m_numCellsX + cellX; }
+        inline int32_t GetCellX( float x ) const { return (int32_t) Math::Floor( ( x - m_origin.m_x ) / m_cellSize ); }
+        inline int32_t GetCellY( float y ) const { return (int32_t) Math::Floor( ( y - m_origin.m_y ) / m_cellSize ); }
+
+    private:
+
+        Float3                  m_origin;
+        float                   m_cellSize;
+        int32_t                 m_numCellsX;
+        int32_t                 m_numCellsY;
+        TVector<float>          m_heights;
+        TVector<bool>           m_isWalkable;
+        TVector<int32_t>        m_regionIDs;        // The connected region each cell belongs to, invalid for non-walkable cells
+    };
+}
@@ -7,8 +7,8 @@ namespace EE::Navmesh::NavPower
 {
     class Allocator final : public bfx::CustomAllocator
     {
-        virtual void* CustomMalloc( size_t size ) override final { return EE::Alloc( size ); }
-        virtual void* CustomAlignedMalloc( uint32_t alignment, size_t size ) override final { return EE::Alloc( size, alignment ); }
+        virtual void* CustomMalloc( size_t size ) override final { EE_MEMORY_TAG_SCOPE( Navigation ); return EE::Alloc( size ); }
+        virtual void* CustomAlignedMalloc( uint32_t alignment, size_t size ) override final { EE_MEMORY_TAG_SCOPE( Navigation ); return EE::Alloc( size, alignment ); }
         virtual void CustomFree( void* ptr ) override final { EE::Free( ptr ); }
         virtual bool IsThreadSafe() const override final { return true; }
         virtual const char* GetName() const override { return "NavpowerCustomAllocator"; }
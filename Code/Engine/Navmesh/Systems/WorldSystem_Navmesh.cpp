@@ -7,6 +7,9 @@
 #include "Base/Profiling.h"
 #include "Base/Math/BoundingVolumes.h"
 #include "Base/Drawing/DebugDrawingSystem.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Math/MathConstants.h"
 
 //-------------------------------------------------------------------------
 
@@ -77,6 +80,109 @@ namespace EE::Navmesh
         };
     }
     #endif
+
+    //-------------------------------------------------------------------------
+
+    namespace Navpower
+    {
+        // Implements the spatial queries on top of path creation since that is what the rest of the code base already uses
+        // Note: bfx path creation has not been verified as safe to call from multiple threads so these queries are always executed serially
+        class QueryProvider final : public NavmeshQueryProvider
+        {
+            constexpr static int32_t const s_maxRandomPointAttempts = 8;
+            constexpr static float const s_randomPointAcceptanceRadius = 0.5f;
+
+        public:
+
+            QueryProvider( bfx::Instance* pInstance ) : m_pInstance( pInstance ) { EE_ASSERT( pInstance != nullptr ); }
+
+            virtual PointQueryResult FindNearestPoint( NearestPointQuery const& query ) const override
+            {
+                PointQueryResult result;
+
+                // A zero length path will have its start position snapped onto the navgraph
+                bfx::PolylinePathRCPtr path = CreatePath( query.m_position, query.m_position );
+                if ( path.IsValid() && path.GetNumSegments() > 0 )
+                {
+                    Vector const snappedPosition = FromBfx( path.GetSurfaceSegment( 0 )->GetStartPos() );
+                    Vector const delta = ( snappedPosition - query.m_position ).GetAbs();
+                    if ( delta.IsLessThanEqual3( query.m_searchExtents ) )
+                    {
+                        result.m_position = snappedPosition;
+                        result.m_isValid = true;
+                    }
+                }
+
+                return result;
+            }
+
+            virtual RaycastResult Raycast( RaycastQuery const& query ) const override
+            {
+                RaycastResult result;
+
+                // If the path planner needs to deviate from the straight line then something is blocking the ray
+                bfx::PolylinePathRCPtr path = CreatePath( query.m_start, query.m_end );
+                if ( !path.IsValid() || path.GetNumSegments() == 0 )
+                {
+                    result.m_hitPosition = query.m_start;
+                    result.m_hasHit = true;
+                    return result;
+                }
+
+                bfx::SurfaceSegment const* pFirstSegment = path.GetSurfaceSegment( 0 );
+                result.m_hitPosition = FromBfx( pFirstSegment->GetEndPos() );
+                result.m_hasHit = path.GetNumSegments() > 1 || !result.m_hitPosition.IsNearEqual3( query.m_end );
+                return result;
+            }
+
+            virtual PointQueryResult FindRandomReachablePoint( RandomPointQuery const& query ) const override
+            {
+                PointQueryResult result;
+
+                Math::RNG rng( query.m_seed );
+                for ( int32_t i = 0; i < s_maxRandomPointAttempts; i++ )
+                {
+                    float const distance = query.m_radius * Math::Sqrt( rng.GetFloat() );
+                    float const angle = rng.GetFloat( 0.0f, Math::TwoPi );
+                    Vector const samplePosition = query.m_origin + Vector( distance * Math::Cos( angle ), distance * Math::Sin( angle ), 0.0f, 0.0f );
+
+                    // The sample is reachable if we can plan a path to (close to) it
+                    bfx::PolylinePathRCPtr path = CreatePath( query.m_origin, samplePosition );
+                    if ( !path.IsValid() || path.GetNumSegments() == 0 )
+                    {
+                        continue;
+                    }
+
+                    Vector const pathEndPosition = FromBfx( path.GetSurfaceSegment( path.GetNumSegments() - 1 )->GetEndPos() );
+                    if ( pathEndPosition.GetDistanceSquared2( samplePosition ) <= Math::Sqr( s_randomPointAcceptanceRadius ) )
+                    {
+                        result.m_position = pathEndPosition;
+                        result.m_isValid = true;
+                        break;
+                    }
+                }
+
+                return result;
+            }
+
+        private:
+
+            inline bfx::PolylinePathRCPtr CreatePath( Vector const& start, Vector const& end ) const
+            {
+                bfx::PathSpec pathSpec;
+                pathSpec.m_snapMode = bfx::SNAP_CLOSEST;
+
+                bfx::PathCreationOptions pathOptions;
+                pathOptions.m_forceFirstPosOntoNavGraph = true;
+
+                return bfx::CreatePolylinePath( bfx::GetDefaultSpaceHandle( m_pInstance ), ToBfx( start ), ToBfx( end ), 0, pathSpec, pathOptions );
+            }
+
+        private:
+
+            bfx::Instance*                              m_pInstance = nullptr;
+        };
+    }
     #endif
 
     //-------------------------------------------------------------------------
@@ -105,6 +211,8 @@ namespace EE::Navmesh
 
     void NavmeshWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
     {
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
+
         #if EE_ENABLE_NAVPOWER
         m_pInstance = bfx::SystemCreate( bfx::SystemParams( 2.0f, bfx::Z_UP ), NavPower::GetAllocator() );
         bfx::SetCurrentInstance( nullptr );
@@ -112,6 +220,9 @@ namespace EE::Navmesh
         bfx::RegisterPlannerSystem( m_pInstance );
         bfx::SystemStart( m_pInstance );
 
+        m_pNavpowerQueryProvider = EE::New<Navpower::QueryProvider>( m_pInstance );
+        m_pQueryProvider = m_pNavpowerQueryProvider;
+
         #if EE_DEVELOPMENT_TOOLS
         m_pRenderer = EE::New<Navpower::Renderer>();
         bfx::SetRenderer( m_pInstance, m_pRenderer );
@@ -124,6 +235,8 @@ namespace EE::Navmesh
         #if EE_ENABLE_NAVPOWER
         EE_ASSERT( m_registeredNavmeshes.empty() );
 
+        EE::Delete( m_pNavpowerQueryProvider );
+
         #if EE_DEVELOPMENT_TOOLS
         bfx::SetRenderer( m_pInstance, nullptr );
         EE::Delete( m_pRenderer );
@@ -133,6 +246,9 @@ namespace EE::Navmesh
         bfx::SystemDestroy( m_pInstance );
         m_pInstance = nullptr;
         #endif
+
+        m_pQueryProvider = nullptr;
+        m_pTaskSystem = nullptr;
     }
 
     //-------------------------------------------------------------------------
@@ -224,6 +340,13 @@ namespace EE::Navmesh
 
     //-------------------------------------------------------------------------
 
+    bool NavmeshWorldSystem::GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const
+    {
+        // The navmesh simulation only touches our own state, the viewport is only needed for debug drawing
+        outAccess.ReadsResource( WorldSystemDataAccess::s_viewportResourceID );
+        return true;
+    }
+
     void NavmeshWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         #if EE_ENABLE_NAVPOWER
@@ -272,4 +395,96 @@ namespace EE::Navmesh
 
         return bounds;
     }
+
+    //-------------------------------------------------------------------------
+
+    void NavmeshWorldSystem::SetQueryProvider( NavmeshQueryProvider const* pQueryProvider )
+    {
+        #if EE_ENABLE_NAVPOWER
+        m_pQueryProvider = ( pQueryProvider != nullptr ) ? pQueryProvider : m_pNavpowerQueryProvider;
+        #else
+        m_pQueryProvider = pQueryProvider;
+        #endif
+    }
+
+    template<typename QueryType, typename ResultType, typename QueryFunction>
+    static void ExecuteQueryBatch( TaskSystem* pTaskSystem, NavmeshQueryProvider const* pQueryProvider, TVector<QueryType> const& queries, TVector<ResultType>& outResults, QueryFunction const& queryFunction )
+    {
+        constexpr static uint32_t const s_minQueriesPerTask = 16;
+
+        uint32_t const numQueries = (uint32_t) queries.size();
+        outResults.clear();
+        outResults.resize( numQueries );
+
+        // Each query only writes its own result so the batch can be split arbitrarily (as long as the provider is threadsafe)
+        if ( pTaskSystem != nullptr && pQueryProvider->SupportsConcurrentQueries() && numQueries > s_minQueriesPerTask )
+        {
+            AsyncTask queryTask( numQueries, [&] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    outResults[i] = queryFunction( queries[i] );
+                }
+            } );
+            queryTask.m_MinRange = s_minQueriesPerTask;
+
+            pTaskSystem->ScheduleTask( &queryTask );
+            pTaskSystem->WaitForTask( &queryTask );
+        }
+        else
+        {
+            for ( uint32_t i = 0; i < numQueries; i++ )
+            {
+                outResults[i] = queryFunction( queries[i] );
+            }
+        }
+    }
+
+    void NavmeshWorldSystem::FindNearestPoints( TVector<NearestPointQuery> const& queries, TVector<PointQueryResult>& outResults ) const
+    {
+        EE_PROFILE_FUNCTION_NAVIGATION();
+
+        if ( m_pQueryProvider == nullptr )
+        {
+            outResults.clear();
+            outResults.resize( queries.size() );
+            return;
+        }
+
+        ExecuteQueryBatch( m_pTaskSystem, m_pQueryProvider, queries, outResults, [this] ( NearestPointQuery const& query ) { return m_pQueryProvider->FindNearestPoint( query ); } );
+    }
+
+    void NavmeshWorldSystem::Raycasts( TVector<RaycastQuery> const& queries, TVector<RaycastResult>& outResults ) const
+    {
+        EE_PROFILE_FUNCTION_NAVIGATION();
+
+        // Without a navmesh, every ray is considered blocked at its start
+        if ( m_pQueryProvider == nullptr )
+        {
+            outResults.clear();
+            outResults.resize( queries.size() );
+            for ( size_t i = 0; i < queries.size(); i++ )
+            {
+                outResults[i].m_hitPosition = queries[i].m_start;
+                outResults[i].m_hasHit = true;
+            }
+            return;
+        }
+
+        ExecuteQueryBatch( m_pTaskSystem, m_pQueryProvider, queries, outResults, [this] ( RaycastQuery const& query ) { return m_pQueryProvider->Raycast( query ); } );
+    }
+
+    void NavmeshWorldSystem::FindRandomReachablePoints( TVector<RandomPointQuery> const& queries, TVector<PointQueryResult>& outResults ) const
+    {
+        EE_PROFILE_FUNCTION_NAVIGATION();
+
+        if ( m_pQueryProvider == nullptr )
+        {
+            outResults.clear();
+            outResults.resize( queries.size() );
+            return;
+        }
+
+        ExecuteQueryBatch( m_pTaskSystem, m_pQueryProvider, queries, outResults, [this] ( RandomPointQuery const& query ) { return m_pQueryProvider->FindRandomReachablePoint( query ); } );
+    }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Navmesh/NavPower.h"
+#include "Engine/Navmesh/NavmeshQuery.h"
 #include "Engine/Entity/EntityWorldSystem.h"
 #include "Engine/UpdateContext.h"
 
@@ -11,8 +12,15 @@
 // This is the main system responsible for managing navmesh within a specific world
 // Manages navmesh registration, obstacles creation/destruction, etc...
 // Primarily also needed to get the space handle needed for any queries ( GetSpaceHandle )
+//
+// Spatial queries (nearest point, raycasts, random points) are issued in batches which are split across the worker threads if the provider is threadsafe.
+// The queries are performed by a query provider: by default this is the NavPower backend but it can be overridden (i.e. grid navmesh for tests)
 
-namespace EE { struct AABB; }
+namespace EE
+{
+    struct AABB;
+    class TaskSystem;
+}
 
 //-------------------------------------------------------------------------
 
@@ -20,7 +28,11 @@ namespace EE { struct AABB; }
 namespace EE::Navmesh
 {
     class NavmeshComponent;
-    namespace Navpower { class Renderer; }
+    namespace Navpower
+    {
+        class Renderer;
+        class QueryProvider;
+    }
 
     //-------------------------------------------------------------------------
 
@@ -53,6 +65,18 @@ namespace EE::Navmesh
         EE_FORCE_INLINE bfx::SpaceHandle GetSpaceHandle() const { return bfx::GetDefaultSpaceHandle( m_pInstance ); }
         #endif
 
+        // Batched Queries
+        //-------------------------------------------------------------------------
+        // The result arrays will be resized to match the query arrays, results are in the same order as the queries
+
+        void FindNearestPoints( TVector<NearestPointQuery> const& queries, TVector<PointQueryResult>& outResults ) const;
+        void Raycasts( TVector<RaycastQuery> const& queries, TVector<RaycastResult>& outResults ) const;
+        void FindRandomReachablePoints( TVector<RandomPointQuery> const& queries, TVector<PointQueryResult>& outResults ) const;
+
+        // Override the default query provider, the provider is not owned by this system. Set to null to restore the default provider.
+        void SetQueryProvider( NavmeshQueryProvider const* pQueryProvider );
+        inline NavmeshQueryProvider const* GetQueryProvider() const { return m_pQueryProvider; }
+
     private:
 
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override;
@@ -65,6 +89,7 @@ namespace EE::Navmesh
         void UnregisterNavmesh( NavmeshComponent* pComponent );
 
         void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual bool GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const override;
 
         #if EE_DEVELOPMENT_TOOLS
         bool IsDebugRendererDepthTestEnabled() const;
@@ -73,8 +98,12 @@ namespace EE::Navmesh
 
     private:
 
+        TaskSystem*                                     m_pTaskSystem = nullptr;
+        NavmeshQueryProvider const*                     m_pQueryProvider = nullptr;
+
         #if EE_ENABLE_NAVPOWER
         bfx::Instance*                                  m_pInstance = nullptr;
+        Navpower::QueryProvider*                        m_pNavpowerQueryProvider = nullptr;
 
         #if EE_DEVELOPMENT_TOOLS
         Navpower::Renderer*                             m_pRenderer = nullptr;
@@ -136,6 +136,26 @@ namespace EE::Physics
             pWorld->SetDebugDrawDistance( drawDistance );
         }
 
+        //-------------------------------------------------------------------------
+        // Query Cache
+        //-------------------------------------------------------------------------
+
+        ImGui::Separator();
+
+        QueryCache::Statistics const& queryCacheStats = pWorld->GetQueryCacheStatistics();
+        ImGui::Text( "Cached Queries: %u lookups, %u hits (%.1f%%)", queryCacheStats.m_numLookups, queryCacheStats.m_numHits, queryCacheStats.GetHitRate() * 100.0f );
+
+        bool isQueryCacheValidationEnabled = pWorld->IsQueryCacheValidationEnabled();
+        if ( ImGui::Checkbox( "Validate Cached Queries", &isQueryCacheValidationEnabled ) )
+        {
+            pWorld->SetQueryCacheValidationEnabled( isQueryCacheValidationEnabled );
+        }
+
+        if ( isQueryCacheValidationEnabled )
+        {
+            ImGui::Text( "Validation Failures: %u", queryCacheStats.m_numValidationFailures );
+        }
+
         //-------------------------------------------------------------------------
         // Materials
         //-------------------------------------------------------------------------
@@ -64,6 +64,7 @@ namespace EE::Physics
         {
             virtual void* allocate( size_t size, const char* typeName, const char* filename, int line ) override
             {
+                EE_MEMORY_TAG_SCOPE( Physics );
                 return EE::Alloc( size, 16 );
             }
 
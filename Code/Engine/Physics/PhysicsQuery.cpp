@@ -10,6 +10,7 @@ namespace EE::Physics
         m_ignoredComponents.clear();
         m_ignoredEntities.clear();
         m_allowMultipleHits = false;
+        m_useQueryCache = false;
 
         UpdateInternals();
     }
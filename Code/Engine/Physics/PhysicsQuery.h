@@ -87,6 +87,10 @@ namespace EE::Physics
 
         EE_FORCE_INLINE physx::PxQueryFilterData const& GetPxFilterData() const { return m_queryFilterData; }
 
+        EE_FORCE_INLINE uint32_t GetCollidesWithMask() const { return m_collidesWithMask; }
+
+        EE_FORCE_INLINE MobilityFilter GetMobilityFilter() const { return m_mobilityFilter; }
+
         // Query Settings
         //-------------------------------------------------------------------------
 
@@ -98,6 +102,8 @@ namespace EE::Physics
             return *this;
         }
 
+        inline bool AllowsMultipleHits() const { return m_allowMultipleHits; }
+
         // Should we calculate the depenetration information if we are initially overlapping during a sweep or for overlap queries
         inline QueryRules& SetCalculateDepenetrationInfo( bool calculateDepenetration )
         {
@@ -106,6 +112,19 @@ namespace EE::Physics
             return *this;
         }
 
+        inline bool ShouldCalculateDepenetrationInfo() const { return m_calculateDepenetration; }
+
+        // Share results with identical queries (within 1mm) that were issued earlier in the same frame, see 'QueryCache'
+        // Cached results do not reflect any changes made to the scene since the original query (i.e. character controller moves), so only use this for queries that can tolerate that
+        // The results struct supplied to a cached query needs to be empty
+        inline QueryRules& SetUseQueryCache( bool useQueryCache )
+        {
+            m_useQueryCache = useQueryCache;
+            return *this;
+        }
+
+        inline bool UsesQueryCache() const { return m_useQueryCache; }
+
         // Ignore Rules
         //-------------------------------------------------------------------------
 
@@ -140,6 +159,7 @@ namespace EE::Physics
         uint32_t                        m_collidesWithMask = 0;
         bool                            m_allowMultipleHits = false;
         bool                            m_calculateDepenetration = true;
+        bool                            m_useQueryCache = false;
         MobilityFilter                  m_mobilityFilter = StaticAndDynamic;
         TInlineVector<EntityID, 5>      m_ignoredEntities;
         TInlineVector<ComponentID, 5>   m_ignoredComponents;
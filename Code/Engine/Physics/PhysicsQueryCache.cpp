@@ -0,0 +1,147 @@
+#include "PhysicsQueryCache.h"
+#include "Base/Encoding/Hash.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Physics
+{
+    // Quantization steps (i.e. values within these steps of each other are considered identical)
+    constexpr static float const g_positionQuantizationScale = 1000.0f;     // 1mm
+    constexpr static float const g_directionQuantizationScale = 10000.0f;   // Unit vectors and quaternions
+
+    static inline void QuantizeValues( float const* pValues, int32_t* pQuantizedValues, int32_t numValues, float scale )
+    {
+        for ( int32_t i = 0; i < numValues; i++ )
+        {
+            pQuantizedValues[i] = Math::RoundToInt( pValues[i] * scale );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    QueryCache::Key::Key( QueryType type, uint8_t geometryType, Vector const& shapeParameters, Vector const& position, Quaternion const& orientation, Vector const& direction, float distance, QueryRules const& rules )
+        : m_queryType( (uint8_t) type )
+        , m_geometryType( geometryType )
+        , m_mobilityFilter( (uint8_t) rules.GetMobilityFilter() )
+        , m_flags( ( rules.AllowsMultipleHits() ? 1 : 0 ) | ( rules.ShouldCalculateDepenetrationInfo() ? 2 : 0 ) )
+        , m_collidesWithMask( rules.GetCollidesWithMask() )
+    {
+        static_assert( sizeof( Key ) == 72, "Key must not contain any padding since we hash and compare the raw memory" );
+
+        Float3 const position3 = position.ToFloat3();
+        Float4 const orientation4 = orientation.ToFloat4();
+        Float3 const direction3 = direction.ToFloat3();
+        Float3 const shapeParameters3 = shapeParameters.ToFloat3();
+
+        QuantizeValues( &position3.m_x, m_position, 3, g_positionQuantizationScale );
+        QuantizeValues( &orientation4.m_x, m_orientation, 4, g_directionQuantizationScale );
+        QuantizeValues( &direction3.m_x, m_direction, 3, g_directionQuantizationScale );
+        QuantizeValues( &distance, &m_distance, 1, g_positionQuantizationScale );
+        QuantizeValues( &shapeParameters3.m_x, m_shapeParameters, 3, g_positionQuantizationScale );
+
+        auto const& ignoredEntities = rules.GetIgnoredEntities();
+        auto const& ignoredComponents = rules.GetIgnoredComponents();
+        if ( !ignoredEntities.empty() || !ignoredComponents.empty() )
+        {
+            uint64_t const entitiesHash = Hash::GetHash64( ignoredEntities.data(), ignoredEntities.size() * sizeof( EntityID ) );
+            uint64_t const componentsHash = Hash::GetHash64( ignoredComponents.data(), ignoredComponents.size() * sizeof( ComponentID ) );
+            m_ignoreListHash = entitiesHash ^ ( componentsHash * 31 );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void QueryCache::Clear()
+    {
+        auto ClearCache = [] ( auto& cache )
+        {
+            Threading::ScopeLockWrite const lock( cache.m_mutex );
+            cache.m_keyHashToEntryIdx.clear();
+            cache.m_entries.clear();
+        };
+
+        ClearCache( m_rayCastCache );
+        ClearCache( m_sweepCache );
+        ClearCache( m_overlapCache );
+    }
+
+    void QueryCache::ResetStatistics()
+    {
+        m_lastFrameStatistics.m_numLookups = m_numLookups.exchange( 0 );
+        m_lastFrameStatistics.m_numHits = m_numHits.exchange( 0 );
+        m_lastFrameStatistics.m_numValidationFailures = m_numValidationFailures.exchange( 0 );
+    }
+
+    template<typename ResultsType>
+    int32_t QueryCache::FindEntry( ResultCache<ResultsType> const& cache, uint64_t keyHash, Key const& key, QueryRules const& rules ) const
+    {
+        auto iter = cache.m_keyHashToEntryIdx.find( keyHash );
+        if ( iter == cache.m_keyHashToEntryIdx.end() )
+        {
+            return InvalidIndex;
+        }
+
+        // Resolve hash collisions
+        Entry<ResultsType> const& entry = cache.m_entries[iter->second];
+        if ( !( entry.m_key == key ) || entry.m_ignoredEntities != rules.GetIgnoredEntities() || entry.m_ignoredComponents != rules.GetIgnoredComponents() )
+        {
+            return InvalidIndex;
+        }
+
+        return iter->second;
+    }
+
+    template<typename ResultsType>
+    bool QueryCache::TryGetResults( ResultCache<ResultsType>& cache, Key const& key, QueryRules const& rules, ResultsType& outResults, bool& outResult )
+    {
+        m_numLookups++;
+
+        uint64_t const keyHash = Hash::GetHash64( &key, sizeof( Key ) );
+
+        Threading::ScopeLockRead const lock( cache.m_mutex );
+        int32_t const entryIdx = FindEntry( cache, keyHash, key, rules );
+        if ( entryIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        Entry<ResultsType> const& entry = cache.m_entries[entryIdx];
+        outResults = entry.m_results;
+        outResult = entry.m_result;
+        m_numHits++;
+        return true;
+    }
+
+    template<typename ResultsType>
+    void QueryCache::AddResults( ResultCache<ResultsType>& cache, Key const& key, QueryRules const& rules, ResultsType const& results, bool result )
+    {
+        uint64_t const keyHash = Hash::GetHash64( &key, sizeof( Key ) );
+
+        Threading::ScopeLockWrite const lock( cache.m_mutex );
+
+        // Another thread might have run the same query concurrently or we have a hash collision, in both cases we just keep the existing entry
+        if ( cache.m_keyHashToEntryIdx.find( keyHash ) != cache.m_keyHashToEntryIdx.end() )
+        {
+            return;
+        }
+
+        cache.m_keyHashToEntryIdx[keyHash] = (int32_t) cache.m_entries.size();
+
+        Entry<ResultsType>& entry = cache.m_entries.emplace_back();
+        entry.m_key = key;
+        entry.m_ignoredEntities = rules.GetIgnoredEntities();
+        entry.m_ignoredComponents = rules.GetIgnoredComponents();
+        entry.m_results = results;
+        entry.m_result = result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool QueryCache::TryGetResults( Key const& key, QueryRules const& rules, RayCastResults& outResults, bool& outResult ) { return TryGetResults( m_rayCastCache, key, rules, outResults, outResult ); }
+    bool QueryCache::TryGetResults( Key const& key, QueryRules const& rules, SweepResults& outResults, bool& outResult ) { return TryGetResults( m_sweepCache, key, rules, outResults, outResult ); }
+    bool QueryCache::TryGetResults( Key const& key, QueryRules const& rules, OverlapResults& outResults, bool& outResult ) { return TryGetResults( m_overlapCache, key, rules, outResults, outResult ); }
+
+    void QueryCache::AddResults( Key const& key, QueryRules const& rules, RayCastResults const& results, bool result ) { AddResults( m_rayCastCache, key, rules, results, result ); }
+    void QueryCache::AddResults( Key const& key, QueryRules const& rules, SweepResults const& results, bool result ) { AddResults( m_sweepCache, key, rules, results, result ); }
+    void QueryCache::AddResults( Key const& key, QueryRules const& rules, OverlapResults const& results, bool result ) { AddResults( m_overlapCache, key, rules, results, result ); }
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Engine/Physics/PhysicsQuery.h"
+#include "Base/Math/Quaternion.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/HashMap.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+// Scene Query Cache
+//-------------------------------------------------------------------------
+// Stores the results of scene queries for the current frame so that identical queries issued by different systems only hit the scene once
+//
+// Queries are keyed by their type, shape, quantized transform/direction/distance and their query rules. Queries that are within the
+// quantization step of each other (1mm for positions and distances) will share results, so the cached results are only approximately
+// those of the later query. The cache is threadsafe and is cleared by the physics world every simulation step and whenever actors are removed.
+
+namespace EE::Physics
+{
+    class EE_ENGINE_API QueryCache
+    {
+    public:
+
+        enum class QueryType : uint8_t
+        {
+            RayCast = 0,
+            Sweep,
+            Overlap,
+        };
+
+        // Quantized query parameters - this is a POD type with no padding so that we can hash and compare the raw memory
+        struct Key
+        {
+            Key() = default;
+            Key( QueryType type, uint8_t geometryType, Vector const& shapeParameters, Vector const& position, Quaternion const& orientation, Vector const& direction, float distance, QueryRules const& rules );
+
+            inline bool operator==( Key const& rhs ) const { return memcmp( this, &rhs, sizeof( Key ) ) == 0; }
+
+            uint8_t                 m_queryType = 0;
+            uint8_t                 m_geometryType = 0;
+            uint8_t                 m_mobilityFilter = 0;
+            uint8_t                 m_flags = 0;
+            uint32_t                m_collidesWithMask = 0;
+            int32_t                 m_position[3] = { 0, 0, 0 };
+            int32_t                 m_orientation[4] = { 0, 0, 0, 0 };
+            int32_t                 m_direction[3] = { 0, 0, 0 };
+            int32_t                 m_distance = 0;
+            int32_t                 m_shapeParameters[3] = { 0, 0, 0 };
+            uint64_t                m_ignoreListHash = 0;
+        };
+
+        struct Statistics
+        {
+            inline float GetHitRate() const { return ( m_numLookups > 0 ) ? float( m_numHits ) / m_numLookups : 0.0f; }
+
+            uint32_t                m_numLookups = 0;
+            uint32_t                m_numHits = 0;
+            uint32_t                m_numValidationFailures = 0;   // Only tracked when validation is enabled
+        };
+
+    private:
+
+        template<typename ResultsType>
+        struct Entry
+        {
+            Key                             m_key;
+            TInlineVector<EntityID, 5>      m_ignoredEntities;      // Needed to resolve ignore list hash collisions
+            TInlineVector<ComponentID, 5>   m_ignoredComponents;
+            ResultsType                     m_results;
+            bool                            m_result = false;
+        };
+
+        template<typename ResultsType>
+        struct ResultCache
+        {
+            Threading::ReadWriteMutex           m_mutex;
+            THashMap<uint64_t, int32_t>         m_keyHashToEntryIdx;
+            TVector<Entry<ResultsType>>         m_entries;
+        };
+
+    public:
+
+        // Remove all cached results
+        void Clear();
+
+        // Store the statistics for the frame that just completed and start counting again
+        void ResetStatistics();
+
+        // Get the statistics for the last completed frame
+        inline Statistics const& GetLastFrameStatistics() const { return m_lastFrameStatistics; }
+
+        #if EE_DEVELOPMENT_TOOLS
+        // When enabled, the physics world will run the actual query for every cache hit and compare the results
+        inline bool IsValidationEnabled() const { return m_isValidationEnabled; }
+        inline void SetValidationEnabled( bool isEnabled ) { m_isValidationEnabled = isEnabled; }
+        inline void RecordValidationFailure() { m_numValidationFailures++; }
+        #endif
+
+        // Results
+        //-------------------------------------------------------------------------
+
+        bool TryGetResults( Key const& key, QueryRules const& rules, RayCastResults& outResults, bool& outResult );
+        bool TryGetResults( Key const& key, QueryRules const& rules, SweepResults& outResults, bool& outResult );
+        bool TryGetResults( Key const& key, QueryRules const& rules, OverlapResults& outResults, bool& outResult );
+
+        void AddResults( Key const& key, QueryRules const& rules, RayCastResults const& results, bool result );
+        void AddResults( Key const& key, QueryRules const& rules, SweepResults const& results, bool result );
+        void AddResults( Key const& key, QueryRules const& rules, OverlapResults const& results, bool result );
+
+    private:
+
+        template<typename ResultsType>
+        bool TryGetResults( ResultCache<ResultsType>& cache, Key const& key, QueryRules const& rules, ResultsType& outResults, bool& outResult );
+
+        template<typename ResultsType>
+        void AddResults( ResultCache<ResultsType>& cache, Key const& key, QueryRules const& rules, ResultsType const& results, bool result );
+
+        template<typename ResultsType>
+        int32_t FindEntry( ResultCache<ResultsType> const& cache, uint64_t keyHash, Key const& key, QueryRules const& rules ) const;
+
+    private:
+
+        ResultCache<RayCastResults>     m_rayCastCache;
+        ResultCache<SweepResults>       m_sweepCache;
+        ResultCache<OverlapResults>     m_overlapCache;
+
+        std::atomic<uint32_t>           m_numLookups = 0;
+        std::atomic<uint32_t>           m_numHits = 0;
+        std::atomic<uint32_t>           m_numValidationFailures = 0;
+        Statistics                      m_lastFrameStatistics;
+
+        #if EE_DEVELOPMENT_TOOLS
+        bool                            m_isValidationEnabled = false;
+        #endif
+    };
+}
@@ -181,6 +181,89 @@ namespace EE::Physics::PX
 
         QueryRules const& m_rules;
     };
+
+    //-------------------------------------------------------------------------
+
+    // Get the shape parameters needed to differentiate queries in the query cache
+    static Vector GetQueryCacheShapeParameters( PxGeometry const& geo )
+    {
+        switch ( geo.getType() )
+        {
+            case PxGeometryType::eSPHERE:
+            {
+                auto const& sphereGeo = static_cast<PxSphereGeometry const&>( geo );
+                return Vector( sphereGeo.radius, 0.0f, 0.0f, 0.0f );
+            }
+
+            case PxGeometryType::eCAPSULE:
+            {
+                auto const& capsuleGeo = static_cast<PxCapsuleGeometry const&>( geo );
+                return Vector( capsuleGeo.radius, capsuleGeo.halfHeight, 0.0f, 0.0f );
+            }
+
+            case PxGeometryType::eBOX:
+            {
+                auto const& boxGeo = static_cast<PxBoxGeometry const&>( geo );
+                return Vector( FromPx( boxGeo.halfExtents ), 0.0f );
+            }
+
+            // Only the unit cylinder is used for convex mesh queries, so the scale is enough to identify the shape
+            case PxGeometryType::eCONVEXMESH:
+            {
+                auto const& convexGeo = static_cast<PxConvexMeshGeometry const&>( geo );
+                EE_ASSERT( convexGeo.convexMesh == Shapes::s_pUnitCylinderMesh );
+                return Vector( FromPx( convexGeo.scale.scale ), 0.0f );
+            }
+
+            default:
+            {
+                EE_UNREACHABLE_CODE();
+                return Vector::Zero;
+            }
+        }
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    // Used to validate cached results against the actual query results
+    template<typename ResultsType>
+    static bool AreQueryResultsEquivalent( ResultsType const& a, ResultsType const& b )
+    {
+        constexpr static float const s_distanceTolerance = 0.01f;
+
+        if ( a.m_hits.size() != b.m_hits.size() )
+        {
+            return false;
+        }
+
+        for ( auto i = 0u; i < a.m_hits.size(); i++ )
+        {
+            if ( a.m_hits[i].m_pActor != b.m_hits[i].m_pActor || Math::Abs( a.m_hits[i].m_distance - b.m_hits[i].m_distance ) > s_distanceTolerance )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static bool AreQueryResultsEquivalent( OverlapResults const& a, OverlapResults const& b )
+    {
+        if ( a.m_overlaps.size() != b.m_overlaps.size() )
+        {
+            return false;
+        }
+
+        for ( auto i = 0u; i < a.m_overlaps.size(); i++ )
+        {
+            if ( a.m_overlaps[i].m_pActor != b.m_overlaps[i].m_pActor )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    #endif
 }
 
 //-------------------------------------------------------------------------
@@ -244,6 +327,10 @@ namespace EE::Physics
             m_pScene->fetchResults( true );
         }
         ReleaseWriteLock();
+
+        // All actors may have moved so any cached query results are now invalid
+        m_queryCache.Clear();
+        m_queryCache.ResetStatistics();
     }
 
     //-------------------------------------------------------------------------
@@ -275,10 +362,76 @@ namespace EE::Physics
     }
 
     //-------------------------------------------------------------------------
-    // Sweeps
+    // Query Cache
     //-------------------------------------------------------------------------
 
+    template<typename ResultsType, typename QueryFunction>
+    static bool ExecuteCachedQuery( QueryCache& cache, QueryCache::Key const& key, QueryRules const& rules, ResultsType& outResults, QueryFunction const& executeQuery )
+    {
+        bool result = false;
+        if ( cache.TryGetResults( key, rules, outResults, result ) )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            if ( cache.IsValidationEnabled() )
+            {
+                ResultsType actualResults;
+                bool const actualResult = executeQuery( actualResults );
+                if ( actualResult != result || !PX::AreQueryResultsEquivalent( actualResults, outResults ) )
+                {
+                    cache.RecordValidationFailure();
+                }
+            }
+            #endif
+
+            return result;
+        }
+
+        result = executeQuery( outResults );
+        cache.AddResults( key, rules, outResults, result );
+        return result;
+    }
+
     bool PhysicsWorld::RayCastInternal( Vector const& position, Vector const& direction, float distance, QueryRules const& rules, RayCastResults& outResults )
+    {
+        if ( !rules.UsesQueryCache() )
+        {
+            return ExecuteRayCast( position, direction, distance, rules, outResults );
+        }
+
+        EE_ASSERT( !outResults.HasHits() );
+        QueryCache::Key const key( QueryCache::QueryType::RayCast, 0, Vector::Zero, position, Quaternion::Identity, direction, distance, rules );
+        return ExecuteCachedQuery( m_queryCache, key, rules, outResults, [&] ( RayCastResults& results ) { return ExecuteRayCast( position, direction, distance, rules, results ); } );
+    }
+
+    bool PhysicsWorld::SweepInternal( PxGeometry const& geo, Transform const& startTransform, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults )
+    {
+        if ( !rules.UsesQueryCache() )
+        {
+            return ExecuteSweep( geo, startTransform, direction, distance, rules, outResults );
+        }
+
+        EE_ASSERT( !outResults.HasHits() );
+        QueryCache::Key const key( QueryCache::QueryType::Sweep, (uint8_t) geo.getType(), PX::GetQueryCacheShapeParameters( geo ), startTransform.GetTranslation(), startTransform.GetRotation(), direction, distance, rules );
+        return ExecuteCachedQuery( m_queryCache, key, rules, outResults, [&] ( SweepResults& results ) { return ExecuteSweep( geo, startTransform, direction, distance, rules, results ); } );
+    }
+
+    bool PhysicsWorld::OverlapInternal( PxGeometry const& geo, Transform const& transform, QueryRules const& rules, OverlapResults& outResults )
+    {
+        if ( !rules.UsesQueryCache() )
+        {
+            return ExecuteOverlap( geo, transform, rules, outResults );
+        }
+
+        EE_ASSERT( !outResults.HasOverlaps() );
+        QueryCache::Key const key( QueryCache::QueryType::Overlap, (uint8_t) geo.getType(), PX::GetQueryCacheShapeParameters( geo ), transform.GetTranslation(), transform.GetRotation(), Vector::Zero, 0.0f, rules );
+        return ExecuteCachedQuery( m_queryCache, key, rules, outResults, [&] ( OverlapResults& results ) { return ExecuteOverlap( geo, transform, rules, results ); } );
+    }
+
+    //-------------------------------------------------------------------------
+    // Sweeps
+    //-------------------------------------------------------------------------
+
+    bool PhysicsWorld::ExecuteRayCast( Vector const& position, Vector const& direction, float distance, QueryRules const& rules, RayCastResults& outResults )
     {
         PX::QueryFilter filterCallback( rules );
         PxRaycastBufferN<50> buffer;
@@ -338,7 +491,7 @@ namespace EE::Physics
         return result;
     }
 
-    bool PhysicsWorld::SweepInternal( PxGeometry const& geo, Transform const& startTransform, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults )
+    bool PhysicsWorld::ExecuteSweep( PxGeometry const& geo, Transform const& startTransform, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults )
     {
         PX::QueryFilter filterCallback( rules );
         PxSweepBufferN<50> buffer;
@@ -468,7 +621,7 @@ namespace EE::Physics
     // Overlaps
     //-------------------------------------------------------------------------
 
-    bool PhysicsWorld::OverlapInternal( PxGeometry const& geo, Transform const& transform, QueryRules const& rules, OverlapResults& outResults )
+    bool PhysicsWorld::ExecuteOverlap( PxGeometry const& geo, Transform const& transform, QueryRules const& rules, OverlapResults& outResults )
     {
         PX::QueryFilter filterCallback( rules );
         PxOverlapBufferN<50> buffer;
@@ -738,6 +891,9 @@ namespace EE::Physics
             pPxScene->removeActor( *pComponent->m_pPhysicsActor );
             pPxScene->unlockWrite();
             pComponent->m_pPhysicsActor->release();
+
+            // Cached results might reference the released actor
+            m_queryCache.Clear();
         }
 
         //-------------------------------------------------------------------------
@@ -820,6 +976,8 @@ namespace EE::Physics
             pComponent->m_pController->release();
             pComponent->m_pController = nullptr;
             m_pScene->unlockWrite();
+
+            m_queryCache.Clear();
         }
 
         #if EE_DEVELOPMENT_TOOLS
@@ -840,6 +998,7 @@ namespace EE::Physics
         EE_ASSERT( pRagdoll );
         pRagdoll->RemoveFromScene();
         EE::Delete( pRagdoll );
+        m_queryCache.Clear();
     }
 
     //------------------------------------------------------------------------- 
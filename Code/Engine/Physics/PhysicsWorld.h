@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Physics/PhysicsQuery.h"
+#include "Engine/Physics/PhysicsQueryCache.h"
 #include "Base/Time/Time.h"
 #include "Base/Math/Transform.h"
 #include <atomic>
@@ -194,6 +195,17 @@ namespace EE::Physics
             return BoxOverlap( halfExtents, shapeTransform.GetRotation(), shapeTransform.GetTranslation(), rules, outResults );
         }
 
+        // Query Cache
+        //-------------------------------------------------------------------------
+        // Queries that opt in via 'QueryRules::SetUseQueryCache' share their results with identical queries issued earlier in the same frame
+
+        inline QueryCache::Statistics const& GetQueryCacheStatistics() const { return m_queryCache.GetLastFrameStatistics(); }
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline bool IsQueryCacheValidationEnabled() const { return m_queryCache.IsValidationEnabled(); }
+        inline void SetQueryCacheValidationEnabled( bool isEnabled ) { m_queryCache.SetValidationEnabled( isEnabled ); }
+        #endif
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -233,6 +245,11 @@ namespace EE::Physics
         bool SweepInternal( physx::PxGeometry const& geo, Transform const& startTransform, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults );
         bool OverlapInternal( physx::PxGeometry const& geo, Transform const& transform, QueryRules const& rules, OverlapResults& outResults );
 
+        // The actual scene queries, these ignore the query cache
+        bool ExecuteRayCast( Vector const& start, Vector const& direction, float distance, QueryRules const& rules, RayCastResults& outResults );
+        bool ExecuteSweep( physx::PxGeometry const& geo, Transform const& startTransform, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults );
+        bool ExecuteOverlap( physx::PxGeometry const& geo, Transform const& transform, QueryRules const& rules, OverlapResults& outResults );
+
         // Actors and Shapes
         //-------------------------------------------------------------------------
 
@@ -248,6 +265,7 @@ namespace EE::Physics
         physx::PxScene*                                         m_pScene = nullptr;
         physx::PxControllerManager*                             m_pControllerManager = nullptr;
         bool                                                    m_isGameWorld = false;
+        mutable QueryCache                                      m_queryCache;                   // Mutable since the query functions are const and need to store their results
 
         #if EE_DEVELOPMENT_TOOLS
         uint32_t                                                m_sceneDebugFlags = 0;
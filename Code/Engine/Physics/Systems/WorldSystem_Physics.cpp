@@ -181,6 +181,25 @@ namespace EE::Physics
 
     //-------------------------------------------------------------------------
 
+    bool PhysicsWorldSystem::GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const
+    {
+        // Debug test components are read in all stages
+        outAccess.ReadsComponent<PhysicsTestComponent>();
+
+        if ( stage == UpdateStage::Physics )
+        {
+            outAccess.WritesComponent<PhysicsShapeComponent>();
+            outAccess.WritesComponent<CharacterComponent>();
+        }
+        else if ( stage == UpdateStage::PostPhysics )
+        {
+            // Writing back the simulated poses will update the spatial hierarchies of the dynamic components
+            outAccess.WritesComponent<SpatialEntityComponent>();
+        }
+
+        return true;
+    }
+
     void PhysicsWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         // HACK HACK
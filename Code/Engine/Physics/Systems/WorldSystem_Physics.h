@@ -57,6 +57,7 @@ namespace EE::Physics
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override final;
+        virtual bool GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const override;
 
         void RegisterDynamicComponent( PhysicsShapeComponent* pComponent );
         void UnregisterDynamicComponent( PhysicsShapeComponent* pComponent );
@@ -139,6 +139,19 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
+    bool PlayerManager::GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const
+    {
+        // We only do work in the frame start stage
+        if ( stage == UpdateStage::FrameStart )
+        {
+            outAccess.ReadsComponent<Player::PlayerSpawnComponent>();
+            outAccess.WritesComponent<Player::PlayerComponent>();
+            outAccess.WritesResource( WorldSystemDataAccess::s_persistentMapResourceID );
+        }
+
+        return true;
+    }
+
     void PlayerManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( ctx.GetUpdateStage() == UpdateStage::FrameStart )
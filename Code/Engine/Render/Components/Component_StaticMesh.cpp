@@ -5,6 +5,17 @@
 
 namespace EE::Render
 {
+    void StaticMeshComponent::Initialize()
+    {
+        MeshComponent::Initialize();
+        m_areRenderMatricesDirty = true;
+    }
+
+    void StaticMeshComponent::OnWorldTransformUpdated()
+    {
+        m_areRenderMatricesDirty = true;
+    }
+
     OBB StaticMeshComponent::CalculateLocalBounds() const
     {
         if ( HasMeshResourceSet() )
@@ -26,6 +37,15 @@ namespace EE::Render
         return m_mesh->GetMaterials();
     }
 
+    void StaticMeshComponent::UpdateRenderMatrices()
+    {
+        Transform const& worldTransform = GetWorldTransform();
+        Vector const finalScale = m_localScale * worldTransform.GetScale();
+        m_worldMatrix = Matrix( worldTransform.GetRotation(), worldTransform.GetTranslation(), finalScale );
+        m_normalMatrix = m_worldMatrix.GetInverse().Transpose();
+        m_areRenderMatricesDirty = false;
+    }
+
     //-------------------------------------------------------------------------
 
     #if EE_DEVELOPMENT_TOOLS
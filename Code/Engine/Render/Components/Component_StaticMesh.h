@@ -2,20 +2,44 @@
 
 #include "Component_RenderMesh.h"
 #include "Engine/Render/Mesh/StaticMesh.h"
+#include "Base/Math/Matrix.h"
 #include "Base/Types/Event.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Render
 {
+    class RendererWorldSystem;
+
+    //-------------------------------------------------------------------------
+
     class EE_ENGINE_API StaticMeshComponent final : public MeshComponent
     {
         EE_ENTITY_COMPONENT( StaticMeshComponent );
 
+        friend RendererWorldSystem;
+
+    public:
+
+        enum class Mobility : uint8_t
+        {
+            EE_REFLECT_ENUM
+
+            Stationary = 0,     // Not expected to move, the renderer caches the culling results for these meshes. Moving them is allowed but expensive.
+            Movable,            // Expected to move, these meshes are re-culled every frame
+        };
+
     public:
 
         using MeshComponent::MeshComponent;
 
+        // Mobility
+        //-------------------------------------------------------------------------
+        // Mobility is only read on registration with the renderer
+
+        inline Mobility GetMobility() const { return m_mobility; }
+        inline bool IsMovable() const { return m_mobility == Mobility::Movable; }
+
         // Local Scale
         //-------------------------------------------------------------------------
 
@@ -42,9 +66,31 @@ namespace EE::Render
 
         virtual TVector<TResourcePtr<Material>> const& GetDefaultMaterials() const override;
 
+        // Render Matrices
+        //-------------------------------------------------------------------------
+
+        // Get the world matrix (including the local scale), cached and only recalculated when the world transform changes
+        inline Matrix const& GetWorldMatrix() const
+        {
+            EE_ASSERT( !m_areRenderMatricesDirty );
+            return m_worldMatrix;
+        }
+
+        // Get the normal matrix (the inverse transpose of the world matrix), cached and only recalculated when the world transform changes
+        inline Matrix const& GetNormalMatrix() const
+        {
+            EE_ASSERT( !m_areRenderMatricesDirty );
+            return m_normalMatrix;
+        }
+
     protected:
 
+        virtual void Initialize() override;
         virtual OBB CalculateLocalBounds() const override final;
+        virtual void OnWorldTransformUpdated() override final;
+
+        // Only called by the renderer world system, before culling, so the matrices are never written while they are being read
+        void UpdateRenderMatrices();
 
         #if EE_DEVELOPMENT_TOOLS
         virtual void PostPropertyEdit( TypeSystem::PropertyInfo const* pPropertyEdited ) override;
@@ -55,9 +101,17 @@ namespace EE::Render
         // A local scale that doesnt propagate but that can allow for non-uniform scaling of meshes
         EE_REFLECT() Float3                                m_localScale = Float3::One;
 
+        // Whether this mesh is expected to move at runtime
+        EE_REFLECT() Mobility                              m_mobility = Mobility::Stationary;
+
     private:
 
         // The mesh resource for this component
         EE_REFLECT() TResourcePtr<StaticMesh>              m_mesh;
+
+        // Cached render matrices, the renderer world system updates all dirty matrices each frame since the renderer is the only user
+        Matrix                                              m_worldMatrix;
+        Matrix                                              m_normalMatrix;
+        bool                                                m_areRenderMatricesDirty = true;
     };
 }
\ No newline at end of file
@@ -0,0 +1,315 @@
+#include "LightClusterGrid.h"
+#include "Base/Math/BoundingVolumes.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    static_assert( LightClusterGrid::s_maxLights <= 0xFFFF, "Cluster scratch light lists use 16bit indices" );
+    static_assert( LightClusterGrid::s_numClustersX % 4 == 0, "Cluster columns are tested four at a time" );
+
+    //-------------------------------------------------------------------------
+
+    void LightClusterGrid::Build( Math::ViewVolume const& viewVolume, TVector<LightBounds> const& lights, TaskSystem* pTaskSystem )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        // Set up view parameters
+        //-------------------------------------------------------------------------
+
+        FloatRange const depthRange = viewVolume.GetDepthRange();
+        m_isPerspective = viewVolume.IsPerspective();
+        m_nearDepth = Math::Max( depthRange.m_begin, 0.01f );
+        m_farDepth = Math::Max( depthRange.m_end, m_nearDepth + 1.0f );
+
+        float const logDepthRange = Math::Log2( m_farDepth / m_nearDepth );
+        m_depthSliceScale = float( s_numClustersZ ) / logDepthRange;
+        m_depthSliceBias = -float( s_numClustersZ ) * Math::Log2( m_nearDepth ) / logDepthRange;
+
+        // Calculated from the FOV rather than the near plane, since the near plane depth can be zero
+        if ( m_isPerspective )
+        {
+            float const halfExtentY = Math::Tan( (float) viewVolume.GetVerticalFOV() * 0.5f );
+            m_tileHalfExtentsAtUnitDepth = Float2( halfExtentY * viewVolume.GetAspectRatio(), halfExtentY );
+        }
+        else
+        {
+            m_tileHalfExtentsAtUnitDepth = viewVolume.GetViewDimensions() * 0.5f;
+        }
+
+        // Cull lights and transform them into view space
+        //-------------------------------------------------------------------------
+
+        Vector const viewPosition = viewVolume.GetViewPosition();
+        Vector const viewRight = viewVolume.GetViewRightVector();
+        Vector const viewUp = viewVolume.GetViewUpVector();
+        Vector const viewForward = viewVolume.GetViewForwardVector();
+
+        m_viewSpaceLights.clear();
+        m_viewSpaceLights.reserve( lights.size() );
+
+        uint32_t const numLights = (uint32_t) lights.size();
+        for ( uint32_t i = 0; i < numLights; i++ )
+        {
+            LightBounds const& light = lights[i];
+            if ( light.m_radius <= 0.0f || light.m_intensity <= 0.0f )
+            {
+                continue;
+            }
+
+            if ( !viewVolume.Contains( AABB( light.m_position, light.m_radius ) ) )
+            {
+                continue;
+            }
+
+            Vector const delta = light.m_position - viewPosition;
+
+            ViewSpaceLight& viewSpaceLight = m_viewSpaceLights.emplace_back();
+            viewSpaceLight.m_position = Vector( delta.GetDot3( viewRight ), delta.GetDot3( viewUp ), delta.GetDot3( viewForward ), 0.0f );
+            viewSpaceLight.m_direction = Vector( light.m_direction.GetDot3( viewRight ), light.m_direction.GetDot3( viewUp ), light.m_direction.GetDot3( viewForward ), 0.0f );
+            viewSpaceLight.m_radius = light.m_radius;
+            viewSpaceLight.m_cosOuterAngle = light.m_cosOuterAngle;
+            viewSpaceLight.m_sinOuterAngle = light.m_sinOuterAngle;
+            viewSpaceLight.m_lightIdx = i;
+
+            // Lights are fully relevant when the view is within their radius and fall off with the squared distance outside of it
+            float const radiusSq = light.m_radius * light.m_radius;
+            viewSpaceLight.m_relevance = light.m_intensity * radiusSq / Math::Max( delta.GetLengthSquared3(), radiusSq );
+        }
+
+        // Select the most relevant lights
+        //-------------------------------------------------------------------------
+
+        auto SortPredicate = [] ( ViewSpaceLight const& a, ViewSpaceLight const& b )
+        {
+            if ( a.m_relevance != b.m_relevance )
+            {
+                return a.m_relevance > b.m_relevance;
+            }
+
+            return a.m_lightIdx < b.m_lightIdx;
+        };
+
+        eastl::sort( m_viewSpaceLights.begin(), m_viewSpaceLights.end(), SortPredicate );
+
+        if ( m_viewSpaceLights.size() > s_maxLights )
+        {
+            m_viewSpaceLights.resize( s_maxLights );
+        }
+
+        m_selectedLights.resize( m_viewSpaceLights.size() );
+        for ( uint32_t i = 0; i < (uint32_t) m_viewSpaceLights.size(); i++ )
+        {
+            m_selectedLights[i] = m_viewSpaceLights[i].m_lightIdx;
+        }
+
+        // Assign lights to clusters
+        //-------------------------------------------------------------------------
+
+        m_clusterLightCounts.clear();
+        m_clusterLightCounts.resize( s_numClusters, 0 );
+        m_clusterLightScratch.resize( s_numClusters * s_maxLightsPerCluster );
+
+        if ( !m_viewSpaceLights.empty() )
+        {
+            if ( pTaskSystem != nullptr )
+            {
+                AsyncTask assignmentTask( s_numClustersZ, [this] ( TaskSetPartition range, uint32_t threadnum )
+                {
+                    for ( uint32_t sliceIdx = range.start; sliceIdx < range.end; sliceIdx++ )
+                    {
+                        AssignLightsToSlice( sliceIdx );
+                    }
+                } );
+                assignmentTask.m_MinRange = 1;
+
+                pTaskSystem->ScheduleTask( &assignmentTask );
+                pTaskSystem->WaitForTask( &assignmentTask );
+            }
+            else
+            {
+                for ( uint32_t sliceIdx = 0; sliceIdx < s_numClustersZ; sliceIdx++ )
+                {
+                    AssignLightsToSlice( sliceIdx );
+                }
+            }
+        }
+
+        // Compact cluster light lists
+        //-------------------------------------------------------------------------
+
+        m_clusters.resize( s_numClusters );
+        m_lightIndices.clear();
+
+        for ( uint32_t clusterIdx = 0; clusterIdx < s_numClusters; clusterIdx++ )
+        {
+            Cluster& cluster = m_clusters[clusterIdx];
+            cluster.m_lightOffset = (uint32_t) m_lightIndices.size();
+            cluster.m_numLights = m_clusterLightCounts[clusterIdx];
+
+            uint16_t const* pClusterLights = &m_clusterLightScratch[clusterIdx * s_maxLightsPerCluster];
+            m_lightIndices.insert( m_lightIndices.end(), pClusterLights, pClusterLights + cluster.m_numLights );
+        }
+    }
+
+    void LightClusterGrid::AssignLightsToSlice( uint32_t sliceIdx )
+    {
+        float const sliceNear = ( sliceIdx == 0 ) ? m_nearDepth : Math::Pow( 2.0f, ( float( sliceIdx ) - m_depthSliceBias ) / m_depthSliceScale );
+        float const sliceFar = ( sliceIdx == s_numClustersZ - 1 ) ? m_farDepth : Math::Pow( 2.0f, ( float( sliceIdx + 1 ) - m_depthSliceBias ) / m_depthSliceScale );
+
+        // Calculate the view space extents of each tile column/row over the depth range of this slice
+        //-------------------------------------------------------------------------
+
+        float const horizontalScaleNear = m_isPerspective ? m_tileHalfExtentsAtUnitDepth.m_x * sliceNear : m_tileHalfExtentsAtUnitDepth.m_x;
+        float const horizontalScaleFar = m_isPerspective ? m_tileHalfExtentsAtUnitDepth.m_x * sliceFar : m_tileHalfExtentsAtUnitDepth.m_x;
+        float const verticalScaleNear = m_isPerspective ? m_tileHalfExtentsAtUnitDepth.m_y * sliceNear : m_tileHalfExtentsAtUnitDepth.m_y;
+        float const verticalScaleFar = m_isPerspective ? m_tileHalfExtentsAtUnitDepth.m_y * sliceFar : m_tileHalfExtentsAtUnitDepth.m_y;
+
+        float tileMinX[s_numClustersX], tileMaxX[s_numClustersX];
+        for ( uint32_t x = 0; x < s_numClustersX; x++ )
+        {
+            float const ndcMin = ( float( x ) / s_numClustersX ) * 2.0f - 1.0f;
+            float const ndcMax = ( float( x + 1 ) / s_numClustersX ) * 2.0f - 1.0f;
+            tileMinX[x] = Math::Min( ndcMin * horizontalScaleNear, ndcMin * horizontalScaleFar );
+            tileMaxX[x] = Math::Max( ndcMax * horizontalScaleNear, ndcMax * horizontalScaleFar );
+        }
+
+        // Rows are top to bottom
+        float tileMinY[s_numClustersY], tileMaxY[s_numClustersY];
+        for ( uint32_t y = 0; y < s_numClustersY; y++ )
+        {
+            float const ndcMax = 1.0f - ( float( y ) / s_numClustersY ) * 2.0f;
+            float const ndcMin = 1.0f - ( float( y + 1 ) / s_numClustersY ) * 2.0f;
+            tileMinY[y] = Math::Min( ndcMin * verticalScaleNear, ndcMin * verticalScaleFar );
+            tileMaxY[y] = Math::Max( ndcMax * verticalScaleNear, ndcMax * verticalScaleFar );
+        }
+
+        //-------------------------------------------------------------------------
+
+        uint32_t* pSliceLightCounts = &m_clusterLightCounts[sliceIdx * s_numClustersPerSlice];
+        uint16_t* pSliceLights = &m_clusterLightScratch[sliceIdx * s_numClustersPerSlice * s_maxLightsPerCluster];
+
+        uint32_t const numLights = (uint32_t) m_viewSpaceLights.size();
+        for ( uint32_t lightIdx = 0; lightIdx < numLights; lightIdx++ )
+        {
+            ViewSpaceLight const& light = m_viewSpaceLights[lightIdx];
+            float const lightDepth = light.m_position.GetZ();
+            if ( lightDepth + light.m_radius < sliceNear || lightDepth - light.m_radius > sliceFar )
+            {
+                continue;
+            }
+
+            // Conservative tile range - project the lateral extents of the sphere at the near and far depth of the overlap
+            //-------------------------------------------------------------------------
+
+            float const overlapNear = Math::Max( sliceNear, lightDepth - light.m_radius );
+            float const overlapFar = Math::Min( sliceFar, lightDepth + light.m_radius );
+
+            float const lightMinX = light.m_position.GetX() - light.m_radius;
+            float const lightMaxX = light.m_position.GetX() + light.m_radius;
+            float const lightMinY = light.m_position.GetY() - light.m_radius;
+            float const lightMaxY = light.m_position.GetY() + light.m_radius;
+
+            float ndcMinX, ndcMaxX, ndcMinY, ndcMaxY;
+            if ( m_isPerspective )
+            {
+                ndcMinX = Math::Min( lightMinX / overlapNear, lightMinX / overlapFar ) / m_tileHalfExtentsAtUnitDepth.m_x;
+                ndcMaxX = Math::Max( lightMaxX / overlapNear, lightMaxX / overlapFar ) / m_tileHalfExtentsAtUnitDepth.m_x;
+                ndcMinY = Math::Min( lightMinY / overlapNear, lightMinY / overlapFar ) / m_tileHalfExtentsAtUnitDepth.m_y;
+                ndcMaxY = Math::Max( lightMaxY / overlapNear, lightMaxY / overlapFar ) / m_tileHalfExtentsAtUnitDepth.m_y;
+            }
+            else
+            {
+                ndcMinX = lightMinX / m_tileHalfExtentsAtUnitDepth.m_x;
+                ndcMaxX = lightMaxX / m_tileHalfExtentsAtUnitDepth.m_x;
+                ndcMinY = lightMinY / m_tileHalfExtentsAtUnitDepth.m_y;
+                ndcMaxY = lightMaxY / m_tileHalfExtentsAtUnitDepth.m_y;
+            }
+
+            if ( ndcMaxX < -1.0f || ndcMinX > 1.0f || ndcMaxY < -1.0f || ndcMinY > 1.0f )
+            {
+                continue;
+            }
+
+            auto NdcToTile = [] ( float ndc, float numTiles ) { return (uint32_t) Math::Clamp( Math::Floor( ( ndc * 0.5f + 0.5f ) * numTiles ), 0.0f, numTiles - 1.0f ); };
+            uint32_t const startX = NdcToTile( ndcMinX, s_numClustersX );
+            uint32_t const endX = NdcToTile( ndcMaxX, s_numClustersX );
+            uint32_t const startY = ( s_numClustersY - 1 ) - NdcToTile( ndcMaxY, s_numClustersY );
+            uint32_t const endY = ( s_numClustersY - 1 ) - NdcToTile( ndcMinY, s_numClustersY );
+
+            // Exact tests against the cluster bounds
+            //-------------------------------------------------------------------------
+            // The sphere vs AABB test is done for four tile columns at once, the Y and Z distances are shared by the whole row.
+            // The cone test is only needed for the few clusters that pass the sphere test so it is done per cluster.
+
+            float const radiusSq = light.m_radius * light.m_radius;
+            bool const isSpotLight = light.m_cosOuterAngle > -1.0f;
+
+            Vector const lightX( light.m_position.GetX() );
+            float const lightY = light.m_position.GetY();
+            float const distanceZ = Math::Clamp( lightDepth, sliceNear, sliceFar ) - lightDepth;
+
+            for ( uint32_t y = startY; y <= endY; y++ )
+            {
+                float const distanceY = Math::Clamp( lightY, tileMinY[y], tileMaxY[y] ) - lightY;
+                float const remainingRadiusSq = radiusSq - distanceY * distanceY - distanceZ * distanceZ;
+                if ( remainingRadiusSq < 0.0f )
+                {
+                    continue;
+                }
+
+                for ( uint32_t groupStartX = startX & ~3u; groupStartX <= endX; groupStartX += 4 )
+                {
+                    // Sphere vs AABB
+                    Vector const distanceX = Vector::Max( Vector::Max( Vector( &tileMinX[groupStartX] ) - lightX, lightX - Vector( &tileMaxX[groupStartX] ) ), Vector::Zero );
+                    uint32_t const overlapMask = (uint32_t) _mm_movemask_ps( ( distanceX * distanceX ).LessThanEqual( Vector( remainingRadiusSq ) ) );
+                    if ( overlapMask == 0 )
+                    {
+                        continue;
+                    }
+
+                    for ( uint32_t x = Math::Max( groupStartX, startX ); x <= Math::Min( groupStartX + 3, endX ); x++ )
+                    {
+                        if ( ( overlapMask & ( 1u << ( x - groupStartX ) ) ) == 0 )
+                        {
+                            continue;
+                        }
+
+                        uint32_t const clusterIdx = y * s_numClustersX + x;
+                        if ( pSliceLightCounts[clusterIdx] == s_maxLightsPerCluster )
+                        {
+                            continue;
+                        }
+
+                        // Cone vs cluster bounding sphere
+                        if ( isSpotLight )
+                        {
+                            Vector const clusterMin( tileMinX[x], tileMinY[y], sliceNear, 0.0f );
+                            Vector const clusterMax( tileMaxX[x], tileMaxY[y], sliceFar, 0.0f );
+
+                            Vector const clusterCenter = ( clusterMin + clusterMax ) * Vector::Half;
+                            float const clusterRadius = ( clusterMax - clusterMin ).GetLength3() * 0.5f;
+
+                            Vector const lightToCluster = clusterCenter - light.m_position;
+                            float const distanceSq = lightToCluster.GetLengthSquared3();
+                            float const distanceAlongAxis = lightToCluster.GetDot3( light.m_direction );
+                            float const distanceToAxis = Math::Sqrt( Math::Max( distanceSq - distanceAlongAxis * distanceAlongAxis, 0.0f ) );
+                            float const distanceToCone = light.m_cosOuterAngle * distanceToAxis - distanceAlongAxis * light.m_sinOuterAngle;
+
+                            if ( distanceToCone > clusterRadius || distanceAlongAxis > clusterRadius + light.m_radius || distanceAlongAxis < -clusterRadius )
+                            {
+                                continue;
+                            }
+                        }
+
+                        uint32_t& clusterLightCount = pSliceLightCounts[clusterIdx];
+                        pSliceLights[clusterIdx * s_maxLightsPerCluster + clusterLightCount] = (uint16_t) lightIdx;
+                        clusterLightCount++;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Math/ViewVolume.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    class TaskSystem;
+}
+
+//-------------------------------------------------------------------------
+// Clustered light assignment
+//-------------------------------------------------------------------------
+// Bins punctual lights into a view-space grid of clusters (screen tiles x exponentially distributed depth slices)
+// so that each pixel only needs to consider the lights that can actually affect it.
+//
+// Lights are culled against the view volume and sorted by relevance, only the most relevant 's_maxLights' are kept.
+// Since lights are assigned in relevance order, any cluster overflow will drop the least relevant lights.
+
+namespace EE::Render
+{
+    class EE_ENGINE_API LightClusterGrid
+    {
+    public:
+
+        constexpr static uint32_t const s_numClustersX = 16;
+        constexpr static uint32_t const s_numClustersY = 9;
+        constexpr static uint32_t const s_numClustersZ = 24;
+        constexpr static uint32_t const s_numClustersPerSlice = s_numClustersX * s_numClustersY;
+        constexpr static uint32_t const s_numClusters = s_numClustersPerSlice * s_numClustersZ;
+        constexpr static uint32_t const s_maxLightsPerCluster = 64;
+        constexpr static uint32_t const s_maxLights = 1024;
+
+        // The world space bounds of a light, spot lights also provide their cone
+        struct LightBounds
+        {
+            Vector          m_position;                     // World space position
+            Vector          m_direction = Vector::Zero;     // World space emission direction (spot lights only)
+            float           m_radius = 0.0f;
+            float           m_cosOuterAngle = -1.0f;        // Cosine of the outer cone angle, -1 for point lights
+            float           m_sinOuterAngle = 0.0f;
+            float           m_intensity = 0.0f;             // The brightest channel of the light color multiplied by the intensity
+        };
+
+        // The range of the light index list for a cluster
+        struct Cluster
+        {
+            uint32_t        m_lightOffset = 0;
+            uint32_t        m_numLights = 0;
+        };
+
+    public:
+
+        // Cull, select and assign the supplied lights to the clusters for the specified view
+        // If a task system is supplied, the assignment will be split across the worker threads by depth slice
+        void Build( Math::ViewVolume const& viewVolume, TVector<LightBounds> const& lights, TaskSystem* pTaskSystem = nullptr );
+
+        // The indices (into the light list supplied to build) of the lights that were selected, the cluster light lists index into this list
+        inline TVector<uint32_t> const& GetSelectedLights() const { return m_selectedLights; }
+
+        // The light ranges for each cluster, indexed by ( z * s_numClustersY + y ) * s_numClustersX + x
+        inline TVector<Cluster> const& GetClusters() const { return m_clusters; }
+
+        // The compacted per-cluster light lists
+        inline TVector<uint32_t> const& GetLightIndices() const { return m_lightIndices; }
+
+        // Get the parameters needed to calculate the depth slice from a view depth: slice = log( depth ) * scale + bias
+        inline Float2 GetDepthSliceParameters() const { return Float2( m_depthSliceScale, m_depthSliceBias ); }
+
+    private:
+
+        struct ViewSpaceLight
+        {
+            Vector          m_position;                     // View space position (x = right, y = up, z = depth)
+            Vector          m_direction;                    // View space emission direction
+            float           m_radius;
+            float           m_cosOuterAngle;
+            float           m_sinOuterAngle;
+            float           m_relevance;
+            uint32_t        m_lightIdx;
+        };
+
+        void AssignLightsToSlice( uint32_t sliceIdx );
+
+    private:
+
+        // View
+        float                                   m_nearDepth = 0.0f;
+        float                                   m_farDepth = 0.0f;
+        float                                   m_depthSliceScale = 0.0f;
+        float                                   m_depthSliceBias = 0.0f;
+        Float2                                  m_tileHalfExtentsAtUnitDepth = Float2::Zero;     // The view half extents (at unit depth for perspective views)
+        bool                                    m_isPerspective = true;
+
+        // Lights
+        TVector<ViewSpaceLight>                 m_viewSpaceLights;
+        TVector<uint32_t>                       m_selectedLights;
+
+        // Assignment
+        TVector<uint16_t>                       m_clusterLightScratch;
+        TVector<uint32_t>                       m_clusterLightCounts;
+        TVector<Cluster>                        m_clusters;
+        TVector<uint32_t>                       m_lightIndices;
+    };
+}
@@ -11,25 +11,25 @@
 #include "Engine/Entity/EntityWorld.h"
 #include "Base/Render/RenderCoreResources.h"
 #include "Base/Render/RenderViewport.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/Profiling.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Render
 {
-    static Matrix ComputeShadowMatrix( Viewport const& viewport, Transform const& lightWorldTransform, float shadowDistance )
+    // Calculates the orthographic light volume that covers the specified depth range of the view
+    // The volume is extruded towards the light so that it includes any casters between the light and the view
+    static Math::ViewVolume ComputeShadowVolume( Viewport const& viewport, Transform const& lightWorldTransform, FloatRange const& depthRange, float casterExtrusionDistance )
     {
         Transform lightTransform = lightWorldTransform;
         lightTransform.SetTranslation( Vector::Zero );
         Transform const invLightTransform = lightTransform.GetInverse();
 
-        // Get a modified camera view volume that has the shadow distance as the z far.
+        // Get a modified camera view volume that has the cascade range as its depth range.
         // This will get us the appropriate corners to translate into light space.
-
-        // To make these cascade, you do this in a loop and move the depth range along by your
-        // cascade distance.
         EE::Math::ViewVolume camVolume = viewport.GetViewVolume();
-        camVolume.SetDepthRange( FloatRange( 1.0f, shadowDistance ) );
+        camVolume.SetDepthRange( depthRange );
 
         Math::ViewVolume::VolumeCorners corners = camVolume.GetCorners();
 
@@ -49,6 +49,9 @@ namespace EE::Render
             cornersMax = Vector::Max( cornersMax, corners.m_points[i] );
         }
 
+        // Extrude the "back" of the box towards the light
+        cornersMax += Vector( 0.0f, casterExtrusionDistance, 0.0f, 0.0f );
+
         Vector lightPosition = Vector::Lerp( cornersMin, cornersMax, 0.5f );
         lightPosition = Vector::Select( lightPosition, cornersMax, Vector::Select0100 ); //force lightPosition to the "back" of the box.
         lightPosition = lightTransform.TransformPoint( lightPosition );   //Light position now in world space.
@@ -56,21 +59,35 @@ namespace EE::Render
 
         Float3 const delta = ( cornersMax - cornersMin ).ToFloat3();
         float dim = Math::Max( delta.m_x, delta.m_z );
-        Math::ViewVolume lightViewVolume( Float2( dim ), FloatRange( 1.0, delta.m_y ), lightTransform.ToMatrix() );
+        return Math::ViewVolume( Float2( dim ), FloatRange( 1.0, delta.m_y ), lightTransform.ToMatrix() ); // TODO: inverse z???
+    }
 
-        Matrix viewProjMatrix = lightViewVolume.GetViewProjectionMatrix();
-        Matrix viewMatrix = lightViewVolume.GetViewMatrix();
-        Matrix projMatrix = lightViewVolume.GetProjectionMatrix();
-        Matrix viewProj = lightViewVolume.GetViewProjectionMatrix(); // TODO: inverse z???
-        return viewProj;
+    // Static mesh components cache their render matrices since they rarely move
+    EE_FORCE_INLINE static void GetRenderMatrices( StaticMeshComponent const* pMeshComponent, Matrix& outWorldMatrix, Matrix& outNormalMatrix )
+    {
+        outWorldMatrix = pMeshComponent->GetWorldMatrix();
+        outNormalMatrix = pMeshComponent->GetNormalMatrix();
+    }
+
+    static void GetRenderMatrices( SkeletalMeshComponent const* pMeshComponent, Matrix& outWorldMatrix, Matrix& outNormalMatrix )
+    {
+        outWorldMatrix = pMeshComponent->GetWorldTransform().ToMatrix();
+        outNormalMatrix = outWorldMatrix.GetInverse().Transpose();
+    }
+
+    // Pointer bits make for a cheap state ID that is stable for the frame, collisions only result in some redundant state changes
+    EE_FORCE_INLINE static uint64_t GetStateKeyBits( void const* pState )
+    {
+        return ( ( (uintptr_t) pState ) >> 4 ) & 0xFFFFFF;
     }
 
     //-------------------------------------------------------------------------
 
-    bool WorldRenderer::Initialize( RenderDevice* pRenderDevice )
+    bool WorldRenderer::Initialize( RenderDevice* pRenderDevice, TaskSystem* pTaskSystem )
     {
         EE_ASSERT( m_pRenderDevice == nullptr && pRenderDevice != nullptr );
         m_pRenderDevice = pRenderDevice;
+        m_pTaskSystem = pTaskSystem;
 
         TVector<RenderBuffer> cbuffers;
         RenderBuffer buffer;
@@ -113,6 +130,74 @@ namespace EE::Render
             return false;
         }
 
+        // Create Instanced Static Mesh Vertex Shader
+        //-------------------------------------------------------------------------
+
+        cbuffers.clear();
+
+        // Transform const buffer - only the view projection transform is used, the per-instance transforms come from the instance buffer
+        buffer.m_byteSize = sizeof( ObjectTransforms );
+        buffer.m_byteStride = sizeof( Matrix ); // Vector4 aligned
+        buffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        buffer.m_type = RenderBuffer::Type::Constant;
+        buffer.m_slot = 0;
+        cbuffers.push_back( buffer );
+
+        // Batch const buffer
+        buffer.m_byteSize = sizeof( InstanceBatchData );
+        buffer.m_byteStride = sizeof( InstanceBatchData );
+        buffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        buffer.m_type = RenderBuffer::Type::Constant;
+        buffer.m_slot = 1;
+        cbuffers.push_back( buffer );
+
+        m_vertexShaderStaticInstanced = VertexShader( g_byteCode_VS_StaticPrimitiveInstanced, sizeof( g_byteCode_VS_StaticPrimitiveInstanced ), cbuffers, vertexLayoutDescStatic );
+        m_pRenderDevice->CreateShader( m_vertexShaderStaticInstanced );
+
+        if ( !m_vertexShaderStaticInstanced.IsValid() )
+        {
+            return false;
+        }
+
+        // Per-instance transforms, grown on demand
+        m_instanceTransformBuffer.m_byteSize = sizeof( ComponentTransforms ) * s_initialInstanceBufferCapacity;
+        m_instanceTransformBuffer.m_byteStride = sizeof( ComponentTransforms );
+        m_instanceTransformBuffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        m_instanceTransformBuffer.m_type = RenderBuffer::Type::Structured;
+        m_pRenderDevice->CreateBuffer( m_instanceTransformBuffer );
+
+        if ( !m_instanceTransformBuffer.IsValid() )
+        {
+            return false;
+        }
+
+        // Create Clustered Lighting Buffers
+        //-------------------------------------------------------------------------
+
+        m_punctualLightBuffer.m_byteSize = sizeof( PunctualLight ) * LightClusterGrid::s_maxLights;
+        m_punctualLightBuffer.m_byteStride = sizeof( PunctualLight );
+        m_punctualLightBuffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        m_punctualLightBuffer.m_type = RenderBuffer::Type::Structured;
+        m_pRenderDevice->CreateBuffer( m_punctualLightBuffer );
+
+        m_lightClusterBuffer.m_byteSize = sizeof( LightClusterGrid::Cluster ) * LightClusterGrid::s_numClusters;
+        m_lightClusterBuffer.m_byteStride = sizeof( LightClusterGrid::Cluster );
+        m_lightClusterBuffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        m_lightClusterBuffer.m_type = RenderBuffer::Type::Structured;
+        m_pRenderDevice->CreateBuffer( m_lightClusterBuffer );
+
+        // Light index list, grown on demand
+        m_lightIndexBuffer.m_byteSize = sizeof( uint32_t ) * LightClusterGrid::s_numClusters;
+        m_lightIndexBuffer.m_byteStride = sizeof( uint32_t );
+        m_lightIndexBuffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        m_lightIndexBuffer.m_type = RenderBuffer::Type::Structured;
+        m_pRenderDevice->CreateBuffer( m_lightIndexBuffer );
+
+        if ( !m_punctualLightBuffer.IsValid() || !m_lightClusterBuffer.IsValid() || !m_lightIndexBuffer.IsValid() )
+        {
+            return false;
+        }
+
         // Create Skybox Vertex Shader
         //-------------------------------------------------------------------------
 
@@ -282,6 +367,12 @@ namespace EE::Render
             return false;
         }
 
+        m_pRenderDevice->CreateShaderInputBinding( m_vertexShaderStaticInstanced, vertexLayoutDescStatic, m_inputBindingStaticInstanced );
+        if ( !m_inputBindingStaticInstanced.IsValid() )
+        {
+            return false;
+        }
+
         m_pRenderDevice->CreateShaderInputBinding( m_vertexShaderSkeletal, vertexLayoutDescSkeletal, m_inputBindingSkeletal );
         if ( !m_inputBindingSkeletal.IsValid() )
         {
@@ -299,6 +390,9 @@ namespace EE::Render
         m_pipelineStateStaticPicking = m_pipelineStateStatic;
         m_pipelineStateStaticPicking.m_pPixelShader = &m_pixelShaderPicking;
 
+        m_pipelineStateStaticInstanced = m_pipelineStateStatic;
+        m_pipelineStateStaticInstanced.m_pVertexShader = &m_vertexShaderStaticInstanced;
+
         m_pipelineStateSkeletal.m_pVertexShader = &m_vertexShaderSkeletal;
         m_pipelineStateSkeletal.m_pPixelShader = &m_pixelShader;
         m_pipelineStateSkeletal.m_pBlendState = &m_blendState;
@@ -324,7 +418,7 @@ namespace EE::Render
         m_pipelinePrecomputeBRDF.m_pComputeShader = &m_precomputeDFGComputeShader;
 
         // TODO create on directional light add and destroy on remove
-        m_pRenderDevice->CreateTexture( m_shadowMap, DataFormat::Float_X32, Float2( 1536, 1536 ), USAGE_SRV | USAGE_RT_DS );
+        m_pRenderDevice->CreateTexture( m_shadowMap, DataFormat::Float_X32, Float2( (float) s_shadowCascadeResolution * 2 ), USAGE_SRV | USAGE_RT_DS );
 
         {
             auto const& renderContext = m_pRenderDevice->GetImmediateContext();
@@ -341,6 +435,7 @@ namespace EE::Render
     void WorldRenderer::Shutdown()
     {
         m_pipelineStateStatic.Clear();
+        m_pipelineStateStaticInstanced.Clear();
         m_pipelineStateSkeletal.Clear();
 
         if ( m_inputBindingStatic.IsValid() )
@@ -348,6 +443,11 @@ namespace EE::Render
             m_pRenderDevice->DestroyShaderInputBinding( m_inputBindingStatic );
         }
 
+        if ( m_inputBindingStaticInstanced.IsValid() )
+        {
+            m_pRenderDevice->DestroyShaderInputBinding( m_inputBindingStaticInstanced );
+        }
+
         if ( m_inputBindingSkeletal.IsValid() )
         {
             m_pRenderDevice->DestroyShaderInputBinding( m_inputBindingSkeletal );
@@ -383,11 +483,36 @@ namespace EE::Render
             m_pRenderDevice->DestroyShader( m_vertexShaderStatic );
         }
 
+        if ( m_vertexShaderStaticInstanced.IsValid() )
+        {
+            m_pRenderDevice->DestroyShader( m_vertexShaderStaticInstanced );
+        }
+
         if ( m_vertexShaderSkeletal.IsValid() )
         {
             m_pRenderDevice->DestroyShader( m_vertexShaderSkeletal );
         }
 
+        if ( m_instanceTransformBuffer.IsValid() )
+        {
+            m_pRenderDevice->DestroyBuffer( m_instanceTransformBuffer );
+        }
+
+        if ( m_punctualLightBuffer.IsValid() )
+        {
+            m_pRenderDevice->DestroyBuffer( m_punctualLightBuffer );
+        }
+
+        if ( m_lightClusterBuffer.IsValid() )
+        {
+            m_pRenderDevice->DestroyBuffer( m_lightClusterBuffer );
+        }
+
+        if ( m_lightIndexBuffer.IsValid() )
+        {
+            m_pRenderDevice->DestroyBuffer( m_lightIndexBuffer );
+        }
+
         if ( m_pixelShader.IsValid() )
         {
             m_pRenderDevice->DestroyShader( m_pixelShader );
@@ -428,7 +553,15 @@ namespace EE::Render
             m_pRenderDevice->DestroyShader( m_pixelShaderPicking );
         }
 
+        m_componentTransforms.clear();
+        m_drawPacketOffsets.clear();
+        m_drawPackets.clear();
+        m_drawPacketSortBuffer.clear();
+        m_lightBounds.clear();
+        m_punctualLights.clear();
+
         m_pRenderDevice = nullptr;
+        m_pTaskSystem = nullptr;
         m_initialized = false;
     }
 
@@ -517,6 +650,313 @@ namespace EE::Render
             renderContext.SetShaderResource( PipelineStage::Pixel, 11, CoreResources::GetMissingTexture()->GetShaderResourceView() );
             renderContext.SetShaderResource( PipelineStage::Pixel, 12, ViewSRVHandle{} ); // TODO: fix add default cubemap resource
         }
+
+        // Clustered lights
+        renderContext.SetShaderResource( PipelineStage::Pixel, 13, m_punctualLightBuffer.GetShaderResourceView() );
+        renderContext.SetShaderResource( PipelineStage::Pixel, 14, m_lightClusterBuffer.GetShaderResourceView() );
+        renderContext.SetShaderResource( PipelineStage::Pixel, 15, m_lightIndexBuffer.GetShaderResourceView() );
+    }
+
+    void WorldRenderer::UpdateLightClusters( Viewport const& viewport, RendererWorldSystem const* pWorldSystem, LightData& lightData )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        // Gather all punctual lights
+        //-------------------------------------------------------------------------
+
+        m_lightBounds.clear();
+        m_punctualLights.clear();
+
+        for ( PointLightComponent const* pPointLightComponent : pWorldSystem->m_registeredPointLightComponents )
+        {
+            Float4 const color = pPointLightComponent->GetLightColor().ToFloat4();
+
+            PunctualLight& light = m_punctualLights.emplace_back();
+            light.m_positionInvRadiusSqr = pPointLightComponent->GetLightPosition();
+            light.m_positionInvRadiusSqr.SetW( Math::Sqr( 1.0f / pPointLightComponent->GetLightRadius() ) );
+            light.m_dir = Vector::Zero;
+            light.m_color = Vector( color ) * pPointLightComponent->GetLightIntensity();
+            light.m_spotAngles = Vector( -1.0f, 1.0f, 0.0f );
+
+            LightClusterGrid::LightBounds& bounds = m_lightBounds.emplace_back();
+            bounds.m_position = pPointLightComponent->GetLightPosition();
+            bounds.m_radius = pPointLightComponent->GetLightRadius();
+            bounds.m_intensity = Math::Max( color.m_x, Math::Max( color.m_y, color.m_z ) ) * pPointLightComponent->GetLightIntensity();
+        }
+
+        for ( SpotLightComponent const* pSpotLightComponent : pWorldSystem->m_registeredSpotLightComponents )
+        {
+            Float4 const color = pSpotLightComponent->GetLightColor().ToFloat4();
+
+            Radians innerAngle = pSpotLightComponent->GetLightInnerUmbraAngle().ToRadians();
+            Radians outerAngle = pSpotLightComponent->GetLightOuterUmbraAngle().ToRadians();
+            innerAngle.Clamp( 0, Math::PiDivTwo );
+            outerAngle.Clamp( 0, Math::PiDivTwo );
+
+            float cosInner = Math::Cos( (float) innerAngle );
+            float cosOuter = Math::Cos( (float) outerAngle );
+
+            PunctualLight& light = m_punctualLights.emplace_back();
+            light.m_positionInvRadiusSqr = pSpotLightComponent->GetLightPosition();
+            light.m_positionInvRadiusSqr.SetW( Math::Sqr( 1.0f / pSpotLightComponent->GetLightRadius() ) );
+            light.m_dir = -pSpotLightComponent->GetLightDirection();
+            light.m_color = Vector( color ) * pSpotLightComponent->GetLightIntensity();
+            light.m_spotAngles = Vector( cosOuter, 1.0f / Math::Max( cosInner - cosOuter, 0.001f ), 0.0f );
+
+            LightClusterGrid::LightBounds& bounds = m_lightBounds.emplace_back();
+            bounds.m_position = pSpotLightComponent->GetLightPosition();
+            bounds.m_direction = pSpotLightComponent->GetLightDirection();
+            bounds.m_radius = pSpotLightComponent->GetLightRadius();
+            bounds.m_cosOuterAngle = cosOuter;
+            bounds.m_sinOuterAngle = Math::Sin( (float) outerAngle );
+            bounds.m_intensity = Math::Max( color.m_x, Math::Max( color.m_y, color.m_z ) ) * pSpotLightComponent->GetLightIntensity();
+        }
+
+        // Assign lights to clusters
+        //-------------------------------------------------------------------------
+
+        Math::ViewVolume const& viewVolume = viewport.GetViewVolume();
+        m_lightClusterGrid.Build( viewVolume, m_lightBounds, m_pTaskSystem );
+
+        // Upload
+        //-------------------------------------------------------------------------
+
+        auto const& renderContext = m_pRenderDevice->GetImmediateContext();
+
+        TVector<uint32_t> const& selectedLights = m_lightClusterGrid.GetSelectedLights();
+        if ( !selectedLights.empty() )
+        {
+            auto pLights = (PunctualLight*) renderContext.MapBuffer( m_punctualLightBuffer );
+            for ( uint32_t i = 0; i < (uint32_t) selectedLights.size(); i++ )
+            {
+                pLights[i] = m_punctualLights[selectedLights[i]];
+            }
+            renderContext.UnmapBuffer( m_punctualLightBuffer );
+        }
+
+        TVector<LightClusterGrid::Cluster> const& clusters = m_lightClusterGrid.GetClusters();
+        renderContext.WriteToBuffer( m_lightClusterBuffer, clusters.data(), sizeof( LightClusterGrid::Cluster ) * clusters.size() );
+
+        TVector<uint32_t> const& lightIndices = m_lightClusterGrid.GetLightIndices();
+        if ( !lightIndices.empty() )
+        {
+            if ( lightIndices.size() > m_lightIndexBuffer.GetNumElements() )
+            {
+                uint32_t const newCapacity = Math::Max( (uint32_t) lightIndices.size(), m_lightIndexBuffer.GetNumElements() * 2 );
+                m_pRenderDevice->ResizeBuffer( m_lightIndexBuffer, newCapacity * sizeof( uint32_t ) );
+            }
+
+            renderContext.WriteToBuffer( m_lightIndexBuffer, lightIndices.data(), sizeof( uint32_t ) * lightIndices.size() );
+        }
+
+        // Set cluster lookup parameters
+        //-------------------------------------------------------------------------
+
+        Float2 const viewportTopLeft( viewport.GetTopLeftPosition() );
+        Float2 const viewportDimensions( viewport.GetDimensions() );
+        Float2 const depthSliceParameters = m_lightClusterGrid.GetDepthSliceParameters();
+
+        lightData.m_numPunctualLights = (uint32_t) selectedLights.size();
+        lightData.m_viewPosition = viewVolume.GetViewPosition();
+        lightData.m_viewForward = viewVolume.GetViewForwardVector();
+        lightData.m_clusterScreenParams = Float4( viewportTopLeft.m_x, viewportTopLeft.m_y, LightClusterGrid::s_numClustersX / viewportDimensions.m_x, LightClusterGrid::s_numClustersY / viewportDimensions.m_y );
+        lightData.m_clusterDepthParams = Float4( depthSliceParameters.m_x, depthSliceParameters.m_y, 0.0f, 0.0f );
+    }
+
+    template<typename T>
+    void WorldRenderer::BuildDrawPackets( TVector<T const*> const& components, bool isComponentMajor )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        uint32_t const numComponents = (uint32_t) components.size();
+        EE_ASSERT( !isComponentMajor || numComponents < ( 1u << 26 ) ); // Component index needs to fit in the 56 bits we sort
+
+        // Calculate the packet range for each component so that we can generate the packets in parallel
+        //-------------------------------------------------------------------------
+
+        m_drawPacketOffsets.resize( numComponents + 1 );
+
+        uint32_t numPackets = 0;
+        for ( uint32_t i = 0; i < numComponents; i++ )
+        {
+            m_drawPacketOffsets[i] = numPackets;
+
+            uint64_t const visibility = components[i]->GetSectionVisibilityMask();
+            uint32_t const numSections = components[i]->GetMesh()->GetNumSections();
+            for ( uint32_t sectionIdx = 0; sectionIdx < numSections; sectionIdx++ )
+            {
+                numPackets += ( visibility & ( 1ull << sectionIdx ) ) ? 1 : 0;
+            }
+        }
+
+        m_drawPacketOffsets[numComponents] = numPackets;
+        m_componentTransforms.resize( numComponents );
+        m_drawPackets.resize( numPackets );
+
+        // Generate transforms and packets
+        //-------------------------------------------------------------------------
+
+        auto GeneratePackets = [this, &components, isComponentMajor] ( uint32_t startIdx, uint32_t endIdx )
+        {
+            for ( uint32_t componentIdx = startIdx; componentIdx < endIdx; componentIdx++ )
+            {
+                T const* pMeshComponent = components[componentIdx];
+
+                ComponentTransforms& transforms = m_componentTransforms[componentIdx];
+                GetRenderMatrices( pMeshComponent, transforms.m_worldTransform, transforms.m_normalTransform );
+
+                Mesh const* pMesh = pMeshComponent->GetMesh();
+                // All sections of a component share its mesh, so for component-major packets the component index replaces the mesh/material ordering
+                uint64_t const meshKey = GetStateKeyBits( pMesh );
+                uint64_t const componentKey = isComponentMajor ? ( uint64_t( componentIdx ) << 30 ) : 0;
+                TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
+                uint64_t const visibility = pMeshComponent->GetSectionVisibilityMask();
+
+                uint32_t packetIdx = m_drawPacketOffsets[componentIdx];
+                uint32_t const numSections = pMesh->GetNumSections();
+                for ( uint32_t sectionIdx = 0; sectionIdx < numSections; sectionIdx++ )
+                {
+                    // Skip hidden sections
+                    if ( ( visibility & ( 1ull << sectionIdx ) ) == 0 )
+                    {
+                        continue;
+                    }
+
+                    DrawPacket& packet = m_drawPackets[packetIdx++];
+                    packet.m_pMaterial = ( sectionIdx < materials.size() ) ? materials[sectionIdx] : nullptr;
+                    packet.m_componentIdx = componentIdx;
+                    packet.m_sectionIdx = sectionIdx;
+                    if ( isComponentMajor )
+                    {
+                        packet.m_sortKey = componentKey | ( GetStateKeyBits( packet.m_pMaterial ) << 6 ) | sectionIdx;
+                    }
+                    else
+                    {
+                        packet.m_sortKey = ( GetStateKeyBits( packet.m_pMaterial ) << 30 ) | ( meshKey << 6 ) | sectionIdx;
+                    }
+                }
+
+                EE_ASSERT( packetIdx == m_drawPacketOffsets[componentIdx + 1] );
+            }
+        };
+
+        if ( m_pTaskSystem != nullptr && numComponents > s_minComponentsPerPacketGenerationTask )
+        {
+            AsyncTask generationTask( numComponents, [&GeneratePackets] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                GeneratePackets( range.start, range.end );
+            } );
+            generationTask.m_MinRange = s_minComponentsPerPacketGenerationTask;
+
+            m_pTaskSystem->ScheduleTask( &generationTask );
+            m_pTaskSystem->WaitForTask( &generationTask );
+        }
+        else
+        {
+            GeneratePackets( 0, numComponents );
+        }
+
+        //-------------------------------------------------------------------------
+
+        SortDrawPackets();
+    }
+
+    void WorldRenderer::SortDrawPackets()
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        uint32_t const numPackets = (uint32_t) m_drawPackets.size();
+        if ( numPackets < 2 )
+        {
+            return;
+        }
+
+        // LSD radix sort (8 bits per pass) over the 56 bit state key (24 bits material, 24 bits mesh, 6 bits section or 26 bits component, 24 bits material, 6 bits section)
+        // This is a stable sort, so packets with the same state remain in scene order
+        constexpr static uint32_t const numPasses = 7;
+
+        m_drawPacketSortBuffer.resize( numPackets );
+
+        for ( uint32_t pass = 0; pass < numPasses; pass++ )
+        {
+            uint32_t const shift = pass * 8;
+
+            uint32_t histogram[256] = { 0 };
+            for ( DrawPacket const& packet : m_drawPackets )
+            {
+                histogram[( packet.m_sortKey >> shift ) & 0xFF]++;
+            }
+
+            // Skip passes where all the packets share the same digit
+            if ( histogram[( m_drawPackets[0].m_sortKey >> shift ) & 0xFF] == numPackets )
+            {
+                continue;
+            }
+
+            uint32_t offset = 0;
+            for ( uint32_t& bucket : histogram )
+            {
+                uint32_t const count = bucket;
+                bucket = offset;
+                offset += count;
+            }
+
+            for ( DrawPacket const& packet : m_drawPackets )
+            {
+                m_drawPacketSortBuffer[histogram[( packet.m_sortKey >> shift ) & 0xFF]++] = packet;
+            }
+
+            m_drawPackets.swap( m_drawPacketSortBuffer );
+        }
+    }
+
+    void WorldRenderer::UploadInstanceTransforms()
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        uint32_t const numInstances = (uint32_t) m_drawPackets.size();
+        if ( numInstances == 0 )
+        {
+            return;
+        }
+
+        // Grow the instance buffer geometrically to avoid recreating it every time the visible set grows slightly
+        if ( numInstances > m_instanceTransformBuffer.GetNumElements() )
+        {
+            uint32_t const newCapacity = Math::Max( numInstances, m_instanceTransformBuffer.GetNumElements() * 2 );
+            m_pRenderDevice->ResizeBuffer( m_instanceTransformBuffer, newCapacity * sizeof( ComponentTransforms ) );
+        }
+
+        //-------------------------------------------------------------------------
+
+        auto const& renderContext = m_pRenderDevice->GetImmediateContext();
+        auto pInstanceTransforms = (ComponentTransforms*) renderContext.MapBuffer( m_instanceTransformBuffer );
+
+        auto WriteInstances = [this, pInstanceTransforms] ( uint32_t startIdx, uint32_t endIdx )
+        {
+            for ( uint32_t instanceIdx = startIdx; instanceIdx < endIdx; instanceIdx++ )
+            {
+                pInstanceTransforms[instanceIdx] = m_componentTransforms[m_drawPackets[instanceIdx].m_componentIdx];
+            }
+        };
+
+        if ( m_pTaskSystem != nullptr && numInstances > s_minInstancesPerUploadTask )
+        {
+            AsyncTask uploadTask( numInstances, [&WriteInstances] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                WriteInstances( range.start, range.end );
+            } );
+            uploadTask.m_MinRange = s_minInstancesPerUploadTask;
+
+            m_pTaskSystem->ScheduleTask( &uploadTask );
+            m_pTaskSystem->WaitForTask( &uploadTask );
+        }
+        else
+        {
+            WriteInstances( 0, numInstances );
+        }
+
+        renderContext.UnmapBuffer( m_instanceTransformBuffer );
     }
 
     void WorldRenderer::RenderStaticMeshes( Viewport const& viewport, RenderTarget const& renderTarget, RenderData const& data )
@@ -525,65 +965,149 @@ namespace EE::Render
 
         auto const& renderContext = m_pRenderDevice->GetImmediateContext();
 
+        // Picking needs per-component data in the pixel shader so we only instance when not picking
+        bool const useInstancing = !renderTarget.HasPickingRT();
+
         // Set primary render state and clear the render buffer
         //-------------------------------------------------------------------------
 
-        PipelineState* pPipelineState = renderTarget.HasPickingRT() ? &m_pipelineStateStaticPicking : &m_pipelineStateStatic;
+        PipelineState* pPipelineState = useInstancing ? &m_pipelineStateStaticInstanced : &m_pipelineStateStaticPicking;
         SetupRenderStates( viewport, pPipelineState->m_pPixelShader, data );
 
         renderContext.SetPipelineState( *pPipelineState );
-        renderContext.SetShaderInputBinding( m_inputBindingStatic );
+        renderContext.SetShaderInputBinding( useInstancing ? m_inputBindingStaticInstanced : m_inputBindingStatic );
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
         //-------------------------------------------------------------------------
 
-        for ( StaticMeshComponent const* pMeshComponent : data.m_staticMeshComponents )
+        BuildDrawPackets( data.m_staticMeshComponents, false );
+
+        // Instanced path - each run of packets with the same material, mesh and section is a single draw
+        //-------------------------------------------------------------------------
+
+        if ( useInstancing )
         {
-            auto pMesh = pMeshComponent->GetMesh();
-            Transform const& worldTransform = pMeshComponent->GetWorldTransform();
-            Vector const finalScale = pMeshComponent->GetLocalScale() * worldTransform.GetScale();
-            Matrix const worldTransformMatrix = Matrix( worldTransform.GetRotation(), worldTransform.GetTranslation(), finalScale );
+            UploadInstanceTransforms();
+
+            renderContext.WriteToBuffer( m_vertexShaderStaticInstanced.GetConstBuffer( 0 ), &data.m_transforms, sizeof( data.m_transforms ) );
+            renderContext.SetShaderResource( PipelineStage::Vertex, 0, m_instanceTransformBuffer.GetShaderResourceView() );
 
-            ObjectTransforms transforms = data.m_transforms;
-            transforms.m_worldTransform = worldTransformMatrix;
-            transforms.m_worldTransform.SetTranslation( worldTransformMatrix.GetTranslation() );
-            transforms.m_normalTransform = transforms.m_worldTransform.GetInverse().Transpose();
-            renderContext.WriteToBuffer( m_vertexShaderStatic.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+            StaticMesh const* pCurrentMesh = nullptr;
+            Material const* pCurrentMaterial = nullptr;
+            bool isMaterialSet = false;
 
-            if ( renderTarget.HasPickingRT() )
+            uint32_t const numPackets = (uint32_t) m_drawPackets.size();
+            uint32_t batchStartIdx = 0;
+            while ( batchStartIdx < numPackets )
             {
-                PickingData const pd( pMeshComponent->GetEntityID().m_value, pMeshComponent->GetID().m_value );
-                renderContext.WriteToBuffer( m_pixelShaderPicking.GetConstBuffer( 2 ), &pd, sizeof( PickingData ) );
+                DrawPacket const& firstPacket = m_drawPackets[batchStartIdx];
+                StaticMesh const* pMesh = data.m_staticMeshComponents[firstPacket.m_componentIdx]->GetMesh();
+
+                // Sort keys can collide so we need to compare the actual state
+                uint32_t batchEndIdx = batchStartIdx + 1;
+                while ( batchEndIdx < numPackets )
+                {
+                    DrawPacket const& packet = m_drawPackets[batchEndIdx];
+                    if ( packet.m_sortKey != firstPacket.m_sortKey || packet.m_pMaterial != firstPacket.m_pMaterial || packet.m_sectionIdx != firstPacket.m_sectionIdx || data.m_staticMeshComponents[packet.m_componentIdx]->GetMesh() != pMesh )
+                    {
+                        break;
+                    }
+
+                    batchEndIdx++;
+                }
+
+                //-------------------------------------------------------------------------
+
+                if ( pMesh != pCurrentMesh )
+                {
+                    pCurrentMesh = pMesh;
+                    renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
+                    renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
+                }
+
+                if ( !isMaterialSet || firstPacket.m_pMaterial != pCurrentMaterial )
+                {
+                    pCurrentMaterial = firstPacket.m_pMaterial;
+                    isMaterialSet = true;
+
+                    if ( pCurrentMaterial != nullptr )
+                    {
+                        SetMaterial( renderContext, *pPipelineState->m_pPixelShader, pCurrentMaterial );
+                    }
+                    else // Use default material
+                    {
+                        SetDefaultMaterial( renderContext, *pPipelineState->m_pPixelShader );
+                    }
+                }
+
+                InstanceBatchData batchData;
+                batchData.m_instanceOffset = batchStartIdx;
+                renderContext.WriteToBuffer( m_vertexShaderStaticInstanced.GetConstBuffer( 1 ), &batchData, sizeof( batchData ) );
+
+                auto const& subMesh = pMesh->GetSection( firstPacket.m_sectionIdx );
+                renderContext.DrawIndexedInstanced( subMesh.m_numIndices, batchEndIdx - batchStartIdx, subMesh.m_startIndex );
+
+                batchStartIdx = batchEndIdx;
             }
 
-            renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
-            renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
+            renderContext.ClearShaderResource( PipelineStage::Vertex, 0 );
+            renderContext.ClearShaderResource( PipelineStage::Pixel, 10 );
+            return;
+        }
+
+        // Submit sorted packets, only changing state when needed
+        //-------------------------------------------------------------------------
+
+        StaticMeshComponent const* pCurrentComponent = nullptr;
+        StaticMesh const* pCurrentMesh = nullptr;
+        Material const* pCurrentMaterial = nullptr;
+        bool isMaterialSet = false;
 
-            TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
-            uint64_t const visibility = pMeshComponent->GetSectionVisibilityMask();
+        ObjectTransforms transforms = data.m_transforms;
 
-            auto const numSubMeshes = pMesh->GetNumSections();
-            for ( auto i = 0u; i < numSubMeshes; i++ )
+        for ( DrawPacket const& packet : m_drawPackets )
+        {
+            StaticMeshComponent const* pMeshComponent = data.m_staticMeshComponents[packet.m_componentIdx];
+            if ( pMeshComponent != pCurrentComponent )
             {
-                // Skip hidden sections
-                if ( ( visibility & ( 1ull << i ) ) == 0 )
+                pCurrentComponent = pMeshComponent;
+
+                transforms.m_worldTransform = m_componentTransforms[packet.m_componentIdx].m_worldTransform;
+                transforms.m_normalTransform = m_componentTransforms[packet.m_componentIdx].m_normalTransform;
+                renderContext.WriteToBuffer( m_vertexShaderStatic.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+
+                if ( renderTarget.HasPickingRT() )
                 {
-                    continue;
+                    PickingData const pd( pMeshComponent->GetEntityID().m_value, pMeshComponent->GetID().m_value );
+                    renderContext.WriteToBuffer( m_pixelShaderPicking.GetConstBuffer( 2 ), &pd, sizeof( PickingData ) );
                 }
+            }
+
+            StaticMesh const* pMesh = pMeshComponent->GetMesh();
+            if ( pMesh != pCurrentMesh )
+            {
+                pCurrentMesh = pMesh;
+                renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
+                renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
+            }
 
-                // Set material
-                if ( i < materials.size() && materials[i] )
+            if ( !isMaterialSet || packet.m_pMaterial != pCurrentMaterial )
+            {
+                pCurrentMaterial = packet.m_pMaterial;
+                isMaterialSet = true;
+
+                if ( pCurrentMaterial != nullptr )
                 {
-                    SetMaterial( renderContext, *pPipelineState->m_pPixelShader, materials[i] );
+                    SetMaterial( renderContext, *pPipelineState->m_pPixelShader, pCurrentMaterial );
                 }
                 else // Use default material
                 {
                     SetDefaultMaterial( renderContext, *pPipelineState->m_pPixelShader );
                 }
-
-                auto const& subMesh = pMesh->GetSection( i );
-                renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
             }
+
+            auto const& subMesh = pMesh->GetSection( packet.m_sectionIdx );
+            renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
         }
         renderContext.ClearShaderResource( PipelineStage::Pixel, 10 );
     }
@@ -606,69 +1130,75 @@ namespace EE::Render
 
         //-------------------------------------------------------------------------
 
+        // Component-major so that each component's bones, transforms and picking data are only uploaded once
+        BuildDrawPackets( data.m_skeletalMeshComponents, true );
+
+        // Submit sorted packets, only changing state when needed
+        //-------------------------------------------------------------------------
+
+        SkeletalMeshComponent const* pCurrentComponent = nullptr;
         SkeletalMesh const* pCurrentMesh = nullptr;
+        Material const* pCurrentMaterial = nullptr;
+        bool isMaterialSet = false;
 
-        for ( SkeletalMeshComponent const* pMeshComponent : data.m_skeletalMeshComponents )
-        {
-            if ( pMeshComponent->GetMesh() != pCurrentMesh )
-            {
-                pCurrentMesh = pMeshComponent->GetMesh();
-                EE_ASSERT( pCurrentMesh != nullptr && pCurrentMesh->IsValid() );
+        ObjectTransforms transforms = data.m_transforms;
 
-                renderContext.SetVertexBuffer( pCurrentMesh->GetVertexBuffer() );
-                renderContext.SetIndexBuffer( pCurrentMesh->GetIndexBuffer() );
-            }
+        for ( DrawPacket const& packet : m_drawPackets )
+        {
+            SkeletalMeshComponent const* pMeshComponent = data.m_skeletalMeshComponents[packet.m_componentIdx];
+            SkeletalMesh const* pMesh = pMeshComponent->GetMesh();
+            EE_ASSERT( pMesh != nullptr && pMesh->IsValid() );
 
             // Update Bones and Transforms
             //-------------------------------------------------------------------------
 
-            Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
-            ObjectTransforms transforms = data.m_transforms;
-            transforms.m_worldTransform = worldTransform;
-            transforms.m_worldTransform.SetTranslation( worldTransform.GetTranslation() );
-            transforms.m_normalTransform = transforms.m_worldTransform.GetInverse().Transpose();
-            renderContext.WriteToBuffer( m_vertexShaderSkeletal.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+            if ( pMeshComponent != pCurrentComponent )
+            {
+                pCurrentComponent = pMeshComponent;
 
-            auto const& bonesConstBuffer = m_vertexShaderSkeletal.GetConstBuffer( 1 );
-            auto const& boneTransforms = pMeshComponent->GetSkinningTransforms();
-            EE_ASSERT( boneTransforms.size() == pCurrentMesh->GetNumBones() );
-            renderContext.WriteToBuffer( bonesConstBuffer, boneTransforms.data(), sizeof( Matrix ) * pCurrentMesh->GetNumBones() );
+                transforms.m_worldTransform = m_componentTransforms[packet.m_componentIdx].m_worldTransform;
+                transforms.m_normalTransform = m_componentTransforms[packet.m_componentIdx].m_normalTransform;
+                renderContext.WriteToBuffer( m_vertexShaderSkeletal.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
-            if ( renderTarget.HasPickingRT() )
-            {
-                PickingData const pd( pMeshComponent->GetEntityID().m_value, pMeshComponent->GetID().m_value );
-                renderContext.WriteToBuffer( m_pixelShaderPicking.GetConstBuffer( 2 ), &pd, sizeof( PickingData ) );
+                auto const& bonesConstBuffer = m_vertexShaderSkeletal.GetConstBuffer( 1 );
+                auto const& boneTransforms = pMeshComponent->GetSkinningTransforms();
+                EE_ASSERT( boneTransforms.size() == pMesh->GetNumBones() );
+                renderContext.WriteToBuffer( bonesConstBuffer, boneTransforms.data(), sizeof( Matrix ) * pMesh->GetNumBones() );
+
+                if ( renderTarget.HasPickingRT() )
+                {
+                    PickingData const pd( pMeshComponent->GetEntityID().m_value, pMeshComponent->GetID().m_value );
+                    renderContext.WriteToBuffer( m_pixelShaderPicking.GetConstBuffer( 2 ), &pd, sizeof( PickingData ) );
+                }
             }
 
-            // Draw sub-meshes
+            // Draw sub-mesh
             //-------------------------------------------------------------------------
 
-            TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
-            uint64_t const visibility = pMeshComponent->GetSectionVisibilityMask();
+            if ( pMesh != pCurrentMesh )
+            {
+                pCurrentMesh = pMesh;
+                renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
+                renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
+            }
 
-            auto const numSubMeshes = pCurrentMesh->GetNumSections();
-            for ( auto i = 0u; i < numSubMeshes; i++ )
+            if ( !isMaterialSet || packet.m_pMaterial != pCurrentMaterial )
             {
-                // Skip hidden sections
-                if ( ( visibility & ( 1ull << i ) ) == 0 )
-                {
-                    continue;
-                }
+                pCurrentMaterial = packet.m_pMaterial;
+                isMaterialSet = true;
 
-                // Set material
-                if ( i < materials.size() && materials[i] )
+                if ( pCurrentMaterial != nullptr )
                 {
-                    SetMaterial( renderContext, *pPipelineState->m_pPixelShader, materials[i] );
+                    SetMaterial( renderContext, *pPipelineState->m_pPixelShader, pCurrentMaterial );
                 }
                 else // Use default material
                 {
                     SetDefaultMaterial( renderContext, *pPipelineState->m_pPixelShader );
                 }
-
-                // Draw mesh
-                auto const& subMesh = pCurrentMesh->GetSection( i );
-                renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
             }
+
+            auto const& subMesh = pMesh->GetSection( packet.m_sectionIdx );
+            renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
         }
         renderContext.ClearShaderResource( PipelineStage::Pixel, 10 );
     }
@@ -693,6 +1223,87 @@ namespace EE::Render
         }
     }
 
+    void WorldRenderer::UpdateShadowCascades( Viewport const& viewport, DirectionalLightComponent const* pDirectionalLightComponent, RendererWorldSystem const* pWorldSystem, LightData& lightData )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        // Calculate cascade splits - practical split scheme (blend of logarithmic and uniform)
+        //-------------------------------------------------------------------------
+
+        float const nearDepth = 1.0f;
+        float const farDepth = Math::Min( s_sunShadowDistance, viewport.GetViewVolume().GetDepthRange().m_end );
+        EE_ASSERT( farDepth > nearDepth );
+
+        float cascadeSplits[s_numShadowCascades];
+        for ( uint32_t i = 0; i < s_numShadowCascades; i++ )
+        {
+            float const percentage = float( i + 1 ) / s_numShadowCascades;
+            float const logSplit = nearDepth * Math::Pow( farDepth / nearDepth, percentage );
+            float const uniformSplit = nearDepth + ( farDepth - nearDepth ) * percentage;
+            cascadeSplits[i] = uniformSplit + ( logSplit - uniformSplit ) * s_shadowCascadeSplitLambda;
+        }
+
+        lightData.m_shadowCascadeSplits = Float4( cascadeSplits[0], cascadeSplits[1], cascadeSplits[2], cascadeSplits[3] );
+
+        // Calculate cascade volumes and gather casters
+        //-------------------------------------------------------------------------
+
+        Transform const& lightWorldTransform = pDirectionalLightComponent->GetWorldTransform();
+
+        auto UpdateCascade = [&] ( uint32_t cascadeIdx )
+        {
+            ShadowCascade& cascade = m_shadowCascades[cascadeIdx];
+
+            FloatRange const cascadeDepthRange( cascadeIdx == 0 ? nearDepth : cascadeSplits[cascadeIdx - 1], cascadeSplits[cascadeIdx] );
+            cascade.m_volume = ComputeShadowVolume( viewport, lightWorldTransform, cascadeDepthRange, s_shadowCasterExtrusionDistance );
+            lightData.m_sunShadowMapMatrices[cascadeIdx] = cascade.m_volume.GetViewProjectionMatrix();
+
+            // Casters do not need to be visible to the view, so we test all meshes against the extruded light volume
+            cascade.m_staticMeshCasters.clear();
+            for ( StaticMeshComponent const* pMeshComponent : pWorldSystem->m_staticMeshComponents )
+            {
+                if ( pMeshComponent->IsVisible() && cascade.m_volume.Contains( pMeshComponent->GetWorldBounds().GetAABB() ) )
+                {
+                    cascade.m_staticMeshCasters.emplace_back( pMeshComponent );
+                }
+            }
+
+            cascade.m_skeletalMeshCasters.clear();
+            for ( auto const& meshGroup : pWorldSystem->m_skeletalMeshGroups )
+            {
+                for ( SkeletalMeshComponent const* pMeshComponent : meshGroup.m_components )
+                {
+                    if ( pMeshComponent->IsVisible() && cascade.m_volume.Contains( pMeshComponent->GetWorldBounds().GetAABB() ) )
+                    {
+                        cascade.m_skeletalMeshCasters.emplace_back( pMeshComponent );
+                    }
+                }
+            }
+        };
+
+        if ( m_pTaskSystem != nullptr )
+        {
+            AsyncTask cascadeTask( s_numShadowCascades, [&UpdateCascade] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    UpdateCascade( i );
+                }
+            } );
+            cascadeTask.m_MinRange = 1;
+
+            m_pTaskSystem->ScheduleTask( &cascadeTask );
+            m_pTaskSystem->WaitForTask( &cascadeTask );
+        }
+        else
+        {
+            for ( uint32_t i = 0; i < s_numShadowCascades; i++ )
+            {
+                UpdateCascade( i );
+            }
+        }
+    }
+
     void WorldRenderer::RenderSunShadows( Viewport const& viewport, DirectionalLightComponent* pDirectionalLightComponent, RenderData const& data )
     {
         EE_PROFILE_FUNCTION_RENDER();
@@ -706,72 +1317,77 @@ namespace EE::Render
 
         renderContext.ClearDepthStencilView( m_shadowMap.GetDepthStencilView(), 1.0f/*TODO: inverse z*/, 0 );
         renderContext.SetRenderTarget( m_shadowMap.GetDepthStencilView() );
-        renderContext.SetViewport( Float2( (float) m_shadowMap.GetDimensions().m_x, (float) m_shadowMap.GetDimensions().m_y ), Float2( 0.0f, 0.0f ) );
         renderContext.SetDepthTestMode( DepthTestMode::On );
 
-        ObjectTransforms transforms;
-        transforms.m_viewprojTransform = data.m_lightData.m_sunShadowMapMatrix;
+        for ( uint32_t cascadeIdx = 0; cascadeIdx < s_numShadowCascades; cascadeIdx++ )
+        {
+            ShadowCascade const& cascade = m_shadowCascades[cascadeIdx];
 
-        // Static Meshes
-        //-------------------------------------------------------------------------
+            // Each cascade renders into its own tile of the shadow map
+            Float2 const tileOffset( float( ( cascadeIdx % 2 ) * s_shadowCascadeResolution ), float( ( cascadeIdx / 2 ) * s_shadowCascadeResolution ) );
+            renderContext.SetViewport( Float2( (float) s_shadowCascadeResolution ), tileOffset );
 
-        renderContext.SetPipelineState( m_pipelineStateStaticShadow );
-        renderContext.SetShaderInputBinding( m_inputBindingStatic );
-        renderContext.SetPrimitiveTopology( Topology::TriangleList );
+            ObjectTransforms transforms;
+            transforms.m_viewprojTransform = data.m_lightData.m_sunShadowMapMatrices[cascadeIdx];
 
-        for ( StaticMeshComponent const* pMeshComponent : data.m_staticMeshComponents )
-        {
-            auto pMesh = pMeshComponent->GetMesh();
-            Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
-            transforms.m_worldTransform = worldTransform;
-            renderContext.WriteToBuffer( m_vertexShaderStatic.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+            // Static Meshes
+            //-------------------------------------------------------------------------
 
-            renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
-            renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
+            renderContext.SetPipelineState( m_pipelineStateStaticShadow );
+            renderContext.SetShaderInputBinding( m_inputBindingStatic );
+            renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
-            auto const numSubMeshes = pMesh->GetNumSections();
-            for ( auto i = 0u; i < numSubMeshes; i++ )
+            for ( StaticMeshComponent const* pMeshComponent : cascade.m_staticMeshCasters )
             {
-                auto const& subMesh = pMesh->GetSection( i );
-                renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
+                auto pMesh = pMeshComponent->GetMesh();
+                transforms.m_worldTransform = pMeshComponent->GetWorldMatrix();
+                renderContext.WriteToBuffer( m_vertexShaderStatic.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+
+                renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
+                renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
+
+                auto const numSubMeshes = pMesh->GetNumSections();
+                for ( auto i = 0u; i < numSubMeshes; i++ )
+                {
+                    auto const& subMesh = pMesh->GetSection( i );
+                    renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
+                }
             }
-        }
 
-        // Skeletal Meshes
-        //-------------------------------------------------------------------------
+            // Skeletal Meshes
+            //-------------------------------------------------------------------------
 
-        renderContext.SetPipelineState( m_pipelineStateSkeletalShadow );
-        renderContext.SetShaderInputBinding( m_inputBindingSkeletal );
-        renderContext.SetPrimitiveTopology( Topology::TriangleList );
+            renderContext.SetPipelineState( m_pipelineStateSkeletalShadow );
+            renderContext.SetShaderInputBinding( m_inputBindingSkeletal );
+            renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
-        for ( SkeletalMeshComponent const* pMeshComponent : data.m_skeletalMeshComponents )
-        {
-            auto pMesh = pMeshComponent->GetMesh();
+            for ( SkeletalMeshComponent const* pMeshComponent : cascade.m_skeletalMeshCasters )
+            {
+                auto pMesh = pMeshComponent->GetMesh();
 
-            // Update Bones and Transforms
-            //-------------------------------------------------------------------------
+                // Update Bones and Transforms
+                //-------------------------------------------------------------------------
 
-            Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
-            transforms.m_worldTransform = worldTransform;
-            transforms.m_worldTransform.SetTranslation( worldTransform.GetTranslation() );
-            renderContext.WriteToBuffer( m_vertexShaderSkeletal.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+                transforms.m_worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
+                renderContext.WriteToBuffer( m_vertexShaderSkeletal.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
-            auto const& bonesConstBuffer = m_vertexShaderSkeletal.GetConstBuffer( 1 );
-            auto const& boneTransforms = pMeshComponent->GetSkinningTransforms();
-            EE_ASSERT( boneTransforms.size() == pMesh->GetNumBones() );
-            renderContext.WriteToBuffer( bonesConstBuffer, boneTransforms.data(), sizeof( Matrix ) * pMesh->GetNumBones() );
+                auto const& bonesConstBuffer = m_vertexShaderSkeletal.GetConstBuffer( 1 );
+                auto const& boneTransforms = pMeshComponent->GetSkinningTransforms();
+                EE_ASSERT( boneTransforms.size() == pMesh->GetNumBones() );
+                renderContext.WriteToBuffer( bonesConstBuffer, boneTransforms.data(), sizeof( Matrix ) * pMesh->GetNumBones() );
 
-            renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
-            renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
+                renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
+                renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
 
-            // Draw sub-meshes
-            //-------------------------------------------------------------------------
-            auto const numSubMeshes = pMesh->GetNumSections();
-            for ( auto i = 0u; i < numSubMeshes; i++ )
-            {
-                // Draw mesh
-                auto const& subMesh = pMesh->GetSection( i );
-                renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
+                // Draw sub-meshes
+                //-------------------------------------------------------------------------
+                auto const numSubMeshes = pMesh->GetNumSections();
+                for ( auto i = 0u; i < numSubMeshes; i++ )
+                {
+                    // Draw mesh
+                    auto const& subMesh = pMesh->GetSection( i );
+                    renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
+                }
             }
         }
     }
@@ -820,8 +1436,11 @@ namespace EE::Render
             renderData.m_lightData.m_SunDirIndirectIntensity = -pDirectionalLightComponent->GetLightDirection();
             Float4 colorIntensity = pDirectionalLightComponent->GetLightColor();
             renderData.m_lightData.m_SunColorRoughnessOneLevel = colorIntensity * pDirectionalLightComponent->GetLightIntensity();
-            // TODO: conditional
-            renderData.m_lightData.m_sunShadowMapMatrix = ComputeShadowMatrix( viewport, pDirectionalLightComponent->GetWorldTransform(), 50.0f/*TODO: configure*/ );
+
+            if ( pDirectionalLightComponent->GetShadowed() )
+            {
+                UpdateShadowCascades( viewport, pDirectionalLightComponent, pWorldSystem, renderData.m_lightData );
+            }
         }
 
         renderData.m_lightData.m_SunColorRoughnessOneLevel.SetW0();
@@ -839,41 +1458,7 @@ namespace EE::Render
             }
         }
 
-        int32_t const numPointLights = Math::Min( pWorldSystem->m_registeredPointLightComponents.size(), (int32_t) s_maxPunctualLights );
-        uint32_t lightIndex = 0;
-        for ( int32_t i = 0; i < numPointLights; ++i )
-        {
-            EE_ASSERT( lightIndex < s_maxPunctualLights );
-            PointLightComponent* pPointLightComponent = pWorldSystem->m_registeredPointLightComponents[i];
-            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr = pPointLightComponent->GetLightPosition();
-            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr.SetW( Math::Sqr( 1.0f / pPointLightComponent->GetLightRadius() ) );
-            renderData.m_lightData.m_punctualLights[lightIndex].m_dir = Vector::Zero;
-            renderData.m_lightData.m_punctualLights[lightIndex].m_color = Vector( pPointLightComponent->GetLightColor().ToFloat4() ) * pPointLightComponent->GetLightIntensity();
-            renderData.m_lightData.m_punctualLights[lightIndex].m_spotAngles = Vector( -1.0f, 1.0f, 0.0f );
-            ++lightIndex;
-        }
-
-        int32_t const numSpotLights = Math::Min( pWorldSystem->m_registeredSpotLightComponents.size(), (int32_t) s_maxPunctualLights - numPointLights );
-        for ( int32_t i = 0; i < numSpotLights; ++i )
-        {
-            EE_ASSERT( lightIndex < s_maxPunctualLights );
-            SpotLightComponent* pSpotLightComponent = pWorldSystem->m_registeredSpotLightComponents[i];
-            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr = pSpotLightComponent->GetLightPosition();
-            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr.SetW( Math::Sqr( 1.0f / pSpotLightComponent->GetLightRadius() ) );
-            renderData.m_lightData.m_punctualLights[lightIndex].m_dir = -pSpotLightComponent->GetLightDirection();
-            renderData.m_lightData.m_punctualLights[lightIndex].m_color = Vector( pSpotLightComponent->GetLightColor().ToFloat4() ) * pSpotLightComponent->GetLightIntensity();
-            Radians innerAngle = pSpotLightComponent->GetLightInnerUmbraAngle().ToRadians();
-            Radians outerAngle = pSpotLightComponent->GetLightOuterUmbraAngle().ToRadians();
-            innerAngle.Clamp( 0, Math::PiDivTwo );
-            outerAngle.Clamp( 0, Math::PiDivTwo );
-
-            float cosInner = Math::Cos( (float) innerAngle );
-            float cosOuter = Math::Cos( (float) outerAngle );
-            renderData.m_lightData.m_punctualLights[lightIndex].m_spotAngles = Vector( cosOuter, 1.0f / Math::Max( cosInner - cosOuter, 0.001f ), 0.0f );
-            ++lightIndex;
-        }
-
-        renderData.m_lightData.m_numPunctualLights = lightIndex;
+        UpdateLightClusters( viewport, pWorldSystem, renderData.m_lightData );
 
         //-------------------------------------------------------------------------
 
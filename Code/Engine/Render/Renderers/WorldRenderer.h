@@ -1,11 +1,19 @@
 #pragma once
 
+#include "LightClusterGrid.h"
 #include "Engine/Render/IRenderer.h"
 #include "Base/Render/RenderDevice.h"
 #include "Base/Math/Matrix.h"
 
 //-------------------------------------------------------------------------
 
+namespace EE
+{
+    class TaskSystem;
+}
+
+//-------------------------------------------------------------------------
+
 namespace EE::Render
 {
     class DirectionalLightComponent;
@@ -15,8 +23,10 @@ namespace EE::Render
     class SkeletalMeshComponent;
     class SkeletalMesh;
     class StaticMesh;
+    class Mesh;
     class Viewport;
     class Material;
+    class RendererWorldSystem;
 
     //-------------------------------------------------------------------------
 
@@ -38,7 +48,14 @@ namespace EE::Render
             MATERIAL_USE_AO_TEXTURE = ( 1 << 4 ),
         };
 
-        constexpr static int32_t const s_maxPunctualLights = 16;
+        constexpr static uint32_t const s_minComponentsPerPacketGenerationTask = 64;
+        constexpr static uint32_t const s_minInstancesPerUploadTask = 256;
+        constexpr static uint32_t const s_initialInstanceBufferCapacity = 1024;
+        constexpr static uint32_t const s_numShadowCascades = 4;                        // Laid out as a 2x2 atlas in the shadow map
+        constexpr static uint32_t const s_shadowCascadeResolution = 1024;
+        constexpr static float const s_sunShadowDistance = 100.0f;
+        constexpr static float const s_shadowCascadeSplitLambda = 0.75f;                // Blend between logarithmic (1) and uniform (0) cascade splits
+        constexpr static float const s_shadowCasterExtrusionDistance = 200.0f;          // How far towards the light we search for casters outside the cascade volume
 
         struct PunctualLight
         {
@@ -52,11 +69,17 @@ namespace EE::Render
         {
             Vector          m_SunDirIndirectIntensity = Vector::Zero;// TODO: refactor to Float3 and float
             Vector          m_SunColorRoughnessOneLevel = Vector::Zero;// TODO: refactor to Float3 and float
-            Matrix          m_sunShadowMapMatrix = Matrix( ZeroInit );
+            Matrix          m_sunShadowMapMatrices[s_numShadowCascades] = { Matrix::Identity, Matrix::Identity, Matrix::Identity, Matrix::Identity }; // Only set when the sun is shadowed
+            Float4          m_shadowCascadeSplits = Float4::Zero;  // The far view depth of each cascade
             float           m_manualExposure = -1.0f;
             uint32_t          m_lightingFlags = 0;
             uint32_t          m_numPunctualLights = 0;
-            PunctualLight   m_punctualLights[s_maxPunctualLights];
+            uint32_t          m_padding = 0;
+            Vector          m_viewPosition = Vector::Zero;
+            Vector          m_viewForward = Vector::Zero;
+            Float4          m_clusterScreenParams = Float4::Zero;   // xy = viewport top left, zw = pixel to cluster tile scale
+            Float4          m_clusterDepthParams = Float4::Zero;    // x = depth slice scale, y = depth slice bias
+            uint32_t          m_clusterDimensions[4] = { LightClusterGrid::s_numClustersX, LightClusterGrid::s_numClustersY, LightClusterGrid::s_numClustersZ, 0 };
         };
 
         struct alignas(16) PickingData
@@ -91,6 +114,39 @@ namespace EE::Render
             Matrix  m_viewprojTransform = Matrix( ZeroInit );
         };
 
+        // The transforms for a single visible component, calculated once per frame when building the draw packets
+        struct ComponentTransforms
+        {
+            Matrix  m_worldTransform;
+            Matrix  m_normalTransform;
+        };
+
+        // Per-batch data for the instanced static mesh shader, the offset of the batch's first instance in the instance buffer
+        struct alignas( 16 ) InstanceBatchData
+        {
+            uint32_t            m_instanceOffset = 0;
+            uint32_t            m_padding[3] = { 0, 0, 0 };
+        };
+
+        // A single mesh section draw - the sort key groups draws by material, then by mesh and then by section to minimize state changes
+        // Packets with identical keys are adjacent after sorting and so form the instanced batches
+        // Component-major packets (skeletal meshes) are instead grouped by component first so per-component data (i.e. bones) is only uploaded once
+        struct DrawPacket
+        {
+            uint64_t            m_sortKey = 0;
+            Material const*     m_pMaterial = nullptr;
+            uint32_t            m_componentIdx = 0;
+            uint32_t            m_sectionIdx = 0;
+        };
+
+        // A single sun shadow cascade and the casters that overlap it
+        struct ShadowCascade
+        {
+            Math::ViewVolume                        m_volume;
+            TVector<StaticMeshComponent const*>     m_staticMeshCasters;
+            TVector<SkeletalMeshComponent const*>   m_skeletalMeshCasters;
+        };
+
         struct RenderData //TODO: optimize - there should not be per frame updates
         {
             ObjectTransforms                        m_transforms;
@@ -111,13 +167,16 @@ namespace EE::Render
     public:
 
         inline bool WasInitialized() const { return m_initialized; }
-        bool Initialize( RenderDevice* pRenderDevice );
+        bool Initialize( RenderDevice* pRenderDevice, TaskSystem* pTaskSystem = nullptr );
         void Shutdown();
 
         virtual void RenderWorld( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget, EntityWorld* pWorld ) override final;
 
     private:
 
+        // Calculate the cascade volumes and matrices for the sun and gather the per-cascade shadow casters
+        void UpdateShadowCascades( Viewport const& viewport, DirectionalLightComponent const* pDirectionalLightComponent, RendererWorldSystem const* pWorldSystem, LightData& lightData );
+
         void RenderSunShadows( Viewport const& viewport, DirectionalLightComponent* pDirectionalLightComponent, RenderData const& data );
         void RenderStaticMeshes( Viewport const& viewport, RenderTarget const& renderTarget, RenderData const& data );
         void RenderSkeletalMeshes( Viewport const& viewport, RenderTarget const& renderTarget, RenderData const& data );
@@ -125,15 +184,48 @@ namespace EE::Render
 
         void SetupRenderStates( Viewport const& viewport, PixelShader* pShader, RenderData const& data );
 
+        // Bin the registered punctual lights into the cluster grid for this viewport and upload the light and cluster data
+        void UpdateLightClusters( Viewport const& viewport, RendererWorldSystem const* pWorldSystem, LightData& lightData );
+
+        // Generate the draw packets (and component transforms) for the supplied visible components and sort them by state
+        // If component-major is set, the packets are sorted by component first and only then by material and section
+        template<typename T>
+        void BuildDrawPackets( TVector<T const*> const& components, bool isComponentMajor );
+
+        void SortDrawPackets();
+
+        // Write the transforms of every sorted draw packet into the instance buffer (growing it if needed)
+        void UploadInstanceTransforms();
+
     private:
 
         bool                                                    m_initialized = false;
+        TaskSystem*                                             m_pTaskSystem = nullptr;
+
+        // Draw packet generation
+        TVector<ComponentTransforms>                            m_componentTransforms;
+        TVector<uint32_t>                                       m_drawPacketOffsets;
+        TVector<DrawPacket>                                     m_drawPackets;
+        TVector<DrawPacket>                                     m_drawPacketSortBuffer;
+        RenderBuffer                                            m_instanceTransformBuffer;
+
+        // Sun shadows
+        ShadowCascade                                           m_shadowCascades[s_numShadowCascades];
+
+        // Clustered lighting
+        LightClusterGrid                                        m_lightClusterGrid;
+        TVector<LightClusterGrid::LightBounds>                  m_lightBounds;
+        TVector<PunctualLight>                                  m_punctualLights;
+        RenderBuffer                                            m_punctualLightBuffer;
+        RenderBuffer                                            m_lightClusterBuffer;
+        RenderBuffer                                            m_lightIndexBuffer;
 
         // Render State
         VertexShader                                            m_vertexShaderSkybox;
         PixelShader                                             m_pixelShaderSkybox;
         RenderDevice*                                           m_pRenderDevice = nullptr;
         VertexShader                                            m_vertexShaderStatic;
+        VertexShader                                            m_vertexShaderStaticInstanced;
         VertexShader                                            m_vertexShaderSkeletal;
         PixelShader                                             m_pixelShader;
         PixelShader                                             m_emptyPixelShader;
@@ -143,8 +235,10 @@ namespace EE::Render
         SamplerState                                            m_bilinearClampedSampler;
         SamplerState                                            m_shadowSampler;
         ShaderInputBindingHandle                                m_inputBindingStatic;
+        ShaderInputBindingHandle                                m_inputBindingStaticInstanced;
         ShaderInputBindingHandle                                m_inputBindingSkeletal;
         PipelineState                                           m_pipelineStateStatic;
+        PipelineState                                           m_pipelineStateStaticInstanced;
         PipelineState                                           m_pipelineStateSkeletal;
         PipelineState                                           m_pipelineStateStaticShadow;
         PipelineState                                           m_pipelineStateSkeletalShadow;
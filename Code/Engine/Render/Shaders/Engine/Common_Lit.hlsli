@@ -26,15 +26,14 @@ static const uint VISUALIZATION_MODE_AO = 5;
 
 static const uint VISUALIZATION_MODE_BITS_SHIFT = 32 - 3;
 
-static const uint MAX_PUNCTUAL_LIGHTS = 16;
-
+// Structured buffer layout, must match the 16 byte aligned engine struct
 struct PunctualLight
 {
     float3 m_position;
     float  m_invRadiusSqr;
-    float3 m_dir;
-    float3 m_color;
-    float2 m_spotAngles;
+    float4 m_dir;
+    float4 m_color;
+    float4 m_spotAngles;
 };
 
 cbuffer Lights : register( b0 )
@@ -43,11 +42,17 @@ cbuffer Lights : register( b0 )
     float         m_skyboxLightIntensity; // TODO: either we use color+intensity of bake that into envmap.
     float3        m_sunColor;
     float         m_roughnessOneLevel;
-    Matrix        m_sunShadowMapMatrix;
+    Matrix        m_sunShadowMapMatrices[4];
+    float4        m_shadowCascadeSplits;  // The far view depth of each cascade
     float         m_manualExposure;
     uint          m_lightingFlags;
     uint          m_numPunctualLights;
-    PunctualLight m_punctualLights[MAX_PUNCTUAL_LIGHTS];
+    uint          m_lightDataPadding;
+    float4        m_viewPosition;
+    float4        m_viewForward;
+    float4        m_clusterScreenParams;  // xy = viewport top left, zw = pixel to cluster tile scale
+    float4        m_clusterDepthParams;   // x = depth slice scale, y = depth slice bias ( slice = log2( depth ) * x + y )
+    uint4         m_clusterDimensions;
 };
 
 sampler bilinearSampler : register( s0 );
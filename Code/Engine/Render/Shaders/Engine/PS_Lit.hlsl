@@ -10,6 +10,10 @@ Texture2D   shadowMap       : register( t10 );
 Texture2D   precomputedBRDF : register( t11 );
 TextureCube globalEnvMap    : register( t12 );
 
+StructuredBuffer<PunctualLight> punctualLights      : register( t13 );
+StructuredBuffer<uint2>         lightClusters       : register( t14 );  // x = offset into the light index list, y = num lights
+StructuredBuffer<uint>          lightIndices        : register( t15 );
+
 sampler shadowSampler : register( s2 );
 
 cbuffer Materials : register( b1 )
@@ -194,11 +198,27 @@ float getAngleAtt(float3 normLightVector, float3 lightDir, float2 spotAngles )
 
 float TestShadow(float3 P)
 {
-	const float4 projShadowPos = mul( m_sunShadowMapMatrix, float4(P, 1.0f) ); // TODO: use normal offset to remove acne?
+	// Select the cascade from the view depth, anything beyond the last cascade is unshadowed
+	const float viewDepth = dot(P - m_viewPosition.xyz, m_viewForward.xyz);
+	if (viewDepth > m_shadowCascadeSplits.w)
+	{
+		return 1.0f;
+	}
+
+	const uint cascadeIdx = (viewDepth > m_shadowCascadeSplits.x) + (viewDepth > m_shadowCascadeSplits.y) + (viewDepth > m_shadowCascadeSplits.z);
+
+	const float4 projShadowPos = mul( m_sunShadowMapMatrices[cascadeIdx], float4(P, 1.0f) ); // TODO: use normal offset to remove acne?
 	float3 lightSpacePos = projShadowPos.xyz / projShadowPos.w;
 
-	// clip space [-1, 1] --> texture space [0, 1]
-	const float2 shadowTexCoords = float2(0.5f, 0.5f) + projShadowPos.xy * float2(0.5f, -0.5f);	// invert Y
+	// clip space [-1, 1] --> cascade texture space [0, 1]
+	const float2 cascadeTexCoords = float2(0.5f, 0.5f) + projShadowPos.xy * float2(0.5f, -0.5f);	// invert Y
+	if (any(cascadeTexCoords < 0.0f) || any(cascadeTexCoords > 1.0f))
+	{
+		return 1.0f;
+	}
+
+	// The cascades are laid out in a 2x2 atlas
+	const float2 shadowTexCoords = (cascadeTexCoords + float2(cascadeIdx % 2, cascadeIdx / 2)) * 0.5f;
 
 	const float BIAS = 0.0001f; // TODo: make configurable or use normal offset
 
@@ -222,6 +242,14 @@ float TestShadow(float3 P)
 	return shadowing;
 }
 
+uint GetLightClusterIndex(float2 screenPos, float3 P)
+{
+	const float viewDepth = max(dot(P - m_viewPosition.xyz, m_viewForward.xyz), 0.0001f);
+	const float slice = clamp(floor(log2(viewDepth) * m_clusterDepthParams.x + m_clusterDepthParams.y), 0.0f, float(m_clusterDimensions.z - 1));
+	const float2 tile = clamp(floor((screenPos - m_clusterScreenParams.xy) * m_clusterScreenParams.zw), float2(0.0f, 0.0f), float2(m_clusterDimensions.xy) - 1.0f);
+	return ((uint) slice * m_clusterDimensions.y + (uint) tile.y) * m_clusterDimensions.x + (uint) tile.x;
+}
+
 struct PS_OUTPUT
 {
 	float4 m_color: SV_Target0;
@@ -299,18 +327,20 @@ PS_OUTPUT main(PixelShaderInput psInput)
 	//		Lo += _albedo * (_ao  * Get(fAOIntensity) + (1.0f - Get(fAOIntensity))) * Get(fAmbientLightIntensity);
 	//}
 
-	for (uint i = 0; i < m_numPunctualLights; ++i)
+	const uint2 lightCluster = lightClusters[GetLightClusterIndex(psInput.m_pos.xy, P)];
+	for (uint clusterLightIdx = 0; clusterLightIdx < lightCluster.y; ++clusterLightIdx)
 	{
-		const float3 lD = m_punctualLights[i].m_position - P;
-		const float  invR2 = m_punctualLights[i].m_invRadiusSqr;
+		const PunctualLight light = punctualLights[lightIndices[lightCluster.x + clusterLightIdx]];
+		const float3 lD = light.m_position - P;
+		const float  invR2 = light.m_invRadiusSqr;
 		const float3 L = normalize(lD);
-		const float  attenuation = getDistanceAtt(lD, invR2) * getAngleAtt(L, m_punctualLights[i].m_dir, m_punctualLights[i].m_spotAngles);
+		const float  attenuation = getDistanceAtt(lD, invR2) * getAngleAtt(L, light.m_dir.xyz, light.m_spotAngles.xy);
 		const float3 H = normalize(V + L);
 		const float  NoL = max(dot(N, L), 0.0);
 		const float  NoH = max(dot(N, H), 0.0);
 		const float  VoH = max(dot(V, H), 0.0);
 
-		Lo += BRDF(NoL, NoV, NoH, VoH, surfaceParams) * m_punctualLights[i].m_color * (attenuation * NoL);
+		Lo += BRDF(NoL, NoV, NoH, VoH, surfaceParams) * light.m_color.rgb * (attenuation * NoL);
 	}
 
 	if (m_lightingFlags&LIGHTING_ENABLE_SUN)
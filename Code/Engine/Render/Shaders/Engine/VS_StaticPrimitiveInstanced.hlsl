@@ -0,0 +1,35 @@
+#include "Common_Lit.hlsli"
+
+struct InstanceTransforms
+{
+    matrix m_worldTransform;
+    matrix m_normalTransform;
+};
+
+// SV_InstanceID does not include the start instance location so we need to supply the batch offset ourselves
+cbuffer InstanceData : register( b1 )
+{
+    uint m_instanceOffset;
+};
+
+StructuredBuffer<InstanceTransforms> g_instanceTransforms : register( t0 );
+
+struct VertexShaderInput
+{
+    float3 m_pos : POSITION;
+    float3 m_normal : NORMAL;
+    float2 m_uv0 : TEXCOORD0;
+    float2 m_uv1 : TEXCOORD1;
+};
+
+PixelShaderInput main( VertexShaderInput vsInput, uint instanceID : SV_InstanceID )
+{
+    InstanceTransforms instance = g_instanceTransforms[m_instanceOffset + instanceID];
+
+    PixelShaderInput output;
+    output.m_wpos = mul( instance.m_worldTransform, float4( vsInput.m_pos, 1.0 ) ).xyz;
+    output.m_normal = mul( instance.m_normalTransform, float4( vsInput.m_normal, 0.0 ) ).xyz;
+    output.m_pos = mul( m_viewprojTransform, float4( output.m_wpos, 1.0 ) );
+    output.m_uv = vsInput.m_uv0;
+    return output;
+}
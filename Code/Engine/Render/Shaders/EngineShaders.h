@@ -16,6 +16,7 @@
         #include "_AutoGenerated/VS_Cube_x64_Debug.h"
         #include "_AutoGenerated/VS_SkinnedPrimitive_x64_Debug.h"
         #include "_AutoGenerated/VS_StaticPrimitive_x64_Debug.h"
+        #include "_AutoGenerated/VS_StaticPrimitiveInstanced_x64_Debug.h"
         #include "_AutoGenerated/PS_LitPicking_x64_Debug.h"
     #elif EE_RELEASE
         #include "_AutoGenerated/CS_PrecomputeDFG_x64_Release.h"
@@ -25,6 +26,7 @@
         #include "_AutoGenerated/VS_Cube_x64_Release.h"
         #include "_AutoGenerated/VS_SkinnedPrimitive_x64_Release.h"
         #include "_AutoGenerated/VS_StaticPrimitive_x64_Release.h"
+        #include "_AutoGenerated/VS_StaticPrimitiveInstanced_x64_Release.h"
         #include "_AutoGenerated/PS_LitPicking_x64_Release.h"
     #elif EE_SHIPPING
         #include "_AutoGenerated/CS_PrecomputeDFG_x64_Shipping.h"
@@ -34,6 +36,7 @@
         #include "_AutoGenerated/VS_Cube_x64_Shipping.h"
         #include "_AutoGenerated/VS_SkinnedPrimitive_x64_Shipping.h"
         #include "_AutoGenerated/VS_StaticPrimitive_x64_Shipping.h"
+        #include "_AutoGenerated/VS_StaticPrimitiveInstanced_x64_Shipping.h"
         #include "_AutoGenerated/PS_LitPicking_x64_Shipping.h"
     #else
         #error 1
@@ -11,6 +11,7 @@
 #include "Base/Render/RenderCoreResources.h"
 #include "Base/Render/RenderViewport.h"
 #include "Base/Drawing/DebugDrawing.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/Profiling.h"
 
 //-------------------------------------------------------------------------
@@ -18,14 +19,24 @@
 namespace EE::Render
 {
     void RendererWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
-    {}
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
+
+        // One result list per task system thread (including the main thread)
+        uint32_t const numThreads = ( m_pTaskSystem != nullptr ) ? m_pTaskSystem->GetNumWorkers() + 1 : 1;
+        m_perThreadStaticMeshComponents.resize( numThreads );
+        m_perThreadSkeletalMeshComponents.resize( numThreads );
+    }
 
     void RendererWorldSystem::ShutdownSystem()
     {
         EE_ASSERT( m_registeredStaticMeshComponents.empty() );
         EE_ASSERT( m_registeredSkeletalMeshComponents.empty() );
+        EE_ASSERT( m_skeletalMeshComponents.empty() );
         EE_ASSERT( m_skeletalMeshGroups.empty() );
 
+        m_pTaskSystem = nullptr;
+
         EE_ASSERT( m_registeredDirectionLightComponents.empty() );
         EE_ASSERT( m_registeredPointLightComponents.empty() );
         EE_ASSERT( m_registeredSpotLightComponents.empty() );
@@ -136,6 +147,16 @@ namespace EE::Render
         if ( pMeshComponent->HasMeshResourceSet() )
         {
             m_staticMeshComponents.Add( pMeshComponent );
+
+            if ( pMeshComponent->IsMovable() )
+            {
+                m_movableStaticMeshComponents.Add( pMeshComponent );
+            }
+            else
+            {
+                m_stationaryStaticMeshComponents.Add( pMeshComponent );
+                m_isStaticMeshCullingResultValid = false;
+            }
         }
     }
 
@@ -143,8 +164,23 @@ namespace EE::Render
     {
         if ( pMeshComponent->HasMeshResourceSet() )
         {
-            // Remove from the relevant runtime list
+            // Remove from the relevant runtime lists, the mobility could have been edited since registration so check both lists
             m_staticMeshComponents.Remove( pMeshComponent->GetID() );
+
+            if ( m_movableStaticMeshComponents.HasItemForID( pMeshComponent->GetID() ) )
+            {
+                m_movableStaticMeshComponents.Remove( pMeshComponent->GetID() );
+            }
+            else
+            {
+                m_stationaryStaticMeshComponents.Remove( pMeshComponent->GetID() );
+            }
+
+            // The world might be paused so we need to ensure we dont leave an invalid component in the cached results
+            m_stationaryStaticMeshComponentsInCullingBounds.clear();
+            m_movableStaticMeshComponentsInView.clear();
+            m_visibleStaticMeshComponents.clear();
+            m_isStaticMeshCullingResultValid = false;
         }
 
         // Remove record
@@ -166,6 +202,8 @@ namespace EE::Render
 
             auto pMeshGroup = m_skeletalMeshGroups.FindOrAdd( meshID, pMesh );
             pMeshGroup->m_components.emplace_back( pMeshComponent );
+
+            m_skeletalMeshComponents.Add( pMeshComponent );
         }
     }
 
@@ -187,6 +225,8 @@ namespace EE::Render
             {
                 m_skeletalMeshGroups.Remove( meshID );
             }
+
+            m_skeletalMeshComponents.Remove( pMeshComponent->GetID() );
         }
 
         // Remove record
@@ -195,50 +235,154 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
-    void RendererWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    template<typename T>
+    void RendererWorldSystem::CullComponents( AABB const& viewBounds, TVector<T*> const& components, bool checkVisibilityFlag, TVector<TVector<T const*>>& perThreadResults, TVector<T const*>& outComponents )
     {
-        EE_PROFILE_FUNCTION_RENDER();
+        outComponents.clear();
 
-        if ( ctx.IsWorldPaused() && ctx.GetUpdateStage() != UpdateStage::Paused )
+        int32_t const numComponents = (int32_t) components.size();
+        if ( numComponents == 0 )
         {
             return;
         }
 
-        EE_ASSERT( ( ctx.GetUpdateStage() == UpdateStage::Paused ) ? ctx.IsWorldPaused() : true );
+        auto CullRange = [&] ( int32_t startIdx, int32_t endIdx, TVector<T const*>& results )
+        {
+            for ( int32_t i = startIdx; i < endIdx; i++ )
+            {
+                T const* pComponent = components[i];
+                if ( ( !checkVisibilityFlag || pComponent->IsVisible() ) && viewBounds.Overlaps( pComponent->GetWorldBounds() ) )
+                {
+                    results.emplace_back( pComponent );
+                }
+            }
+        };
+
+        // Small sets are not worth the scheduling overhead
+        if ( m_pTaskSystem == nullptr || numComponents <= s_minComponentsPerCullingTask )
+        {
+            CullRange( 0, numComponents, outComponents );
+            return;
+        }
 
         //-------------------------------------------------------------------------
-        // Culling
+
+        for ( auto& threadResults : perThreadResults )
+        {
+            threadResults.clear();
+        }
+
+        AsyncTask cullingTask( (uint32_t) numComponents, [&] ( TaskSetPartition range, uint32_t threadnum )
+        {
+            EE_ASSERT( threadnum < perThreadResults.size() );
+            CullRange( (int32_t) range.start, (int32_t) range.end, perThreadResults[threadnum] );
+        } );
+        cullingTask.m_MinRange = s_minComponentsPerCullingTask;
+
+        m_pTaskSystem->ScheduleTask( &cullingTask );
+        m_pTaskSystem->WaitForTask( &cullingTask );
+
+        // Concatenate results
         //-------------------------------------------------------------------------
 
-        AABB const viewBounds = ctx.GetViewport()->GetViewVolume().GetAABB();
+        size_t numResults = 0;
+        for ( auto const& threadResults : perThreadResults )
+        {
+            numResults += threadResults.size();
+        }
 
-        m_visibleStaticMeshComponents.clear();
+        outComponents.reserve( numResults );
+        for ( auto const& threadResults : perThreadResults )
+        {
+            outComponents.insert( outComponents.end(), threadResults.begin(), threadResults.end() );
+        }
+    }
+
+    void RendererWorldSystem::UpdateStaticMeshVisibility( AABB const& viewBounds )
+    {
+        EE_PROFILE_SCOPE_RENDER( "Static Mesh Cull" );
+
+        // Stationary meshes are culled against padded view bounds, only re-cull if the view has left these bounds or a stationary mesh has changed
+        bool needsCulling = !m_isStaticMeshCullingResultValid;
+        if ( !needsCulling )
+        {
+            Vector const viewExtentsRelativeToCullingBounds = ( viewBounds.m_center - m_stationaryMeshCullingBounds.m_center ).Abs() + viewBounds.m_halfExtents;
+            needsCulling = !viewExtentsRelativeToCullingBounds.IsLessThanEqual3( m_stationaryMeshCullingBounds.m_halfExtents );
+        }
 
-        for ( auto const& pMeshComponent : m_staticMeshComponents )
+        if ( needsCulling )
         {
-            EE_PROFILE_SCOPE_RENDER( "Static Mesh Cull" );
+            m_stationaryMeshCullingBounds = AABB( viewBounds.m_center, viewBounds.m_halfExtents + Vector( s_stationaryMeshCullingPadding ) );
+            CullComponents<StaticMeshComponent>( m_stationaryMeshCullingBounds, m_stationaryStaticMeshComponents.GetVector(), false, m_perThreadStaticMeshComponents, m_stationaryStaticMeshComponentsInCullingBounds );
+            m_isStaticMeshCullingResultValid = true;
+        }
 
+        // The visibility flag can be toggled at any time and the view can move within the culling bounds, so these are not part of the cached result
+        m_visibleStaticMeshComponents.clear();
+        for ( StaticMeshComponent const* pMeshComponent : m_stationaryStaticMeshComponentsInCullingBounds )
+        {
             if ( pMeshComponent->IsVisible() && viewBounds.Overlaps( pMeshComponent->GetWorldBounds() ) )
             {
                 m_visibleStaticMeshComponents.emplace_back( pMeshComponent );
             }
         }
 
-        m_visibleSkeletalMeshComponents.clear();
+        // Movable meshes are re-culled every frame
+        CullComponents<StaticMeshComponent>( viewBounds, m_movableStaticMeshComponents.GetVector(), true, m_perThreadStaticMeshComponents, m_movableStaticMeshComponentsInView );
+        m_visibleStaticMeshComponents.insert( m_visibleStaticMeshComponents.end(), m_movableStaticMeshComponentsInView.begin(), m_movableStaticMeshComponentsInView.end() );
+    }
+
+    void RendererWorldSystem::UpdateSkeletalMeshVisibility( AABB const& viewBounds )
+    {
+        EE_PROFILE_SCOPE_RENDER( "Skeletal Mesh Cull" );
+        CullComponents<SkeletalMeshComponent>( viewBounds, m_skeletalMeshComponents.GetVector(), true, m_perThreadSkeletalMeshComponents, m_visibleSkeletalMeshComponents );
+    }
+
+    //-------------------------------------------------------------------------
 
-        for ( auto const& meshGroup : m_skeletalMeshGroups )
+    bool RendererWorldSystem::GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const
+    {
+        // Culling updates the mesh visibility
+        outAccess.WritesComponent<MeshComponent>();
+        outAccess.ReadsComponent<LightComponent>();
+        outAccess.ReadsResource( WorldSystemDataAccess::s_viewportResourceID );
+        return true;
+    }
+
+    void RendererWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        if ( ctx.IsWorldPaused() && ctx.GetUpdateStage() != UpdateStage::Paused )
         {
-            EE_PROFILE_SCOPE_RENDER( "Skeletal Mesh Cull" );
+            return;
+        }
 
-            for ( auto pMeshComponent : meshGroup.m_components )
+        EE_ASSERT( ( ctx.GetUpdateStage() == UpdateStage::Paused ) ? ctx.IsWorldPaused() : true );
+
+        //-------------------------------------------------------------------------
+        // Culling
+        //-------------------------------------------------------------------------
+
+        // Static mesh render matrices are refreshed here rather than on access, since the renderer reads them from multiple threads
+        // A stationary mesh with dirty matrices has moved, so the cached culling result for this world is stale
+        for ( StaticMeshComponent* pMeshComponent : m_staticMeshComponents )
+        {
+            if ( pMeshComponent->m_areRenderMatricesDirty )
             {
-                if ( pMeshComponent->IsVisible() && viewBounds.Overlaps( pMeshComponent->GetWorldBounds() ) )
+                pMeshComponent->UpdateRenderMatrices();
+
+                if ( !pMeshComponent->IsMovable() )
                 {
-                    m_visibleSkeletalMeshComponents.emplace_back( pMeshComponent );
+                    m_isStaticMeshCullingResultValid = false;
                 }
             }
         }
 
+        AABB const viewBounds = ctx.GetViewport()->GetViewVolume().GetAABB();
+        UpdateStaticMeshVisibility( viewBounds );
+        UpdateSkeletalMeshVisibility( viewBounds );
+
         //-------------------------------------------------------------------------
         // Debug
         //-------------------------------------------------------------------------
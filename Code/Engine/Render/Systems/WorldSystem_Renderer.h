@@ -12,6 +12,13 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE
+{
+    class TaskSystem;
+}
+
+//-------------------------------------------------------------------------
+
 namespace EE::Render
 {
     class SkeletalMeshComponent;
@@ -34,6 +41,12 @@ namespace EE::Render
 
     private:
 
+        // The minimum number of components to cull per task
+        constexpr static int32_t const s_minComponentsPerCullingTask = 128;
+
+        // How much (in meters) we pad the view bounds by when culling stationary static meshes, the result is reused while the view stays within the padded bounds
+        constexpr static float const s_stationaryMeshCullingPadding = 10.0f;
+
         // Track all instances of a given mesh together - to limit the number of vertex buffer changes
         struct SkeletalMeshGroup
         {
@@ -55,6 +68,7 @@ namespace EE::Render
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override final;
+        virtual bool GetDataAccess( UpdateStage stage, WorldSystemDataAccess& outAccess ) const override;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
 
@@ -70,17 +84,42 @@ namespace EE::Render
         void RegisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
         void UnregisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
 
+        // Culling
+        //-------------------------------------------------------------------------
+
+        // Stationary static meshes are only re-culled if the view leaves the cached culling bounds or a stationary mesh has changed, movable static meshes are always re-culled
+        void UpdateStaticMeshVisibility( AABB const& viewBounds );
+
+        // Skeletal meshes are expected to move every frame so are always re-culled
+        void UpdateSkeletalMeshVisibility( AABB const& viewBounds );
+
+        // Cull the supplied components against the view bounds, splitting the work across the task system when available
+        // Each thread writes to its own result list, these are concatenated into the output list once all culling is complete
+        template<typename T>
+        void CullComponents( AABB const& viewBounds, TVector<T*> const& components, bool checkVisibilityFlag, TVector<TVector<T const*>>& perThreadResults, TVector<T const*>& outComponents );
+
     private:
 
+        TaskSystem*                                                     m_pTaskSystem = nullptr;
+
         // Static meshes
         TIDVector<ComponentID, StaticMeshComponent*>                    m_registeredStaticMeshComponents;
-        TIDVector<ComponentID, StaticMeshComponent*>                    m_staticMeshComponents;
+        TIDVector<ComponentID, StaticMeshComponent*>                    m_staticMeshComponents;             // All components with a mesh set, regardless of mobility
+        TIDVector<ComponentID, StaticMeshComponent*>                    m_stationaryStaticMeshComponents;
+        TIDVector<ComponentID, StaticMeshComponent*>                    m_movableStaticMeshComponents;
         TVector<StaticMeshComponent const*>                             m_visibleStaticMeshComponents;
+        TVector<StaticMeshComponent const*>                             m_stationaryStaticMeshComponentsInCullingBounds;   // Cached culling result, ignores the component visibility flag
+        TVector<StaticMeshComponent const*>                             m_movableStaticMeshComponentsInView;
+        TVector<TVector<StaticMeshComponent const*>>                    m_perThreadStaticMeshComponents;
+        AABB                                                            m_stationaryMeshCullingBounds;
+        bool                                                            m_isStaticMeshCullingResultValid = false;
 
         // Skeletal meshes
         TIDVector<ComponentID, SkeletalMeshComponent*>                  m_registeredSkeletalMeshComponents;
+        TIDVector<ComponentID, SkeletalMeshComponent*>                  m_skeletalMeshComponents;
         TIDVector<uint32_t, SkeletalMeshGroup>                          m_skeletalMeshGroups;
         TVector<SkeletalMeshComponent const*>                           m_visibleSkeletalMeshComponents;
+        TVector<TVector<SkeletalMeshComponent const*>>                  m_perThreadSkeletalMeshComponents;
 
         // Lights
         TIDVector<ComponentID, DirectionalLightComponent*>              m_registeredDirectionLightComponents;
@@ -0,0 +1,212 @@
+#include "SessionCapture.h"
+#include "Engine/Entity/EntityWorld.h"
+#include "Engine/Entity/EntityWorldManager.h"
+#include "Base/Input/InputSystem.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/FileSystem/FileStreams.h"
+#include "Base/Serialization/BinarySerialization.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Replay
+{
+    bool SessionCapture::Save( FileSystem::Path const& capturePath ) const
+    {
+        Serialization::BinaryOutputArchive archive;
+        archive << *this;
+        return archive.WriteToFile( capturePath );
+    }
+
+    bool SessionCapture::Load( FileSystem::Path const& capturePath )
+    {
+        Serialization::BinaryInputArchive archive;
+        if ( !archive.ReadFromFile( capturePath ) )
+        {
+            return false;
+        }
+
+        archive << *this;
+        return m_version == s_version;
+    }
+
+    //-------------------------------------------------------------------------
+    // Recorder
+    //-------------------------------------------------------------------------
+
+    SessionRecorder::SessionRecorder( EntityWorld* pWorld, DataPath const& startupMap )
+        : m_pWorld( pWorld )
+    {
+        EE_ASSERT( m_pWorld != nullptr );
+        m_capture.m_startupMap = startupMap;
+
+        m_mapRequestedBindingID = m_pWorld->OnMapRequested().Bind( [this] ( ResourceID const& mapResourceID, bool isLoadRequest )
+        {
+            m_currentFrame.m_mapRequests.push_back( { mapResourceID, isLoadRequest } );
+        } );
+    }
+
+    SessionRecorder::~SessionRecorder()
+    {
+        m_pWorld->OnMapRequested().Unbind( m_mapRequestedBindingID );
+    }
+
+    void SessionRecorder::BeginFrame( Seconds deltaTime )
+    {
+        m_currentFrame = RecordedFrame();
+        m_currentFrame.m_deltaTime = deltaTime.ToFloat();
+
+        // Generate a seed for this frame and reseed the global generator with it so the same sequence of values is generated on replay
+        m_currentFrame.m_randomSeed = Math::GetRandomUInt( 1 );
+        Math::SetGlobalRandomSeed( m_currentFrame.m_randomSeed );
+    }
+
+    void SessionRecorder::RecordInputState( Input::InputSystem const& inputSystem )
+    {
+        inputSystem.RecordState( m_currentFrame.m_inputDeviceStates );
+    }
+
+    void SessionRecorder::EndFrame()
+    {
+        m_capture.m_frames.emplace_back( eastl::move( m_currentFrame ) );
+        m_currentFrame = RecordedFrame();
+    }
+
+    //-------------------------------------------------------------------------
+    // Player
+    //-------------------------------------------------------------------------
+
+    bool SessionPlayer::Load( FileSystem::Path const& capturePath )
+    {
+        m_capturePath = capturePath;
+        if ( !m_capture.Load( capturePath ) )
+        {
+            EE_LOG_ERROR( "Replay", nullptr, "Failed to load session capture: %s", capturePath.c_str() );
+            return false;
+        }
+
+        return true;
+    }
+
+    void SessionPlayer::Start( EntityWorld* pWorld )
+    {
+        EE_ASSERT( pWorld != nullptr );
+        m_pWorld = pWorld;
+        m_currentFrameIdx = 0;
+        m_frameTimings.clear();
+        m_frameTimings.reserve( m_capture.m_frames.size() );
+
+        EE_LOG_INFO( "Replay", nullptr, "Replaying %d frames from %s", (int32_t) m_capture.m_frames.size(), m_capturePath.c_str() );
+        Profiling::StartCapture();
+    }
+
+    void SessionPlayer::BeginFrame()
+    {
+        EE_ASSERT( !IsComplete() );
+        Math::SetGlobalRandomSeed( m_capture.m_frames[m_currentFrameIdx].m_randomSeed );
+    }
+
+    void SessionPlayer::ReplayInputState( Input::InputSystem& inputSystem ) const
+    {
+        EE_ASSERT( !IsComplete() );
+        inputSystem.ReplayState( m_capture.m_frames[m_currentFrameIdx].m_inputDeviceStates );
+    }
+
+    void SessionPlayer::ReplayMapRequests()
+    {
+        EE_ASSERT( !IsComplete() && m_pWorld != nullptr );
+
+        // Requests made by the simulation itself will have already been made this frame, so only apply the ones that are still outstanding
+        for ( RecordedMapRequest const& request : m_capture.m_frames[m_currentFrameIdx].m_mapRequests )
+        {
+            EntityModel::EntityMap const* pMap = m_pWorld->GetMap( request.m_mapResourceID );
+            if ( request.m_isLoadRequest )
+            {
+                if ( pMap == nullptr )
+                {
+                    m_pWorld->LoadMap( request.m_mapResourceID );
+                }
+            }
+            else if ( pMap != nullptr && !pMap->IsUnloading() && !pMap->IsUnloaded() )
+            {
+                m_pWorld->UnloadMap( request.m_mapResourceID );
+            }
+        }
+    }
+
+    void SessionPlayer::EndFrame( Milliseconds frameTime, EntityWorldManager const& worldManager )
+    {
+        EE_ASSERT( !IsComplete() );
+
+        FrameTimings& timings = m_frameTimings.emplace_back();
+        timings.m_frameTime = frameTime;
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            timings.m_worldUpdateTimes[i] = worldManager.GetWorldsUpdateTime( (UpdateStage) i );
+        }
+
+        m_currentFrameIdx++;
+    }
+
+    void SessionPlayer::SaveReport()
+    {
+        if ( m_isReportSaved || m_frameTimings.empty() )
+        {
+            return;
+        }
+
+        m_isReportSaved = true;
+
+        // Profiler capture
+        //-------------------------------------------------------------------------
+
+        Profiling::StopCapture( m_capturePath.GetWithAppendedExtension( "opt" ) );
+
+        // Per-frame timings
+        //-------------------------------------------------------------------------
+
+        String reportData = "Frame,FrameTime,FrameStart,PrePhysics,Physics,PostPhysics,FrameEnd,Paused\r\n";
+        InlineString line;
+
+        TVector<float> sortedFrameTimes;
+        sortedFrameTimes.reserve( m_frameTimings.size() );
+        float totalFrameTime = 0.0f;
+
+        for ( int32_t i = 0; i < (int32_t) m_frameTimings.size(); i++ )
+        {
+            FrameTimings const& timings = m_frameTimings[i];
+            line.sprintf( "%d,%.3f", i, timings.m_frameTime.ToFloat() );
+            for ( int8_t s = 0; s < (int8_t) UpdateStage::NumStages; s++ )
+            {
+                line.append_sprintf( ",%.3f", timings.m_worldUpdateTimes[s].ToFloat() );
+            }
+            line.append( "\r\n" );
+            reportData.append( line.c_str() );
+
+            sortedFrameTimes.emplace_back( timings.m_frameTime.ToFloat() );
+            totalFrameTime += timings.m_frameTime.ToFloat();
+        }
+
+        FileSystem::Path const reportPath = m_capturePath.GetWithAppendedExtension( "csv" );
+        FileSystem::OutputFileStream reportFile( reportPath );
+        if ( reportFile.IsValid() )
+        {
+            reportFile.Write( (void*) reportData.data(), reportData.size() );
+            reportFile.Close();
+        }
+        else
+        {
+            EE_LOG_ERROR( "Replay", nullptr, "Failed to write replay report: %s", reportPath.c_str() );
+        }
+
+        // Summary
+        //-------------------------------------------------------------------------
+
+        eastl::sort( sortedFrameTimes.begin(), sortedFrameTimes.end() );
+        int32_t const numFrames = (int32_t) sortedFrameTimes.size();
+        float const averageFrameTime = totalFrameTime / numFrames;
+        float const medianFrameTime = sortedFrameTimes[numFrames / 2];
+        float const p95FrameTime = sortedFrameTimes[( numFrames * 95 ) / 100];
+        EE_LOG_INFO( "Replay", nullptr, "Replayed %d frames - Avg: %.3fms, Median: %.3fms, P95: %.3fms, Max: %.3fms", numFrames, averageFrameTime, medianFrameTime, p95FrameTime, sortedFrameTimes.back() );
+    }
+}
\ No newline at end of file
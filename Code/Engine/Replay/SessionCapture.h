@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/UpdateStage.h"
+#include "Base/Input/InputDevice.h"
+#include "Base/Resource/ResourceID.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Types/Event.h"
+
+//-------------------------------------------------------------------------
+// Session Capture
+//-------------------------------------------------------------------------
+// Records the per-frame inputs of a game world session so that the session can be replayed deterministically
+// We record the frame time delta, the input device state, the global random seed and any map load/unload requests
+//
+// Note: Both capture and replay force deterministic world updates (all entities, world systems and worlds are updated sequentially on the main thread)
+//       so the global random generator is consumed in the same order, this means replay frame times do not include any update parallelism
+// Note: Only the global random generator is reseeded, systems that use their own non-deterministic generators will diverge during replay
+// Note: Map requests made during a frame are reapplied at the end of that frame if the replayed simulation hasnt already made them
+// Note: Entity spawn requests are not captured, any entities spawned by the simulation are expected to be respawned by the replayed simulation
+
+namespace EE
+{
+    class EntityWorld;
+    class EntityWorldManager;
+    namespace Input { class InputSystem; }
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::Replay
+{
+    struct RecordedMapRequest
+    {
+        EE_SERIALIZE( m_mapResourceID, m_isLoadRequest );
+
+        ResourceID                                      m_mapResourceID;
+        bool                                            m_isLoadRequest = true;
+    };
+
+    struct RecordedFrame
+    {
+        EE_SERIALIZE( m_deltaTime, m_randomSeed, m_inputDeviceStates, m_mapRequests );
+
+        float                                           m_deltaTime = 0.0f;
+        uint32_t                                        m_randomSeed = 1;
+        TInlineVector<Input::RecordedDeviceState, 5>    m_inputDeviceStates;
+        TInlineVector<RecordedMapRequest, 1>            m_mapRequests;
+    };
+
+    struct SessionCapture
+    {
+        EE_SERIALIZE( m_version, m_startupMap, m_frames );
+
+        constexpr static int32_t const s_version = 0;
+
+    public:
+
+        bool Save( FileSystem::Path const& capturePath ) const;
+        bool Load( FileSystem::Path const& capturePath );
+
+    public:
+
+        int32_t                                         m_version = s_version;
+        DataPath                                        m_startupMap;
+        TVector<RecordedFrame>                          m_frames;
+    };
+
+    //-------------------------------------------------------------------------
+    // Recorder
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API SessionRecorder
+    {
+    public:
+
+        SessionRecorder( EntityWorld* pWorld, DataPath const& startupMap );
+        ~SessionRecorder();
+
+        inline int32_t GetNumRecordedFrames() const { return (int32_t) m_capture.m_frames.size(); }
+
+        // Called at the very start of the frame, before anything has generated any random numbers
+        void BeginFrame( Seconds deltaTime );
+
+        // Called after the input system has been updated
+        void RecordInputState( Input::InputSystem const& inputSystem );
+
+        // Called once all the frame updates are complete
+        void EndFrame();
+
+        // Save all recorded frames
+        bool Save( FileSystem::Path const& capturePath ) const { return m_capture.Save( capturePath ); }
+
+    private:
+
+        EntityWorld*                                    m_pWorld = nullptr;
+        EventBindingID                                  m_mapRequestedBindingID;
+        SessionCapture                                  m_capture;
+        RecordedFrame                                   m_currentFrame;
+    };
+
+    //-------------------------------------------------------------------------
+    // Player
+    //-------------------------------------------------------------------------
+    // Replays a recorded session and records the frame timings so that they can be compared between builds
+
+    class EE_ENGINE_API SessionPlayer
+    {
+        struct FrameTimings
+        {
+            Milliseconds                                m_frameTime = 0;
+            Milliseconds                                m_worldUpdateTimes[(int8_t) UpdateStage::NumStages];
+        };
+
+    public:
+
+        bool Load( FileSystem::Path const& capturePath );
+
+        inline DataPath const& GetStartupMap() const { return m_capture.m_startupMap; }
+        inline bool IsComplete() const { return m_currentFrameIdx >= (int32_t) m_capture.m_frames.size(); }
+
+        // Start the replay, this will also start a profiler capture (if available)
+        void Start( EntityWorld* pWorld );
+
+        // Get the delta time to use for the current frame
+        inline Seconds GetFrameDeltaTime() const { EE_ASSERT( !IsComplete() ); return m_capture.m_frames[m_currentFrameIdx].m_deltaTime; }
+
+        // Called at the very start of the frame, before anything has generated any random numbers
+        void BeginFrame();
+
+        // Called instead of the input system update
+        void ReplayInputState( Input::InputSystem& inputSystem ) const;
+
+        // Called once all the world updates are complete to apply any outstanding map requests
+        void ReplayMapRequests();
+
+        // Called once all the frame updates are complete with the measured frame time, this advances the replay to the next frame
+        void EndFrame( Milliseconds frameTime, EntityWorldManager const& worldManager );
+
+        // Stops the profiler capture and writes out the per-frame timings and a summary to the log
+        void SaveReport();
+
+    private:
+
+        FileSystem::Path                                m_capturePath;
+        SessionCapture                                  m_capture;
+        TVector<FrameTimings>                           m_frameTimings;
+        EntityWorld*                                    m_pWorld = nullptr;
+        int32_t                                         m_currentFrameIdx = 0;
+        bool                                            m_isReportSaved = false;
+    };
+}
\ No newline at end of file
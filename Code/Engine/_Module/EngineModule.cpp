@@ -31,7 +31,7 @@ namespace EE
         // Initialize and register renderers
         //-------------------------------------------------------------------------
 
-        if ( m_worldRenderer.Initialize( context.m_pRenderDevice ) )
+        if ( m_worldRenderer.Initialize( context.m_pRenderDevice, context.m_pTaskSystem ) )
         {
             m_rendererRegistry.RegisterRenderer( &m_worldRenderer );
         }
@@ -39,6 +39,12 @@ namespace EE::Animation
             EE_ASSERT( m_pActiveUndoableAction != nullptr );
             EE_ASSERT( IsDataFileLoaded() );
             EndDataFileModification();
+
+            // Event items can be edited directly via the property grid
+            if ( m_pTimelineEditor != nullptr )
+            {
+                m_pTimelineEditor->NotifyTimelineDataExternallyModified();
+            }
         };
 
         m_propertyGridPreEditEventBindingID = m_propertyGrid.OnPreEdit().Bind( PreDescEdit );
@@ -722,4 +728,14 @@ namespace EE::Animation
         TResourceEditor<AnimationClip>::PreUndoRedo( operation );
         m_propertyGrid.SetTypeToEdit( nullptr );
     }
+
+    void AnimationClipEditor::PostUndoRedo( UndoStack::Operation operation, IUndoableAction const* pAction )
+    {
+        TResourceEditor<AnimationClip>::PostUndoRedo( operation, pAction );
+
+        if ( m_pTimelineEditor != nullptr )
+        {
+            m_pTimelineEditor->NotifyTimelineDataExternallyModified();
+        }
+    }
 }
\ No newline at end of file
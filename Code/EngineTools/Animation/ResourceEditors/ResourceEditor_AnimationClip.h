@@ -73,6 +73,7 @@ namespace EE::Animation
         virtual bool SaveData() override;
 
         virtual void PreUndoRedo( UndoStack::Operation operation ) override;
+        virtual void PostUndoRedo( UndoStack::Operation operation, IUndoableAction const* pAction ) override;
 
         virtual bool HasTitlebarIcon() const override { return true; }
         virtual char const* GetTitlebarIcon() const override { EE_ASSERT( HasTitlebarIcon() ); return EE_ICON_RUN_FAST; }
@@ -8,20 +8,43 @@
 
 namespace EE
 {
-    DataFileResaver::DataFileResaver( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& sourceDataDirectoryPath )
+    DataFileResaver::DataFileResaver( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& sourceDataDirectoryPath, TaskSystem* pTaskSystem )
         : m_typeRegistry( typeRegistry )
         , m_sourceDataDirectoryPath( sourceDataDirectoryPath )
+        , m_pTaskSystem( pTaskSystem )
     {
         EE_ASSERT( sourceDataDirectoryPath.IsValid() && sourceDataDirectoryPath.IsDirectoryPath() && sourceDataDirectoryPath.Exists() );
     }
 
+    DataFileResaver::~DataFileResaver()
+    {
+        if ( m_isResaving )
+        {
+            EndResave();
+        }
+
+        EE_ASSERT( m_pResaveTask == nullptr );
+    }
+
     void DataFileResaver::Reset()
     {
+        EE_ASSERT( m_pResaveTask == nullptr );
         m_filesToResave.clear();
         m_numFilesResaved = 0;
+        m_cancelResave = false;
         m_isResaving = false;
     }
 
+    void DataFileResaver::ResaveFile( FileSystem::Path const& filePath ) const
+    {
+        IDataFile* pDatafile = IDataFile::TryReadFromFile( m_typeRegistry, filePath );
+        if ( pDatafile != nullptr )
+        {
+            IDataFile::TryWriteToFile( m_typeRegistry, filePath, pDatafile, false );
+            EE::Delete( pDatafile );
+        }
+    }
+
     bool DataFileResaver::BeginResave()
     {
         EE_ASSERT( !m_isResaving ); // Dont call begin without calling end
@@ -52,6 +75,32 @@ namespace EE
         }
 
         m_isResaving = true;
+
+        // Schedule parallel resave
+        //-------------------------------------------------------------------------
+        // Each task partition processes a small batch of files, so the number of files in flight is bounded by the number of workers
+
+        if ( m_pTaskSystem != nullptr && !m_filesToResave.empty() )
+        {
+            auto ResaveFiles = [this] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    if ( m_cancelResave )
+                    {
+                        break;
+                    }
+
+                    ResaveFile( m_filesToResave[i] );
+                    m_numFilesResaved++;
+                }
+            };
+
+            m_pResaveTask = EE::New<AsyncTask>( (uint32_t) m_filesToResave.size(), ResaveFiles );
+            m_pResaveTask->m_MinRange = s_numFilesPerBatch;
+            m_pTaskSystem->ScheduleTask( m_pResaveTask );
+        }
+
         return true;
     }
 
@@ -62,6 +111,20 @@ namespace EE
         //-------------------------------------------------------------------------
 
         int32_t const numFiles = int32_t( m_filesToResave.size() );
+
+        // Async resave - just release the task once all the files have been processed
+        if ( m_pResaveTask != nullptr )
+        {
+            if ( m_pResaveTask->GetIsComplete() )
+            {
+                EE::Delete( m_pResaveTask );
+            }
+
+            return numFiles - m_numFilesResaved;
+        }
+
+        //-------------------------------------------------------------------------
+
         int32_t const numFilesRemaining = numFiles - m_numFilesResaved;
 
         // Resave all
@@ -87,12 +150,7 @@ namespace EE
         EE_ASSERT( endIdx < numFiles );
         for ( int32_t i = startIdx; i <= endIdx; i++ )
         {
-            IDataFile* pDatafile = IDataFile::TryReadFromFile( m_typeRegistry, m_filesToResave[i] );
-            if ( pDatafile != nullptr )
-            {
-                IDataFile::TryWriteToFile( m_typeRegistry, m_filesToResave[i], pDatafile, false );
-                EE::Delete( pDatafile );
-            }
+            ResaveFile( m_filesToResave[i] );
         }
 
         // Update file counter
@@ -104,6 +162,14 @@ namespace EE
     void DataFileResaver::EndResave()
     {
         EE_ASSERT( m_isResaving ); // Dont call end without begin
+
+        if ( m_pResaveTask != nullptr )
+        {
+            m_cancelResave = true;
+            m_pTaskSystem->WaitForTask( m_pResaveTask );
+            EE::Delete( m_pResaveTask );
+        }
+
         Reset();
     }
 
@@ -114,7 +180,7 @@ namespace EE
             return 0;
         }
 
-        return int32_t( m_filesToResave.size() );
+        return int32_t( m_filesToResave.size() ) - m_numFilesResaved;
     }
 
     Percentage DataFileResaver::GetProgress() const
@@ -124,6 +190,11 @@ namespace EE
             return 1.0f;
         }
 
+        if ( m_filesToResave.empty() )
+        {
+            return 1.0f;
+        }
+
         return Percentage( float( m_numFilesResaved ) / m_filesToResave.size() );
     }
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "EngineTools/_Module/API.h"
 #include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/Types/Percentage.h"
 
 //-------------------------------------------------------------------------
@@ -10,12 +11,19 @@ namespace EE
     namespace TypeSystem { class TypeRegistry; }
 
     //-------------------------------------------------------------------------
+    // Data File Resaver
+    //-------------------------------------------------------------------------
+    // If a task system is provided, the resave is executed in parallel in batches of files on the task system
+    // Otherwise, the files are resaved on the calling thread as part of the update
 
     class EE_ENGINETOOLS_API DataFileResaver
     {
+        constexpr static uint32_t const s_numFilesPerBatch = 8;
+
     public:
 
-        DataFileResaver( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& sourceDataDirectoryPath );
+        DataFileResaver( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& sourceDataDirectoryPath, TaskSystem* pTaskSystem = nullptr );
+        ~DataFileResaver();
 
         void Reset();
 
@@ -29,10 +37,10 @@ namespace EE
         bool BeginResave();
 
         // Update a resave operation - returns the number of files left to resave
-        // User can optionally specify the number of files to resave
+        // User can optionally specify the number of files to resave, this is ignored when resaving on the task system
         int32_t UpdateResave( int32_t numFilesToResave = -1 );
 
-        // Complete a resave operation
+        // Complete a resave operation - will cancel and wait for any in-flight resave work
         void EndResave();
 
         // Get the total number of files that need to be resaved
@@ -41,12 +49,19 @@ namespace EE
         // Get the number of files that still need to be resaved
         int32_t GetNumberOfFilesLeftToResave() const;
 
+    private:
+
+        void ResaveFile( FileSystem::Path const& filePath ) const;
+
     private:
 
         TypeSystem::TypeRegistry const&     m_typeRegistry;
         FileSystem::Path const              m_sourceDataDirectoryPath;
+        TaskSystem*                         m_pTaskSystem = nullptr;
+        ITaskSet*                           m_pResaveTask = nullptr;
         TVector<FileSystem::Path>           m_filesToResave;
-        int32_t                             m_numFilesResaved = 0;
+        std::atomic<int32_t>                m_numFilesResaved = 0;
+        std::atomic<bool>                   m_cancelResave = false;
         bool                                m_isResaving = false;
     };
-}
\ No newline at end of file
+}
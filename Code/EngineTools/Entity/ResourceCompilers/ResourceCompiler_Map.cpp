@@ -1,6 +1,7 @@
 #include "ResourceCompiler_Map.h"
 #include "EngineTools/Entity/EntitySerializationTools.h"
 #include "Engine/Entity/EntityDescriptors.h"
+#include "Engine/Entity/Components/Component_MapStreamingSettings.h"
 #include "Engine/Navmesh/Components/Component_Navmesh.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Serialization/BinarySerialization.h"
@@ -106,6 +107,39 @@ namespace EE::EntityModel
             pNavmeshComponentDesc->m_properties.emplace_back( navmeshPtrPropertyDesc );
         }
 
+        //-------------------------------------------------------------------------
+        // Partitioning
+        //-------------------------------------------------------------------------
+
+        auto const streamingSettingsComponents = map.GetComponentsOfType<MapStreamingSettingsComponent>( *m_pTypeRegistry, false );
+        if ( !streamingSettingsComponents.empty() )
+        {
+            if ( streamingSettingsComponents.size() > 1 )
+            {
+                Warning( "More than one map streaming settings component found in this map, this is not supported... Ignoring all components apart from the first found!" );
+            }
+
+            auto pStreamingSettingsComponent = streamingSettingsComponents[0].m_pComponent->CreateType<MapStreamingSettingsComponent>( *m_pTypeRegistry );
+            EE_ASSERT( pStreamingSettingsComponent != nullptr );
+            MapStreamingSettings const streamingSettings = pStreamingSettingsComponent->GetStreamingSettings();
+            EE::Delete( pStreamingSettingsComponent );
+
+            if ( !streamingSettings.IsValid() )
+            {
+                return Error( "Invalid map streaming settings: the cell size and budgets need to be greater than zero!" );
+            }
+
+            // The navmesh covers the whole map so always needs to be loaded
+            TInlineVector<TypeSystem::TypeID, 4> const alwaysLoadedComponentTypes = { Navmesh::NavmeshComponent::GetStaticTypeID() };
+
+            {
+                ScopedTimer<PlatformClock> timer( elapsedTime );
+                map.PartitionIntoStreamingCells( *m_pTypeRegistry, streamingSettings, alwaysLoadedComponentTypes );
+            }
+
+            Message( "Entity map partitioned into %d streaming cells in: %.2fms", (int32_t) map.GetStreamingCells().size(), elapsedTime.ToFloat() );
+        }
+
         //-------------------------------------------------------------------------
         // Serialize
         //-------------------------------------------------------------------------
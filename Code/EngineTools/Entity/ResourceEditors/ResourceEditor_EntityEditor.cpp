@@ -2715,9 +2715,10 @@ namespace EE::EntityModel
 
         //-------------------------------------------------------------------------
 
+        // Only the edited component is shutdown, its resources only need reloading if the edit could change a resource pointer
         if ( auto pComponent = TryCast<EntityComponent>( eventInfo.m_pOwnerTypeInstance ) )
         {
-            m_pWorld->BeginComponentEdit( pComponent );
+            m_pWorld->BeginComponentEdit( pComponent, EntityWorld::DoesPropertyEditRequireResourceReload( eventInfo.m_pPropertyInfo ) );
         }
     }
 
@@ -32,6 +32,11 @@ namespace EE::NodeGraph
     {
         friend class GraphView;
 
+    public:
+
+        // Below this view scale, nodes are drawn as title-only boxes and connections as straight lines
+        constexpr static float const s_simplifiedDrawingViewScaleThreshold = 0.5f;
+
     public:
 
         // Scaling and Conversion Function
@@ -122,6 +127,18 @@ namespace EE::NodeGraph
             return m_canvasVisibleRect.Overlaps( itemCanvasRect );
         }
 
+        // Is a supplied rect (in screen space) within the visible window area
+        EE_FORCE_INLINE bool IsScreenRectVisible( ImRect const& itemScreenRect ) const
+        {
+            return m_windowRect.Overlaps( itemScreenRect );
+        }
+
+        // Should we draw simplified node representations (i.e. we are too zoomed out for the details to be legible)
+        EE_FORCE_INLINE bool IsSimplifiedDrawingEnabled() const
+        {
+            return m_viewScaleFactor < s_simplifiedDrawingViewScaleThreshold;
+        }
+
         // Set the draw list channel to use
         EE_FORCE_INLINE void SetDrawChannel( uint8_t channelIndex ) const
         {
@@ -68,6 +68,7 @@ namespace EE::NodeGraph
 
         Float2                  m_position = Float2( 0, 0 ); // Updated each frame ( rendered window space )
         Float2                  m_size = Float2( -1, -1 ); // Updated each frame ( rendered window space ) - used to render offset correctly;
+        Float2                  m_nodeOffset = Float2( 0, 0 ); // Updated when the node is fully drawn ( canvas space offset from the node position ) - used to place pins of culled/simplified nodes
     };
 
     //-------------------------------------------------------------------------
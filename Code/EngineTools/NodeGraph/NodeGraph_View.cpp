@@ -92,6 +92,62 @@ namespace EE::NodeGraph
 
     //-------------------------------------------------------------------------
 
+    void GraphView::NodeSpatialGrid::Build( BaseGraph const* pGraph )
+    {
+        m_cells.clear();
+
+        if ( pGraph == nullptr )
+        {
+            return;
+        }
+
+        int32_t const numNodes = (int32_t) pGraph->m_nodes.size();
+        for ( int32_t i = 0; i < numNodes; i++ )
+        {
+            ImRect const nodeRect = pGraph->m_nodes[i]->GetRect();
+            int32_t const minX = (int32_t) Math::Floor( nodeRect.Min.x / s_cellSize );
+            int32_t const minY = (int32_t) Math::Floor( nodeRect.Min.y / s_cellSize );
+            int32_t const maxX = (int32_t) Math::Floor( nodeRect.Max.x / s_cellSize );
+            int32_t const maxY = (int32_t) Math::Floor( nodeRect.Max.y / s_cellSize );
+
+            for ( int32_t y = minY; y <= maxY; y++ )
+            {
+                for ( int32_t x = minX; x <= maxX; x++ )
+                {
+                    m_cells[GetCellKey( x, y )].emplace_back( i );
+                }
+            }
+        }
+    }
+
+    void GraphView::NodeSpatialGrid::FindNodes( ImRect const& canvasRect, TVector<int32_t>& outNodeIndices ) const
+    {
+        outNodeIndices.clear();
+
+        int32_t const minX = (int32_t) Math::Floor( canvasRect.Min.x / s_cellSize );
+        int32_t const minY = (int32_t) Math::Floor( canvasRect.Min.y / s_cellSize );
+        int32_t const maxX = (int32_t) Math::Floor( canvasRect.Max.x / s_cellSize );
+        int32_t const maxY = (int32_t) Math::Floor( canvasRect.Max.y / s_cellSize );
+
+        for ( int32_t y = minY; y <= maxY; y++ )
+        {
+            for ( int32_t x = minX; x <= maxX; x++ )
+            {
+                auto foundIter = m_cells.find( GetCellKey( x, y ) );
+                if ( foundIter != m_cells.end() )
+                {
+                    outNodeIndices.insert( outNodeIndices.end(), foundIter->second.begin(), foundIter->second.end() );
+                }
+            }
+        }
+
+        // Nodes spanning multiple cells will be duplicated
+        eastl::sort( outNodeIndices.begin(), outNodeIndices.end() );
+        outNodeIndices.erase( eastl::unique( outNodeIndices.begin(), outNodeIndices.end() ), outNodeIndices.end() );
+    }
+
+    //-------------------------------------------------------------------------
+
     GraphView::GraphView( UserContext* m_pUserContext )
         : m_pUserContext( m_pUserContext )
     {
@@ -195,6 +251,7 @@ namespace EE::NodeGraph
         m_contextMenuState.Reset();
         m_dragState.Reset();
         m_dragAndDropState.Reset();
+        m_spatialGrid.Clear();
         ClearSelection();
     }
 
@@ -319,9 +376,13 @@ namespace EE::NodeGraph
             m_pGraph->m_viewOffset += ( ( ctx.m_mouseCanvasPos - m_pGraph->m_viewOffset ) * deltaScale ) / newViewScale;
             m_pGraph->m_viewScaleFactor = newViewScale;
 
-            for ( TTypeInstance<BaseNode>& nodeInstance : m_pGraph->m_nodes )
+            // Simplified drawing relies on the last fully calculated node sizes, so only reset them when we will fully draw the nodes
+            if ( newViewScale >= DrawContext::s_simplifiedDrawingViewScaleThreshold )
             {
-                nodeInstance->ResetCalculatedNodeSizes();
+                for ( TTypeInstance<BaseNode>& nodeInstance : m_pGraph->m_nodes )
+                {
+                    nodeInstance->ResetCalculatedNodeSizes();
+                }
             }
         }
     }
@@ -335,6 +396,13 @@ namespace EE::NodeGraph
             return;
         }
 
+        // Culled nodes cannot be hovered since the mouse is always within the visible area when hovering the view
+        if ( !ctx.IsItemVisible( pNode->GetRect() ) )
+        {
+            pNode->m_isHovered = false;
+            return;
+        }
+
         //-------------------------------------------------------------------------
         // Split Channels
         //-------------------------------------------------------------------------
@@ -485,6 +553,18 @@ namespace EE::NodeGraph
         startPoint += offset;
         endPoint += offset;
 
+        // Cull transitions outside the visible area
+        //-------------------------------------------------------------------------
+
+        ImRect const transitionRect( ImMin( startPoint, endPoint ), ImMax( startPoint, endPoint ) );
+        if ( !ctx.IsItemVisible( transitionRect ) )
+        {
+            pTransitionConduit->m_isHovered = false;
+            pTransitionConduit->m_canvasPosition = transitionRect.Min;
+            pTransitionConduit->m_size = transitionRect.GetSize();
+            return;
+        }
+
         // Update hover state and visual state
         //-------------------------------------------------------------------------
 
@@ -554,6 +634,24 @@ namespace EE::NodeGraph
             return;
         }
 
+        // Cull nodes outside the visible area - we still need valid pin positions for any connections to this node
+        //-------------------------------------------------------------------------
+
+        if ( !ctx.IsItemVisible( pNode->GetRect() ) )
+        {
+            UpdatePinPositionsFromNodeOffsets( ctx, pNode );
+            pNode->m_pHoveredPin = nullptr;
+            pNode->m_isHovered = false;
+            return;
+        }
+
+        // We need at least one full draw to calculate the node size, before we can switch to the simplified representation
+        if ( ctx.IsSimplifiedDrawingEnabled() && pNode->GetWidth() > 0.0f )
+        {
+            DrawSimplifiedFlowNode( ctx, pNode );
+            return;
+        }
+
         //-------------------------------------------------------------------------
         // Split Channels
         //-------------------------------------------------------------------------
@@ -663,6 +761,8 @@ namespace EE::NodeGraph
                             pin.m_position = ImVec2( pinRect.Max.x + scaledNodeMargin.x, pinRect.Min.y + pinOffsetY );
                         }
 
+                        pin.m_nodeOffset = Float2( ctx.ScreenToCanvasPosition( pin.m_position ) ) - pNode->GetPosition();
+
                         // Check hover state - do it in window space since pin position/size are in window space
                         Color pinColor = pNode->GetPinColor( pin );
                         bool const isPinHovered = Vector( pin.m_position ).GetDistance2( ImGui::GetMousePos() ) < ctx.CanvasToWindow( g_pinRadius + FlowNode::s_pinSelectionExtraRadius );
@@ -820,6 +920,70 @@ namespace EE::NodeGraph
         pNode->m_isHovered = m_isViewHovered && nodeRect.Contains( ctx.m_mouseCanvasPos ) || pNode->m_pHoveredPin != nullptr;
     }
 
+    void GraphView::DrawSimplifiedFlowNode( DrawContext const& ctx, FlowNode* pNode )
+    {
+        EE_ASSERT( pNode != nullptr );
+
+        // Only emit draw-list primitives, no ImGui items are created for simplified nodes
+        //-------------------------------------------------------------------------
+
+        UpdatePinPositionsFromNodeOffsets( ctx, pNode );
+        pNode->m_pHoveredPin = nullptr;
+
+        ImRect const nodeRect = pNode->GetRect();
+        pNode->m_isHovered = m_isViewHovered && nodeRect.Contains( ctx.m_mouseCanvasPos );
+
+        //-------------------------------------------------------------------------
+
+        TBitFlags<NodeVisualState> visualState;
+        visualState.SetFlag( NodeVisualState::Active, pNode->IsActive( m_pUserContext ) );
+        visualState.SetFlag( NodeVisualState::Selected, IsNodeSelected( pNode ) );
+        visualState.SetFlag( NodeVisualState::Hovered, pNode->m_isHovered );
+
+        Color nodeTitleBarColor, nodeBackgroundColor, nodeBorderColor;
+        GetNodeBackgroundAndBorderColors( Style::s_defaultTitleColor, Style::s_nodeBackgroundColor, visualState, nodeTitleBarColor, nodeBackgroundColor, nodeBorderColor );
+
+        ImVec2 const backgroundRectMin = ctx.CanvasToScreenPosition( nodeRect.Min );
+        ImVec2 const backgroundRectMax = ctx.CanvasToScreenPosition( nodeRect.Max );
+        ImVec2 const rectTitleBarMax( backgroundRectMax.x, backgroundRectMin.y + ctx.CanvasToWindow( pNode->m_titleRectSize.m_y + pNode->GetNodeMargin().y * 2 ) );
+        ImVec2 const rectTitleBarColorItemMax( backgroundRectMin.x + ( ctx.m_viewScaleFactor * g_titleBarColorItemWidth ), rectTitleBarMax.y );
+        float const scaledBorderThickness = g_nodeSelectionBorderThickness * ctx.m_viewScaleFactor;
+
+        if ( visualState.IsFlagSet( NodeVisualState::Active ) )
+        {
+            ImVec2 const activeBorderPadding( Style::s_activeBorderIndicatorPadding, Style::s_activeBorderIndicatorPadding );
+            ctx.m_pDrawList->AddRect( backgroundRectMin - activeBorderPadding, backgroundRectMax + activeBorderPadding, Style::s_activeIndicatorBorderColor, 0.0f, ImDrawFlags_RoundCornersNone, Style::s_activeBorderIndicatorThickness );
+        }
+
+        ctx.m_pDrawList->AddRectFilled( backgroundRectMin, backgroundRectMax, nodeBackgroundColor );
+        ctx.m_pDrawList->AddRectFilled( backgroundRectMin, rectTitleBarMax, nodeTitleBarColor );
+        ctx.m_pDrawList->AddRectFilled( backgroundRectMin, rectTitleBarColorItemMax, pNode->GetTitleBarColor() );
+        ctx.m_pDrawList->AddRect( backgroundRectMin, backgroundRectMax, nodeBorderColor, 0.0f, ImDrawFlags_RoundCornersNone, scaledBorderThickness );
+
+        ImFont* pTitleFont = ImGuiX::GetFont( ImGuiX::Font::MediumBold );
+        ImVec2 const textPosition = ctx.CanvasToScreenPosition( pNode->GetPosition() ) + ImVec2( ctx.m_viewScaleFactor * g_titleBarColorItemWidth, 0 );
+        ctx.m_pDrawList->PushClipRect( backgroundRectMin, rectTitleBarMax, true );
+        ctx.m_pDrawList->AddText( pTitleFont, pTitleFont->FontSize * ctx.m_viewScaleFactor, textPosition, Colors::White, pNode->GetName() );
+        ctx.m_pDrawList->PopClipRect();
+    }
+
+    void GraphView::UpdatePinPositionsFromNodeOffsets( DrawContext const& ctx, FlowNode* pNode ) const
+    {
+        EE_ASSERT( pNode != nullptr );
+
+        Float2 const nodePosition = pNode->GetPosition();
+
+        for ( Pin& pin : pNode->m_inputPins )
+        {
+            pin.m_position = ctx.CanvasToScreenPosition( nodePosition + pin.m_nodeOffset );
+        }
+
+        for ( Pin& pin : pNode->m_outputPins )
+        {
+            pin.m_position = ctx.CanvasToScreenPosition( nodePosition + pin.m_nodeOffset );
+        }
+    }
+
     void GraphView::DrawCommentNode( DrawContext const& ctx, CommentNode* pNode )
     {
         EE_ASSERT( pNode != nullptr );
@@ -829,6 +993,15 @@ namespace EE::NodeGraph
             return;
         }
 
+        // Culled comments cannot be hovered, the hover test is dilated so do the same for the visibility test
+        ImRect dilatedCommentNodeRect = pNode->GetRect();
+        dilatedCommentNodeRect.Expand( ctx.WindowToCanvas( CommentNode::s_resizeSelectionRadius / 2 ) );
+        if ( !ctx.IsItemVisible( dilatedCommentNodeRect ) )
+        {
+            pNode->m_isHovered = false;
+            return;
+        }
+
         //-------------------------------------------------------------------------
         // Split Channels
         //-------------------------------------------------------------------------
@@ -964,7 +1137,7 @@ namespace EE::NodeGraph
             drawingContext.m_pDrawList = ImGui::GetWindowDrawList();
             drawingContext.m_viewOffset = *m_pViewOffset;
             drawingContext.m_windowRect = pWindow->Rect();
-            drawingContext.m_canvasVisibleRect = ImRect( drawingContext.m_viewOffset, drawingContext.m_viewOffset + drawingContext.m_windowRect.GetSize());
+            drawingContext.m_canvasVisibleRect = ImRect( drawingContext.m_viewOffset, drawingContext.m_viewOffset + drawingContext.WindowToCanvas( drawingContext.m_windowRect.GetSize() ) );
             drawingContext.m_mouseScreenPos = ImGui::GetMousePos();
             drawingContext.m_mouseCanvasPos = drawingContext.ScreenToCanvasPosition( drawingContext.m_mouseScreenPos );
 
@@ -1053,6 +1226,8 @@ namespace EE::NodeGraph
                     //-------------------------------------------------------------------------
 
                     m_hoveredConnectionID.Clear();
+                    bool const drawSimplifiedConnections = drawingContext.IsSimplifiedDrawingEnabled();
+                    float const connectionThickness = Math::Max( 1.0f, 3.0f * drawingContext.m_viewScaleFactor );
                     for ( FlowGraph::Connection const& connection : pFlowGraph->m_connections )
                     {
                         FlowNode* pFromNode = Cast<FlowNode>( pFlowGraph->GetNode( connection.m_fromNodeID ) );
@@ -1066,14 +1241,38 @@ namespace EE::NodeGraph
                         ImVec2 const p2 = p1 + ImVec2( 50, 0 );
                         ImVec2 const p3 = p4 + ImVec2( -50, 0 );
 
+                        // Cull connections outside the visible area - the curve is always contained within the bounds of its control points
+                        ImRect connectionBounds( ImMin( p1, p4 ), ImMax( p1, p4 ) );
+                        connectionBounds.Add( p2 );
+                        connectionBounds.Add( p3 );
+                        connectionBounds.Expand( connectionThickness + g_connectionSelectionExtraRadius );
+                        if ( !drawingContext.IsScreenRectVisible( connectionBounds ) )
+                        {
+                            continue;
+                        }
+
                         Color connectionColor = pFromNode->GetPinColor( *pStartPin );
-                        if ( m_hasFocus && IsHoveredOverCurve( p1, p2, p3, p4, drawingContext.m_mouseScreenPos, g_connectionSelectionExtraRadius ) )
+
+                        if ( drawSimplifiedConnections )
                         {
-                            m_hoveredConnectionID = connection.m_ID;
-                            connectionColor = Color( Style::s_connectionColorHovered );
+                            if ( m_hasFocus && ImLengthSqr( drawingContext.m_mouseScreenPos - ImLineClosestPoint( p1, p4, drawingContext.m_mouseScreenPos ) ) < Math::Pow( g_connectionSelectionExtraRadius, 2 ) )
+                            {
+                                m_hoveredConnectionID = connection.m_ID;
+                                connectionColor = Color( Style::s_connectionColorHovered );
+                            }
+
+                            drawingContext.m_pDrawList->AddLine( p1, p4, connectionColor, connectionThickness );
                         }
+                        else
+                        {
+                            if ( m_hasFocus && IsHoveredOverCurve( p1, p2, p3, p4, drawingContext.m_mouseScreenPos, g_connectionSelectionExtraRadius ) )
+                            {
+                                m_hoveredConnectionID = connection.m_ID;
+                                connectionColor = Color( Style::s_connectionColorHovered );
+                            }
 
-                        drawingContext.m_pDrawList->AddBezierCubic( p1, p2, p3, p4, connectionColor, Math::Max( 1.0f, 3.0f * drawingContext.m_viewScaleFactor ) );
+                            drawingContext.m_pDrawList->AddBezierCubic( p1, p2, p3, p4, connectionColor, connectionThickness );
+                        }
                     }
                 }
 
@@ -1728,8 +1927,11 @@ namespace EE::NodeGraph
         ImRect const selectionWindowRect( min - ctx.m_windowRect.Min, max - ctx.m_windowRect.Min );
 
         TVector<SelectedNode> newSelection;
-        for ( TTypeInstance<BaseNode>& nodeInstance : GetViewedGraph()->m_nodes )
+        m_spatialGrid.Build( m_pGraph );
+        m_spatialGrid.FindNodes( ctx.WindowToCanvas( selectionWindowRect ), m_spatialQueryResults );
+        for ( int32_t nodeIdx : m_spatialQueryResults )
         {
+            TTypeInstance<BaseNode>& nodeInstance = GetViewedGraph()->m_nodes[nodeIdx];
             ImRect const nodeWindowRect = ctx.CanvasToWindow( nodeInstance->GetRect() );
             if ( !nodeWindowRect.Contains( selectionWindowRect ) )
             {
@@ -1826,7 +2028,7 @@ namespace EE::NodeGraph
 
     //-------------------------------------------------------------------------
 
-    void GraphView::TryGetAutoConnectionNodeAndPin( DrawContext const& ctx, FlowNode*& pOutNode, Pin*& pOutPin ) const
+    void GraphView::TryGetAutoConnectionNodeAndPin( DrawContext const& ctx, FlowNode*& pOutNode, Pin*& pOutPin )
     {
         auto pFlowGraph = GetFlowGraph();
         auto pDraggedFlowNode = m_dragState.GetAsFlowNode();
@@ -1842,8 +2044,15 @@ namespace EE::NodeGraph
 
         TInlineVector<FlowNode*, 10> options;
 
-        for ( TTypeInstance<BaseNode>& pNode : pFlowGraph->m_nodes )
+        ImRect detectionRect( ctx.m_mouseCanvasPos, ctx.m_mouseCanvasPos );
+        detectionRect.Expand( autoConnectThreshold );
+
+        m_spatialGrid.Build( m_pGraph );
+        m_spatialGrid.FindNodes( detectionRect, m_spatialQueryResults );
+
+        for ( int32_t nodeIdx : m_spatialQueryResults )
         {
+            TTypeInstance<BaseNode>& pNode = pFlowGraph->m_nodes[nodeIdx];
             if ( m_dragState.m_pNode == pNode.Get() )
             {
                 continue;
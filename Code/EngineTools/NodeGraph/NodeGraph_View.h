@@ -2,6 +2,7 @@
 #include "NodeGraph_StateMachineGraph.h"
 #include "NodeGraph_FlowGraph.h"
 #include "NodeGraph_UserContext.h"
+#include "Base/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -86,6 +87,30 @@ namespace EE::NodeGraph
             ImGuiX::FilterWidget    m_filterWidget;
         };
 
+        // Spatial Grid
+        //-------------------------------------------------------------------------
+        // Coarse uniform grid of node indices (in canvas space) used to accelerate box selection and auto-connection
+        // Only rebuilt right before it is queried (since node rects are only up to date after drawing), so idle frames dont pay for it
+
+        struct NodeSpatialGrid
+        {
+            constexpr static float const s_cellSize = 512.0f;
+
+            void Build( BaseGraph const* pGraph );
+            void Clear() { m_cells.clear(); }
+
+            // Get the indices of all nodes overlapping the supplied canvas rect, sorted in draw order
+            void FindNodes( ImRect const& canvasRect, TVector<int32_t>& outNodeIndices ) const;
+
+        private:
+
+            inline static uint64_t GetCellKey( int32_t x, int32_t y ) { return ( uint64_t( uint32_t( x ) ) << 32 ) | uint64_t( uint32_t( y ) ); }
+
+        private:
+
+            THashMap<uint64_t, TInlineVector<int32_t, 8>>   m_cells;
+        };
+
         // Drag and Drop State
         //-------------------------------------------------------------------------
 
@@ -230,8 +255,12 @@ namespace EE::NodeGraph
         void DrawStateMachineNode( DrawContext const& ctx, StateMachineNode* pNode );
         void DrawStateMachineTransitionConduit( DrawContext const& ctx, TransitionConduitNode* pTransition );
         void DrawFlowNode( DrawContext const& ctx, FlowNode* pNode );
+        void DrawSimplifiedFlowNode( DrawContext const& ctx, FlowNode* pNode );
         void DrawCommentNode( DrawContext const& ctx, CommentNode* pNode );
 
+        // Update the screen positions of the pins for nodes that were not fully drawn this frame
+        void UpdatePinPositionsFromNodeOffsets( DrawContext const& ctx, FlowNode* pNode ) const;
+
         // Node Ops
         //-------------------------------------------------------------------------
 
@@ -260,7 +289,7 @@ namespace EE::NodeGraph
         // Connection Helpers
         //-------------------------------------------------------------------------
 
-        void TryGetAutoConnectionNodeAndPin( DrawContext const& ctx, FlowNode*& pOutNode, Pin*& pOutPin ) const;
+        void TryGetAutoConnectionNodeAndPin( DrawContext const& ctx, FlowNode*& pOutNode, Pin*& pOutPin );
 
     protected:
 
@@ -281,6 +310,8 @@ namespace EE::NodeGraph
         DragState                       m_dragState;
         ContextMenuState                m_contextMenuState;
         DragAndDropState                m_dragAndDropState;
+        NodeSpatialGrid                 m_spatialGrid;
+        TVector<int32_t>                m_spatialQueryResults;
 
         // Flow graph state
         Pin*                            m_pHoveredPin = nullptr;
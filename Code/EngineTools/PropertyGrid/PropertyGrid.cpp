@@ -16,8 +16,30 @@ namespace EE::PG
 
         mutable PropertyGrid::VisualState const*            m_pRecordedVisualState = nullptr; // Only set during grid rebuild, to restore expansion and other visual state
         mutable GridRow*                                    m_pRowThatRequiresUpdateAndRebuild = nullptr; // Set whenever we get an type update request from a row that requires us to update the row and rebuild the grid
+        PropertyGrid::VisualState                           m_deferredVisualState; // The visual state to restore for rows that are created on demand after the grid rebuild
+        bool                                                m_showReadOnlyProperties = false;
     };
 
+    //-------------------------------------------------------------------------
+
+    static bool IsPathPrefix( TypeSystem::PropertyPath const& prefix, TypeSystem::PropertyPath const& path )
+    {
+        if ( prefix.GetNumElements() >= path.GetNumElements() )
+        {
+            return false;
+        }
+
+        for ( size_t i = 0; i < prefix.GetNumElements(); i++ )
+        {
+            if ( prefix[i] != path[i] )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     // This struct wraps a property modification operation
     struct [[nodiscard]] ScopedChangeNotifier
     {
@@ -167,6 +189,15 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
+        if ( pVisualStateToRestore != nullptr )
+        {
+            m_pGridContext->m_deferredVisualState = *pVisualStateToRestore;
+        }
+        else
+        {
+            m_pGridContext->m_deferredVisualState.Clear();
+        }
+
         m_pGridContext->m_pRecordedVisualState = pVisualStateToRestore;
 
         for ( auto const& propertyInfo : m_pTypeInfo->m_properties )
@@ -182,6 +213,15 @@ namespace EE
             pCategory->AddProperty( m_pTypeInstance, propertyInfo );
         }
 
+        // Only create rows for expanded categories
+        for ( auto& pCategory : m_categories )
+        {
+            if ( pCategory->IsExpanded() )
+            {
+                pCategory->CreateDeferredRows();
+            }
+        }
+
         m_pGridContext->m_pRecordedVisualState = nullptr;
 
         //-------------------------------------------------------------------------
@@ -198,6 +238,25 @@ namespace EE
     }
 
     void PropertyGrid::ApplyFilter()
+    {
+        m_pGridContext->m_showReadOnlyProperties = m_showReadOnlyProperties;
+
+        // We need all the rows to exist to be able to filter by name
+        if ( !m_filterWidget.GetFilterTokens().empty() )
+        {
+            for ( auto& pCategory : m_categories )
+            {
+                pCategory->RecursiveOperation( [] ( PG::GridRow* pRow ) { pRow->CreateDeferredRows(); } );
+            }
+        }
+
+        for ( auto& pCategory : m_categories )
+        {
+            ApplyFilter( pCategory );
+        }
+    }
+
+    void PropertyGrid::ApplyFilter( PG::GridRow* pRow ) const
     {
         auto const& filters = m_filterWidget.GetFilterTokens();
         auto EvaluateRowFilter = [this, &filters]( PG::GridRow* pRow )
@@ -235,10 +294,7 @@ namespace EE
             }
         };
 
-        for ( auto& pCategory : m_categories )
-        {
-            pCategory->RecursiveOperation( EvaluateRowFilter );
-        }
+        pRow->RecursiveOperation( EvaluateRowFilter );
     }
 
     //-------------------------------------------------------------------------
@@ -282,6 +338,15 @@ namespace EE
             pCategory->FillExpansionInfo( outVisualState );
         }
 
+        // Rows that were never created, still need to retain the state they were meant to be restored to
+        for ( auto const& expandedPath : m_pGridContext->m_deferredVisualState.m_expandedPaths )
+        {
+            if ( !VectorContains( outVisualState.m_expandedPaths, expandedPath ) )
+            {
+                outVisualState.m_expandedPaths.emplace_back( expandedPath );
+            }
+        }
+
         // Get scroll state
         outVisualState.m_scrollPosY = m_scrollPosY;
     }
@@ -295,12 +360,28 @@ namespace EE
 
         if ( m_pGridContext->m_pRowThatRequiresUpdateAndRebuild != nullptr )
         {
-            m_pGridContext->m_pRowThatRequiresUpdateAndRebuild->UpdateRow();
+            PG::GridRow* pRowToUpdate = m_pGridContext->m_pRowThatRequiresUpdateAndRebuild;
             m_pGridContext->m_pRowThatRequiresUpdateAndRebuild = nullptr;
+            pRowToUpdate->UpdateRow();
 
-            VisualState visualState;
-            GetCurrentVisualState( visualState );
-            RebuildGrid( m_pTypeInstance, &visualState );
+            // Only rebuild the owning type's rows, if the row belongs to a nested type
+            PG::GridRow* pOwnerRow = pRowToUpdate->GetParent();
+            while ( pOwnerRow != nullptr && !pOwnerRow->RebuildOwnedTypeRows() )
+            {
+                pOwnerRow = pOwnerRow->GetParent();
+            }
+
+            // Top-level property, rebuild the whole grid
+            if ( pOwnerRow == nullptr )
+            {
+                VisualState visualState;
+                GetCurrentVisualState( visualState );
+                RebuildGrid( m_pTypeInstance, &visualState );
+            }
+            else
+            {
+                ApplyFilter( pOwnerRow );
+            }
         }
 
         //-------------------------------------------------------------------------
@@ -500,16 +581,19 @@ namespace EE::PG
         {
             ImGui::BeginDisabled( IsReadOnly() );
 
-            float const childHeaderOffset = currentHeaderOffset + g_headerOffset;
-            for ( auto& child : m_children )
-            {
-                child->DrawRow( childHeaderOffset );
-            }
-
+            DrawChildren( currentHeaderOffset + g_headerOffset );
             ImGui::EndDisabled();
         }
     }
 
+    void GridRow::DrawChildren( float childHeaderOffset )
+    {
+        for ( auto& child : m_children )
+        {
+            child->DrawRow( childHeaderOffset );
+        }
+    }
+
     void GridRow::SetExpansion( bool isExpanded )
     {
         m_isExpanded = isExpanded;
@@ -611,26 +695,87 @@ namespace EE::PG
     void CategoryRow::AddProperty( IReflectedType* pTypeInstance, PropertyInfo const& propertyInfo )
     {
         EE_ASSERT( pTypeInstance != nullptr );
+        m_deferredProperties.emplace_back( pTypeInstance, &propertyInfo );
+    }
 
-        GridRow* pRow = CreateRow( this, m_context, pTypeInstance, propertyInfo );
+    void CategoryRow::CreateDeferredRows()
+    {
+        if ( m_deferredProperties.empty() )
+        {
+            return;
+        }
+
+        // If we are not part of a rebuild, restore the state recorded for the last rebuild
+        bool const isCreatedOnDemand = ( m_context.m_pRecordedVisualState == nullptr );
+        bool const useDeferredVisualState = isCreatedOnDemand && m_context.m_deferredVisualState.m_editedTypeID.IsValid();
+        if ( useDeferredVisualState )
+        {
+            m_context.m_pRecordedVisualState = &m_context.m_deferredVisualState;
+        }
 
-        // Sorted Insert
         //-------------------------------------------------------------------------
 
-        size_t insertIdx = 0;
-        for ( ; insertIdx < m_children.size(); insertIdx++ )
+        for ( PropertyChainElement const& deferredProperty : m_deferredProperties )
         {
-            if ( m_children[insertIdx]->GetName() > pRow->GetName() )
+            GridRow* pRow = CreateRow( this, m_context, deferredProperty.m_pTypeInstance, *deferredProperty.m_pPropertyInfo );
+
+            // Sorted Insert
+            //-------------------------------------------------------------------------
+
+            size_t insertIdx = 0;
+            for ( ; insertIdx < m_children.size(); insertIdx++ )
             {
-                break;
+                if ( m_children[insertIdx]->GetName() > pRow->GetName() )
+                {
+                    break;
+                }
+            }
+
+            m_children.insert( m_children.begin() + insertIdx, pRow );
+
+            // Rows created outside of a grid rebuild need to be updated and filtered before they are drawn
+            if ( isCreatedOnDemand )
+            {
+                pRow->UpdateRow();
+                m_context.m_pPropertyGrid->ApplyFilter( pRow );
             }
         }
 
-        m_children.insert( m_children.begin() + insertIdx, pRow );
+        m_deferredProperties.clear();
+
+        //-------------------------------------------------------------------------
+
+        if ( useDeferredVisualState )
+        {
+            m_context.m_pRecordedVisualState = nullptr;
+        }
+    }
+
+    void CategoryRow::DrawChildren( float childHeaderOffset )
+    {
+        CreateDeferredRows();
+        GridRow::DrawChildren( childHeaderOffset );
     }
 
     bool CategoryRow::ShouldDrawRow() const
     {
+        // Rows that have not been created yet are assumed visible, unless explicitly hidden
+        for ( PropertyChainElement const& deferredProperty : m_deferredProperties )
+        {
+            PropertyMetadata const& metadata = deferredProperty.m_pPropertyInfo->m_metadata;
+            if ( metadata.HasFlag( PropertyMetadata::Hidden ) )
+            {
+                continue;
+            }
+
+            if ( metadata.HasFlag( PropertyMetadata::ReadOnly ) && !m_context.m_showReadOnlyProperties )
+            {
+                continue;
+            }
+
+            return true;
+        }
+
         // Dont show empty categories
         if ( m_children.empty() )
         {
@@ -667,6 +812,7 @@ namespace EE::PG
             m_isExpanded = VectorContains( context.m_pRecordedVisualState->m_expandedPaths, m_path );
         }
 
+        RecordElementVisualState( context.m_pRecordedVisualState );
         RebuildChildren();
     }
 
@@ -714,6 +860,36 @@ namespace EE::PG
         m_operationElementIdx = arrayElementIndex;
     }
 
+    void ArrayRow::CreateDeferredRows()
+    {
+        int32_t const arraySize = (int32_t) m_elementRows.size();
+        for ( int32_t i = 0; i < arraySize; i++ )
+        {
+            GetOrCreateElementRow( i );
+        }
+    }
+
+    bool ArrayRow::HasDeferredRows() const
+    {
+        return m_children.size() != m_elementRows.size();
+    }
+
+    void ArrayRow::FillExpansionInfo( PropertyGrid::VisualState& expansionState )
+    {
+        GridRow::FillExpansionInfo( expansionState );
+
+        // Retain the recorded state for all elements that dont have rows
+        size_t const elementPathIdx = m_path.GetNumElements();
+        for ( auto const& expandedPath : m_elementVisualState.m_expandedPaths )
+        {
+            int32_t const elementIdx = expandedPath[elementPathIdx].m_arrayElementIdx;
+            if ( elementIdx < 0 || elementIdx >= (int32_t) m_elementRows.size() || m_elementRows[elementIdx] == nullptr )
+            {
+                expansionState.m_expandedPaths.emplace_back( expandedPath );
+            }
+        }
+    }
+
     void ArrayRow::Update()
     {
         bool childrenNeedRebuild = false;
@@ -723,7 +899,7 @@ namespace EE::PG
 
         auto pTypeInfo = m_pParentTypeInstance->GetTypeInfo();
         size_t const arraySize = pTypeInfo->GetArraySize( m_pParentTypeInstance, m_propertyInfo.m_ID );
-        if ( m_children.size() != arraySize )
+        if ( m_elementRows.size() != arraySize )
         {
             childrenNeedRebuild = true;
         }
@@ -735,7 +911,7 @@ namespace EE::PG
         {
             case OperationType::Insert:
             {
-                EE_ASSERT( m_operationElementIdx >= 0 && m_operationElementIdx < m_children.size() );
+                EE_ASSERT( m_operationElementIdx >= 0 && m_operationElementIdx < m_elementRows.size() );
                 ScopedChangeNotifier cn( m_context.m_pPropertyGrid, this, m_pParentTypeInstance, &m_propertyInfo, PropertyEditInfo::Action::AddArrayElement );
                 m_pParentTypeInstance->GetTypeInfo()->InsertArrayElement( m_pParentTypeInstance, m_propertyInfo.m_ID, m_operationElementIdx );
                 childrenNeedRebuild = true;
@@ -744,7 +920,7 @@ namespace EE::PG
 
             case OperationType::MoveUp:
             {
-                EE_ASSERT( m_operationElementIdx > 0 && m_operationElementIdx < m_children.size() );
+                EE_ASSERT( m_operationElementIdx > 0 && m_operationElementIdx < m_elementRows.size() );
                 ScopedChangeNotifier cn( m_context.m_pPropertyGrid, this, m_pParentTypeInstance, &m_propertyInfo, PropertyEditInfo::Action::MoveArrayElement );
                 m_pParentTypeInstance->GetTypeInfo()->MoveArrayElement( m_pParentTypeInstance, m_propertyInfo.m_ID, m_operationElementIdx, m_operationElementIdx - 1 );
                 childrenNeedRebuild = true;
@@ -753,7 +929,7 @@ namespace EE::PG
 
             case OperationType::MoveDown:
             {
-                EE_ASSERT( m_operationElementIdx >= 0 && m_operationElementIdx < ( m_children.size() - 1 ) );
+                EE_ASSERT( m_operationElementIdx >= 0 && m_operationElementIdx < ( m_elementRows.size() - 1 ) );
                 ScopedChangeNotifier cn( m_context.m_pPropertyGrid, this, m_pParentTypeInstance, &m_propertyInfo, PropertyEditInfo::Action::MoveArrayElement );
                 m_pParentTypeInstance->GetTypeInfo()->MoveArrayElement( m_pParentTypeInstance, m_propertyInfo.m_ID, m_operationElementIdx, m_operationElementIdx + 1 );
                 childrenNeedRebuild = true;
@@ -762,7 +938,7 @@ namespace EE::PG
 
             case OperationType::Remove:
             {
-                EE_ASSERT( m_operationElementIdx >= 0 && m_operationElementIdx < m_children.size() );
+                EE_ASSERT( m_operationElementIdx >= 0 && m_operationElementIdx < m_elementRows.size() );
                 ScopedChangeNotifier cn( m_context.m_pPropertyGrid, this, m_pParentTypeInstance, &m_propertyInfo, PropertyEditInfo::Action::RemoveArrayElement );
                 m_pParentTypeInstance->GetTypeInfo()->RemoveArrayElement( m_pParentTypeInstance, m_propertyInfo.m_ID, m_operationElementIdx );
                 childrenNeedRebuild = true;
@@ -798,13 +974,13 @@ namespace EE::PG
             break;
         }
 
+        // Element rows are created on demand, so we only need to record the current expansion state
         if ( childrenNeedRebuild )
         {
             PropertyGrid::VisualState visualState;
             FillExpansionInfo( visualState );
-            m_context.m_pRecordedVisualState = &visualState;
+            RecordElementVisualState( &visualState );
             RebuildChildren();
-            m_context.m_pRecordedVisualState = nullptr;
         }
 
         //-------------------------------------------------------------------------
@@ -922,17 +1098,191 @@ namespace EE::PG
         ImGui::EndDisabled();
     }
 
+    void ArrayRow::DrawChildren( float childHeaderOffset )
+    {
+        // When filtering, all element rows exist and most are hidden so there is nothing to virtualize
+        int32_t const arraySize = (int32_t) m_elementRows.size();
+        bool const isFilterActive = !m_context.m_pPropertyGrid->m_filterWidget.GetFilterTokens().empty();
+        if ( arraySize <= s_maxNonVirtualizedElements || isFilterActive )
+        {
+            for ( int32_t i = 0; i < arraySize; i++ )
+            {
+                GetOrCreateElementRow( i )->DrawRow( childHeaderOffset );
+            }
+
+            return;
+        }
+
+        // Virtualized drawing
+        //-------------------------------------------------------------------------
+        // The list clipper requires uniform item heights, so we only clip runs of elements that draw a single row.
+        // Elements that are expanded or hidden are always drawn directly. Element rows default to collapsed so these runs are the common case.
+
+        TInlineVector<int32_t, 64> drawnElementIndices;
+
+        auto DrawSingleRowElements = [this, childHeaderOffset, &drawnElementIndices] ( int32_t startIdx, int32_t endIdx )
+        {
+            if ( startIdx >= endIdx )
+            {
+                return;
+            }
+
+            ImGuiListClipper clipper;
+            clipper.Begin( endIdx - startIdx );
+            while ( clipper.Step() )
+            {
+                for ( int32_t i = startIdx + clipper.DisplayStart; i < startIdx + clipper.DisplayEnd; i++ )
+                {
+                    GetOrCreateElementRow( i )->DrawRow( childHeaderOffset );
+                    drawnElementIndices.emplace_back( i );
+                }
+            }
+            clipper.End();
+        };
+
+        int32_t runStartIdx = 0;
+        for ( int32_t i = 0; i < arraySize; i++ )
+        {
+            if ( IsSingleRowElement( i ) )
+            {
+                continue;
+            }
+
+            DrawSingleRowElements( runStartIdx, i );
+
+            GetOrCreateElementRow( i )->DrawRow( childHeaderOffset );
+            drawnElementIndices.emplace_back( i );
+            runStartIdx = i + 1;
+        }
+
+        DrawSingleRowElements( runStartIdx, arraySize );
+
+        //-------------------------------------------------------------------------
+
+        if ( (int32_t) m_children.size() > s_maxCachedElementRows )
+        {
+            EvictElementRows( drawnElementIndices );
+        }
+    }
+
+    bool ArrayRow::IsSingleRowElement( int32_t elementIdx ) const
+    {
+        GridRow const* pRow = m_elementRows[elementIdx];
+
+        // Rows that dont exist yet are created collapsed, unless we have recorded them as expanded
+        if ( pRow == nullptr )
+        {
+            return !VectorContains( m_expandedElementIndices, elementIdx );
+        }
+
+        if ( !pRow->ShouldDrawRow() )
+        {
+            return false;
+        }
+
+        return !pRow->IsExpanded() || ( pRow->GetChildren().empty() && !pRow->HasDeferredRows() );
+    }
+
     void ArrayRow::RebuildChildren()
     {
         DestroyChildren();
+        m_elementRows.clear();
 
         //-------------------------------------------------------------------------
 
         auto pTypeInfo = m_pParentTypeInstance->GetTypeInfo();
         size_t const arraySize = pTypeInfo->GetArraySize( m_pParentTypeInstance, m_propertyInfo.m_ID );
-        for ( auto i = 0u; i < arraySize; i++ )
+        m_elementRows.resize( arraySize, nullptr );
+    }
+
+    void ArrayRow::RecordElementVisualState( PropertyGrid::VisualState const* pVisualState )
+    {
+        m_elementVisualState.Clear();
+        m_expandedElementIndices.clear();
+
+        if ( pVisualState == nullptr )
+        {
+            return;
+        }
+
+        m_elementVisualState.m_editedTypeID = pVisualState->m_editedTypeID;
+        m_elementVisualState.m_expandedCategories = pVisualState->m_expandedCategories;
+
+        size_t const elementPathIdx = m_path.GetNumElements();
+        for ( auto const& expandedPath : pVisualState->m_expandedPaths )
         {
-            m_children.emplace_back( CreateRow( this, m_context, m_pParentTypeInstance, m_propertyInfo, i ) );
+            if ( IsPathPrefix( m_path, expandedPath ) )
+            {
+                m_elementVisualState.m_expandedPaths.emplace_back( expandedPath );
+
+                // Element paths are our path plus the indexed element
+                if ( expandedPath.GetNumElements() == elementPathIdx + 1 )
+                {
+                    m_expandedElementIndices.emplace_back( expandedPath[elementPathIdx].m_arrayElementIdx );
+                }
+            }
+        }
+    }
+
+    GridRow* ArrayRow::GetOrCreateElementRow( int32_t elementIdx )
+    {
+        EE_ASSERT( elementIdx >= 0 && elementIdx < m_elementRows.size() );
+
+        if ( m_elementRows[elementIdx] != nullptr )
+        {
+            return m_elementRows[elementIdx];
+        }
+
+        //-------------------------------------------------------------------------
+
+        // Elements of large arrays are always created from the element state, so that any element not recorded as expanded is created collapsed
+        bool const isVirtualized = (int32_t) m_elementRows.size() > s_maxNonVirtualizedElements;
+        bool const useElementVisualState = isVirtualized || !m_elementVisualState.m_expandedPaths.empty();
+        m_context.m_pRecordedVisualState = useElementVisualState ? &m_elementVisualState : nullptr;
+        GridRow* pRow = CreateRow( this, m_context, m_pParentTypeInstance, m_propertyInfo, elementIdx );
+        m_context.m_pRecordedVisualState = nullptr;
+
+        // Array element visibility is tied to our visibility
+        pRow->UpdateRow();
+        m_context.m_pPropertyGrid->ApplyFilter( pRow );
+        if ( !m_isHidden )
+        {
+            pRow->SetHidden( false );
+        }
+
+        m_elementRows[elementIdx] = pRow;
+        m_children.emplace_back( pRow );
+        return pRow;
+    }
+
+    void ArrayRow::EvictElementRows( TInlineVector<int32_t, 64> const& drawnElementIndices )
+    {
+        // Retain the expansion state of the rows we are destroying
+        PropertyGrid::VisualState visualState;
+        FillExpansionInfo( visualState );
+        RecordElementVisualState( &visualState );
+
+        //-------------------------------------------------------------------------
+
+        m_children.clear();
+
+        int32_t const arraySize = (int32_t) m_elementRows.size();
+        for ( int32_t i = 0; i < arraySize; i++ )
+        {
+            if ( m_elementRows[i] == nullptr )
+            {
+                continue;
+            }
+
+            if ( VectorContains( drawnElementIndices, i ) )
+            {
+                m_children.emplace_back( m_elementRows[i] );
+            }
+            else
+            {
+                m_elementRows[i]->DestroyChildren();
+                EE::Delete( m_elementRows[i] );
+            }
         }
     }
 
@@ -976,7 +1326,30 @@ namespace EE::PG
 
         //-------------------------------------------------------------------------
 
-        RebuildChildren();
+        // Collapsed structs only create their children once expanded, so record the state to restore for them
+        if ( !m_isExpanded && HasChildTypeRows() )
+        {
+            if ( context.m_pRecordedVisualState != nullptr )
+            {
+                m_childVisualState.m_editedTypeID = context.m_pRecordedVisualState->m_editedTypeID;
+                m_childVisualState.m_expandedCategories = context.m_pRecordedVisualState->m_expandedCategories;
+
+                for ( auto const& expandedPath : context.m_pRecordedVisualState->m_expandedPaths )
+                {
+                    if ( IsPathPrefix( m_path, expandedPath ) )
+                    {
+                        m_childVisualState.m_expandedPaths.emplace_back( expandedPath );
+                    }
+                }
+            }
+
+            m_hasDeferredChildren = true;
+        }
+        else
+        {
+            RebuildChildren();
+        }
+
         UpdateName();
     }
 
@@ -986,8 +1359,71 @@ namespace EE::PG
         EE::Delete( m_pTypeEditingRules );
     }
 
+    void PropertyRow::CreateDeferredRows()
+    {
+        if ( !m_hasDeferredChildren )
+        {
+            return;
+        }
+
+        // If we are not part of a rebuild, restore the state recorded when we were created
+        bool const isCreatedOnDemand = ( m_context.m_pRecordedVisualState == nullptr );
+        bool const useChildVisualState = isCreatedOnDemand && m_childVisualState.m_editedTypeID.IsValid();
+        if ( useChildVisualState )
+        {
+            m_context.m_pRecordedVisualState = &m_childVisualState;
+        }
+
+        RebuildChildren();
+
+        if ( useChildVisualState )
+        {
+            m_context.m_pRecordedVisualState = nullptr;
+        }
+
+        m_childVisualState.Clear();
+
+        //-------------------------------------------------------------------------
+
+        // Rows created outside of a grid rebuild need to be updated and filtered before they are drawn
+        if ( isCreatedOnDemand )
+        {
+            for ( auto pChildRow : m_children )
+            {
+                pChildRow->UpdateRow();
+                m_context.m_pPropertyGrid->ApplyFilter( pChildRow );
+            }
+        }
+    }
+
+    void PropertyRow::FillExpansionInfo( PropertyGrid::VisualState& expansionState )
+    {
+        GridRow::FillExpansionInfo( expansionState );
+
+        // Retain the recorded state for our children until they are created
+        if ( m_hasDeferredChildren )
+        {
+            for ( auto const& expandedPath : m_childVisualState.m_expandedPaths )
+            {
+                expansionState.m_expandedPaths.emplace_back( expandedPath );
+            }
+        }
+    }
+
+    void PropertyRow::DrawChildren( float childHeaderOffset )
+    {
+        CreateDeferredRows();
+        GridRow::DrawChildren( childHeaderOffset );
+    }
+
     bool PropertyRow::ShouldDrawRow() const
     {
+        // Rows that have not been created yet are assumed visible
+        if ( m_hasDeferredChildren )
+        {
+            return !m_isHidden;
+        }
+
         if ( m_propertyInfo.IsStructureProperty() && !HasPropertyEditor() )
         {
             for ( auto pChildRow : m_children )
@@ -1016,7 +1452,9 @@ namespace EE::PG
             {
                 ScopedChangeNotifier cn( m_context.m_pPropertyGrid, this, m_pParentTypeInstance, &m_propertyInfo );
                 m_pPropertyEditor->UpdatePropertyValue();
-                childrenNeedRebuild = true;
+
+                // Only type instance editors have child rows, nothing to rebuild for any other editors
+                childrenNeedRebuild = m_propertyInfo.IsTypeInstanceProperty();
             }
             break;
 
@@ -1290,15 +1728,11 @@ namespace EE::PG
     void PropertyRow::RebuildChildren()
     {
         DestroyChildren();
+        m_hasDeferredChildren = false;
 
         //-------------------------------------------------------------------------
 
-        if ( HasPropertyEditor() && !m_propertyInfo.IsTypeInstanceProperty() )
-        {
-            return;
-        }
-
-        if ( !m_propertyInfo.IsStructureProperty() && !m_propertyInfo.IsTypeInstanceProperty() )
+        if ( !HasChildTypeRows() )
         {
             return;
         }
@@ -1344,6 +1778,8 @@ namespace EE::PG
             // If we only have a single category, there's no point polluting the grid with it
             if ( categories.size() == 1 )
             {
+                categories[0]->CreateDeferredRows();
+
                 for ( auto pProperty : categories[0]->GetChildren() )
                 {
                     pProperty->SetParent( this );
@@ -1352,16 +1788,36 @@ namespace EE::PG
 
                 EE::Delete( categories[0] );
             }
-            else // Add all categories
+            else // Add all categories, only creating rows for expanded ones
             {
                 for ( auto pCategory : categories )
                 {
+                    if ( pCategory->IsExpanded() )
+                    {
+                        pCategory->CreateDeferredRows();
+                    }
+
                     m_children.emplace_back( pCategory );
                 }
             }
         }
     }
 
+    bool PropertyRow::RebuildOwnedTypeRows()
+    {
+        if ( !m_propertyInfo.IsStructureProperty() && !m_propertyInfo.IsTypeInstanceProperty() )
+        {
+            return false;
+        }
+
+        PropertyGrid::VisualState visualState;
+        FillExpansionInfo( visualState );
+        m_context.m_pRecordedVisualState = &visualState;
+        RebuildChildren();
+        m_context.m_pRecordedVisualState = nullptr;
+        return true;
+    }
+
     void PropertyRow::GeneratePropertyChangedNotificationChain( TVector<PropertyChainElement>& outChain ) const
     {
         if ( m_pParent != nullptr )
@@ -23,7 +23,9 @@ namespace EE
     namespace PG 
     {
         struct GridContext;
+        class GridRow;
         class CategoryRow;
+        class ArrayRow;
         class PropertyEditor;
         class TypeEditingRules;
         struct ScopedChangeNotifier;
@@ -61,6 +63,8 @@ namespace EE
     class EE_ENGINETOOLS_API PropertyGrid
     {
         friend PG::ScopedChangeNotifier;
+        friend PG::CategoryRow;
+        friend PG::ArrayRow;
 
     public:
 
@@ -159,6 +163,9 @@ namespace EE
         // Apply the user specified filter to rows
         void ApplyFilter();
 
+        // Apply the user specified filter to a row and all its children - used for rows created on demand
+        void ApplyFilter( PG::GridRow* pRow ) const;
+
     private:
 
         PG::GridContext*                                            m_pGridContext = nullptr;
@@ -230,6 +237,15 @@ namespace EE::PG
         // Draw this row and it's children
         void DrawRow( float currentHeaderOffset );
 
+        // Some rows only create their children on demand (i.e. when expanded), this forces the creation of those children
+        virtual void CreateDeferredRows() {}
+
+        // Do we have children that dont have rows yet
+        virtual bool HasDeferredRows() const { return false; }
+
+        // If this row owns the rows for a nested type, rebuild them and return true
+        virtual bool RebuildOwnedTypeRows() { return false; }
+
         // Set whether we are expanded (i.e. drawing our children or not)
         void SetExpansion( bool isExpanded );
 
@@ -261,7 +277,7 @@ namespace EE::PG
         }
 
         // Fill the expansion state from myself and my children
-        void FillExpansionInfo( PropertyGrid::VisualState& expansionState );
+        virtual void FillExpansionInfo( PropertyGrid::VisualState& expansionState );
 
         virtual void GeneratePropertyChangedNotificationChain( TVector<PropertyChainElement>& outChain ) const;
 
@@ -273,6 +289,7 @@ namespace EE::PG
 
         virtual void DrawHeaderSection( float currentHeaderOffset ) {}
         virtual void DrawEditorSection() {}
+        virtual void DrawChildren( float childHeaderOffset );
 
         virtual bool HasExtraControls() const { return false; }
         virtual float GetExtraControlsSectionWidth() const { return 0; }
@@ -308,18 +325,35 @@ namespace EE::PG
 
         CategoryRow( GridRow* pParentRow, GridContext const& context, String const& name );
 
+        // Add a property to this category - the row for it will only be created once the category is expanded
         void AddProperty( IReflectedType* pTypeInstance, TypeSystem::PropertyInfo const& propertyInfo );
 
+        // Create the rows for all added properties
+        virtual void CreateDeferredRows() override;
+
+        // Do we have properties that dont have rows yet
+        virtual bool HasDeferredRows() const override { return !m_deferredProperties.empty(); }
+
     private:
 
         virtual bool ShouldDrawRow() const override;
         virtual void DrawHeaderSection( float currentHeaderOffset ) override;
+        virtual void DrawChildren( float childHeaderOffset ) override;
+
+    private:
+
+        TVector<PropertyChainElement>       m_deferredProperties;
     };
 
     //-------------------------------------------------------------------------
 
+    // Element rows are only created when drawn (or when filtering), large arrays draw runs of collapsed elements via a list clipper so only visible elements have rows/editors
+
     class ArrayRow : public GridRow
     {
+        constexpr static int32_t const s_maxNonVirtualizedElements = 64;
+        constexpr static int32_t const s_maxCachedElementRows = 256;
+
         enum class OperationType
         {
             None,
@@ -342,6 +376,13 @@ namespace EE::PG
         void MoveElementDown( int32_t arrayElementIndex );
         void DestroyElement( int32_t arrayElementIndex );
 
+        // Create the rows for all elements
+        virtual void CreateDeferredRows() override;
+
+        virtual bool HasDeferredRows() const override;
+
+        virtual void FillExpansionInfo( PropertyGrid::VisualState& expansionState ) override;
+
     private:
 
         virtual bool ShouldDrawRow() const override;
@@ -358,12 +399,28 @@ namespace EE::PG
         virtual bool HasResetSection() const override;
         virtual void DrawResetSection() override;
 
+        virtual void DrawChildren( float childHeaderOffset ) override;
+
         void RebuildChildren();
 
+        // Record the expansion state for all our elements from the supplied state
+        void RecordElementVisualState( PropertyGrid::VisualState const* pVisualState );
+
+        GridRow* GetOrCreateElementRow( int32_t elementIdx );
+
+        // Will this element be drawn as a single row (i.e. visible and not showing any children), only these elements can be virtualized
+        bool IsSingleRowElement( int32_t elementIdx ) const;
+
+        // Destroy all element rows that were not drawn this frame
+        void EvictElementRows( TInlineVector<int32_t, 64> const& drawnElementIndices );
+
     private:
 
         IReflectedType*                     m_pParentTypeInstance = nullptr;
         TypeSystem::PropertyInfo const&     m_propertyInfo;
+        TVector<GridRow*>                   m_elementRows; // One entry per array element, only set for elements that have a row created
+        PropertyGrid::VisualState           m_elementVisualState; // The expansion state to use when creating element rows
+        TVector<int32_t>                    m_expandedElementIndices; // The elements that are recorded as expanded in the element visual state
 
         OperationType                       m_operationType = OperationType::None;
         int32_t                             m_operationElementIdx = InvalidIndex;
@@ -385,6 +442,13 @@ namespace EE::PG
         PropertyRow( GridRow* pParentRow, GridContext const& context, TypeSystem::PropertyInfo const& propertyInfo, IReflectedType* pParentTypeInstance, int32_t arrayElementIndex = InvalidIndex );
         ~PropertyRow();
 
+        // Create the rows for our struct/type instance children, these are only created once we are expanded
+        virtual void CreateDeferredRows() override;
+
+        virtual bool HasDeferredRows() const override { return m_hasDeferredChildren; }
+
+        virtual void FillExpansionInfo( PropertyGrid::VisualState& expansionState ) override;
+
     private:
 
         virtual bool ShouldDrawRow() const override;
@@ -402,10 +466,17 @@ namespace EE::PG
         virtual bool HasResetSection() const override;
         virtual void DrawResetSection() override;
 
+        virtual void DrawChildren( float childHeaderOffset ) override;
+
         void RebuildChildren();
 
+        virtual bool RebuildOwnedTypeRows() override;
+
         inline bool HasPropertyEditor() const { return m_pPropertyEditor != nullptr; }
 
+        // Do we display the properties of a struct/type instance as child rows
+        inline bool HasChildTypeRows() const { return ( m_propertyInfo.IsStructureProperty() || m_propertyInfo.IsTypeInstanceProperty() ) && ( !HasPropertyEditor() || m_propertyInfo.IsTypeInstanceProperty() ); }
+
         virtual void GeneratePropertyChangedNotificationChain( TVector<PropertyChainElement>& outChain ) const override;
 
     private:
@@ -416,6 +487,8 @@ namespace EE::PG
         void*                               m_pPropertyInstance = nullptr; // Either a core type instance or a structure instance
         PropertyEditor*                     m_pPropertyEditor = nullptr; // A core type or custom property editor, if this is set we dont display struct children
         TypeEditingRules*                   m_pTypeEditingRules = nullptr; // Helper that allows for complex visibility/read-only rules for a given type
+        PropertyGrid::VisualState           m_childVisualState; // The expansion state to use when creating our deferred child rows
         OperationType                       m_operationType = OperationType::None;
+        bool                                m_hasDeferredChildren = false; // Collapsed structs only create their child rows once expanded
     };
 }
\ No newline at end of file
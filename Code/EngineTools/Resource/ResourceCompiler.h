@@ -92,6 +92,10 @@ namespace EE::Resource
         // Does this compiler actually require the input file or is it optional.
         virtual bool IsInputFileRequired() const { return true; }
 
+        // Can this compiler compile (and calculate up-to-date hashes for) multiple resources at once
+        // Only return true once the compiler and everything it uses (importers, third party SDKs, etc...) has been verified as re-entrant
+        virtual bool IsThreadSafe() const { return false; }
+
         // Get all referenced resources needed at runtime
         virtual bool GetInstallDependencies( ResourceID const& resourceID, TVector<ResourceID>& outReferencedResources ) const { return true; }
 
@@ -26,6 +26,7 @@ namespace EE::Timeline
     {
         EE_ASSERT( m_beginModificationCallCount > 0 );
         m_beginModificationCallCount--;
+        m_modificationVersion++;
 
         if ( m_beginModificationCallCount == 0 )
         {
@@ -58,6 +58,9 @@ namespace EE::Timeline
         // Get the units per second conversion factor
         EE_FORCE_INLINE float const& GetUnitsPerSecondConversionFactor() const { return m_unitsPerSeconds; }
 
+        // Get a counter that is incremented every time a modification ends - allows caches to detect timeline changes
+        EE_FORCE_INLINE uint32_t GetModificationVersion() const { return m_modificationVersion; }
+
     private:
 
         float               m_timelineLength = 0.0f;
@@ -65,6 +68,7 @@ namespace EE::Timeline
         TFunction<void()>   m_beginModification;
         TFunction<void()>   m_endModification;
         mutable int32_t     m_beginModificationCallCount = 0;
+        mutable uint32_t    m_modificationVersion = 0;
     };
 
     //-------------------------------------------------------------------------
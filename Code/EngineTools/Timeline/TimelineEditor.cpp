@@ -75,6 +75,16 @@ namespace EE::Timeline
         m_playheadTimeForMouse = -1.0f;
     }
 
+    void TimelineEditor::VisibleItemCache::Reset()
+    {
+        m_tracks.clear();
+        m_numItemsPerTrack.clear();
+        m_visibleItemIndices.clear();
+        m_viewRange = FloatRange( 0, 0 );
+        m_modificationVersion = 0;
+        m_isValid = false;
+    }
+
     //-------------------------------------------------------------------------
 
     TimelineEditor::TimelineEditor( TimelineData* pTimelineData, TFunction<void()>& onBeginModification, TFunction<void()>& onEndModification )
@@ -198,6 +208,54 @@ namespace EE::Timeline
         }
     }
 
+    void TimelineEditor::UpdateVisibleItemCache()
+    {
+        TVector<TTypeInstance<Track>> const& tracks = m_pTimeline->GetTracks();
+        int32_t const numTracks = (int32_t) tracks.size();
+
+        // Validate cache - we only check the track layout here, any item time changes are caught by the modification version
+        //-------------------------------------------------------------------------
+
+        bool isCacheValid = m_visibleItemCache.m_isValid && m_visibleItemCache.m_viewRange == m_viewRange && m_visibleItemCache.m_modificationVersion == m_context.GetModificationVersion() && (int32_t) m_visibleItemCache.m_tracks.size() == numTracks;
+        for ( int32_t i = 0; isCacheValid && i < numTracks; i++ )
+        {
+            isCacheValid = ( m_visibleItemCache.m_tracks[i] == tracks[i].Get() ) && ( m_visibleItemCache.m_numItemsPerTrack[i] == tracks[i]->GetNumItems() );
+        }
+
+        if ( isCacheValid )
+        {
+            return;
+        }
+
+        // Rebuild cache
+        //-------------------------------------------------------------------------
+
+        m_visibleItemCache.m_tracks.resize( numTracks );
+        m_visibleItemCache.m_numItemsPerTrack.resize( numTracks );
+        m_visibleItemCache.m_visibleItemIndices.resize( numTracks );
+
+        for ( int32_t i = 0; i < numTracks; i++ )
+        {
+            Track const* pTrack = tracks[i].Get();
+            m_visibleItemCache.m_tracks[i] = pTrack;
+            m_visibleItemCache.m_numItemsPerTrack[i] = pTrack->GetNumItems();
+            m_visibleItemCache.m_visibleItemIndices[i].clear();
+
+            int32_t const numItems = pTrack->GetNumItems();
+            for ( int32_t itemIdx = 0; itemIdx < numItems; itemIdx++ )
+            {
+                if ( m_viewRange.Overlaps( pTrack->GetItems()[itemIdx]->GetTimeRange() ) )
+                {
+                    m_visibleItemCache.m_visibleItemIndices[i].emplace_back( itemIdx );
+                }
+            }
+        }
+
+        m_visibleItemCache.m_viewRange = m_viewRange;
+        m_visibleItemCache.m_modificationVersion = m_context.GetModificationVersion();
+        m_visibleItemCache.m_isValid = true;
+    }
+
     void TimelineEditor::SetPlayheadTime( float desiredPlayheadTime )
     {
         m_playheadTime = FloatRange( 0.0f, m_context.m_timelineLength ).GetClampedValue( desiredPlayheadTime );
@@ -515,12 +573,16 @@ namespace EE::Timeline
         //-------------------------------------------------------------------------
 
         m_visualTracks.clear();
+        UpdateVisibleItemCache();
 
         {
             m_desiredTrackAreaSize = ImVec2( ( m_context.m_timelineLength + 1 ) * m_pixelsPerFrame, 0 ); // Always show 1 more unit than the length of the timeline
             ImVec2 trackStartPos = m_trackAreaRect.GetTL() + ImVec2( 0, g_trackRowHalfSpacing );
-            for ( TTypeInstance<Track>& track : m_pTimeline->GetTracks() )
+            int32_t const numTracks = m_pTimeline->GetNumTracks();
+            for ( int32_t trackIdx = 0; trackIdx < numTracks; trackIdx++ )
             {
+                TTypeInstance<Track>& track = m_pTimeline->GetTracks()[trackIdx];
+
                 m_desiredTrackAreaSize.y += track->GetTrackHeight();
                 m_desiredTrackAreaSize.y += g_trackRowSpacing;
 
@@ -538,14 +600,11 @@ namespace EE::Timeline
                 // Calculate header rect
                 visualTrack.m_headerRect = ImRect( visualTrack.m_rect.GetTL(), ImVec2( visualTrack.m_rect.GetTL().x + g_trackHeaderWidth, visualTrack.m_rect.GetBR().y ) );
 
-                // Evaluate items
-                for ( TTypeInstance<TrackItem>& item : track->GetItems() )
+                // Evaluate visible items
+                for ( int32_t itemIdx : m_visibleItemCache.m_visibleItemIndices[trackIdx] )
                 {
+                    TTypeInstance<TrackItem>& item = track->GetItems()[itemIdx];
                     FloatRange const itemTimeRange = item->GetTimeRange();
-                    if ( !m_viewRange.Overlaps( itemTimeRange ) )
-                    {
-                        continue;
-                    }
 
                     VisualTrackItem* pVisualItem = nullptr;
 
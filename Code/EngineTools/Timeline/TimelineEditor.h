@@ -98,6 +98,21 @@ namespace EE::Timeline
             TVector<VisualTrackItem>    m_items;
         };
 
+        // Cached set of items (per track) that overlap the view range - only rebuilt when the view or the timeline data changes
+        struct VisibleItemCache
+        {
+            void Reset();
+
+        public:
+
+            TVector<Track const*>       m_tracks;
+            TVector<int32_t>            m_numItemsPerTrack;
+            TVector<TVector<int32_t>>   m_visibleItemIndices;
+            FloatRange                  m_viewRange = FloatRange( 0, 0 );
+            uint32_t                    m_modificationVersion = 0;
+            bool                        m_isValid = false;
+        };
+
     public:
 
         TimelineEditor( TimelineData* pTimelineData, TFunction<void()>& onBeginModification, TFunction<void()>& onEndModification );
@@ -160,6 +175,12 @@ namespace EE::Timeline
         inline TVector<TrackItem*> const& GetSelectedItems() const { return m_selectedItems; }
         void ClearSelection();
 
+        // Timeline Data
+        //-------------------------------------------------------------------------
+
+        // Needs to be called whenever the timeline data is modified externally (i.e. via a property grid or an undo/redo operation)
+        inline void NotifyTimelineDataExternallyModified() { m_visibleItemCache.Reset(); }
+
         // Extensions
         //-------------------------------------------------------------------------
 
@@ -208,6 +229,9 @@ namespace EE::Timeline
         // Called each frame to update the view range
         void UpdateViewRange();
 
+        // Rebuild the set of items overlapping the view range if needed
+        void UpdateVisibleItemCache();
+
         // Reset the view to the full time range
         void ResetViewRange() { m_viewUpdateMode = ViewUpdateMode::ShowFullTimeRange; }
 
@@ -260,6 +284,7 @@ namespace EE::Timeline
         float                       m_pixelsPerFrame = 10.0f;
         bool                        m_hasScrollbar[2] = { false, false };
         TVector<VisualTrack>        m_visualTracks;
+        VisibleItemCache            m_visibleItemCache;
         ImVec2                      m_scrollbarValues;
         ImVec2                      m_desiredTrackAreaSize;
         ImRect                      m_controlsRowRect;
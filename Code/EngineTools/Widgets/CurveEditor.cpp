@@ -208,22 +208,43 @@ namespace EE
         }
     }
 
-    void CurveEditor::DrawCurve( ImDrawList* pDrawList )
+    void CurveEditor::UpdateCachedCurveSamples()
     {
-        int32_t const numPointsToDraw = Math::RoundToInt( m_curveCanvasWidth / 2 ) + 1;
-        float const stepT = m_horizontalRangeLength / ( numPointsToDraw - 1 );
+        int32_t const numPointsToDraw = Math::Max( Math::RoundToInt( m_curveCanvasWidth / 2 ) + 1, 2 );
+
+        bool const isCacheValid = ( (int32_t) m_cachedCurveSamples.size() == numPointsToDraw ) && ( m_cachedHorizontalViewRange == m_horizontalViewRange ) && ( m_cachedCurve == m_curve );
+        if ( isCacheValid )
+        {
+            return;
+        }
 
-        TVector<ImVec2> curvePoints;
+        //-------------------------------------------------------------------------
+
+        m_cachedCurve = m_curve;
+        m_cachedHorizontalViewRange = m_horizontalViewRange;
+
+        float const stepT = m_horizontalRangeLength / ( numPointsToDraw - 1 );
+        m_cachedCurveSamples.resize( numPointsToDraw );
         for ( auto i = 0; i < numPointsToDraw; i++ )
         {
             float const t = m_horizontalViewRange.m_begin + ( i * stepT );
-            Float2 curvePoint( t, m_curve.Evaluate( t ) );
-            curvePoint.m_x = m_curveCanvasStart.m_x + ( m_horizontalViewRange.GetPercentageThrough( curvePoint.m_x ) * m_curveCanvasWidth );
-            curvePoint.m_y = m_curveCanvasEnd.m_y - ( m_verticalViewRange.GetPercentageThrough( curvePoint.m_y ) * m_curveCanvasHeight );
-            curvePoints.emplace_back( curvePoint );
+            m_cachedCurveSamples[i] = Float2( t, m_curve.Evaluate( t ) );
+        }
+    }
+
+    void CurveEditor::DrawCurve( ImDrawList* pDrawList )
+    {
+        UpdateCachedCurveSamples();
+
+        // Samples are in curve space so we only need to remap them to the current canvas
+        int32_t const numPointsToDraw = (int32_t) m_cachedCurveSamples.size();
+        m_curveScreenPoints.resize( numPointsToDraw );
+        for ( auto i = 0; i < numPointsToDraw; i++ )
+        {
+            m_curveScreenPoints[i] = GetScreenPosFromCurvePos( m_cachedCurveSamples[i] );
         }
 
-        pDrawList->AddPolyline( curvePoints.data(), numPointsToDraw, s_curveColor, 0, 2.0f );
+        pDrawList->AddPolyline( m_curveScreenPoints.data(), numPointsToDraw, s_curveColor, 0, 2.0f );
     }
 
     bool CurveEditor::DrawInTangentHandle( ImDrawList* pDrawList, int32_t pointIdx )
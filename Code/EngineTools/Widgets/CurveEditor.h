@@ -79,6 +79,7 @@ namespace EE
         void DrawToolbar();
         void DrawGridAndLegend( ImDrawList* pDrawList );
         void DrawCurve( ImDrawList* pDrawList );
+        void UpdateCachedCurveSamples();
         bool DrawInTangentHandle( ImDrawList* pDrawList, int32_t pointIdx );
         bool DrawOutTangentHandle( ImDrawList* pDrawList, int32_t pointIdx );
         bool DrawPointHandle( ImDrawList* pDrawList, int32_t pointIdx );
@@ -145,5 +146,11 @@ namespace EE
         bool                                                m_wasPointSelected = false;
         bool                                                m_wasCurveEdited = false;
         bool                                                m_requestOpenFullEditor = false;
+
+        // Curve sample cache - the curve is only re-evaluated when either the curve or the horizontal view changes
+        FloatCurve                                          m_cachedCurve;
+        FloatRange                                          m_cachedHorizontalViewRange = FloatRange( 0, 0 );
+        TVector<Float2>                                     m_cachedCurveSamples;
+        TVector<ImVec2>                                     m_curveScreenPoints;
     };
 }
\ No newline at end of file
@@ -129,6 +129,9 @@ namespace EE::AI
         // Is this action active
         inline bool IsActive() const { return m_isActive; }
 
+        // Check whether the start preconditions for this behavior are met
+        virtual bool CanStart( BehaviorContext const& ctx ) const { return true; }
+
         // Try to start this action - this is where you check all the start preconditions
         inline void Start( BehaviorContext const& ctx )
         {
@@ -25,25 +25,84 @@ namespace EE::AI
 
     //-------------------------------------------------------------------------
 
-    void BehaviorSelector::Update()
+    void BehaviorSelector::SelectBehavior()
     {
-        EE_ASSERT( m_actionContext.IsValid() );
+        // Behaviors are stored in increasing priority order
+        Behavior* pSelectedBehavior = nullptr;
+        for ( int32_t i = (int32_t) m_behaviors.size() - 1; i >= 0; i-- )
+        {
+            if ( m_behaviors[i]->CanStart( m_actionContext ) )
+            {
+                pSelectedBehavior = m_behaviors[i];
+                break;
+            }
+        }
+
+        if ( pSelectedBehavior == m_pActiveBehavior )
+        {
+            return;
+        }
 
         //-------------------------------------------------------------------------
 
-        // HACK HACK HACK
-        if ( m_pActiveBehavior == nullptr )
+        if ( m_pActiveBehavior != nullptr )
+        {
+            m_pActiveBehavior->Stop( m_actionContext, Behavior::StopReason::Interrupted );
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_actionLog.emplace_back( m_actionContext.m_pEntityWorldUpdateContext->GetFrameID(), m_pActiveBehavior->GetName(), LoggedStatus::ActionInterrupted );
+            #endif
+        }
+
+        m_pActiveBehavior = pSelectedBehavior;
+
+        if ( m_pActiveBehavior != nullptr )
         {
-            m_pActiveBehavior = m_behaviors.back();
             m_pActiveBehavior->Start( m_actionContext );
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_actionLog.emplace_back( m_actionContext.m_pEntityWorldUpdateContext->GetFrameID(), m_pActiveBehavior->GetName(), LoggedStatus::ActionStarted );
+            #endif
+        }
+    }
+
+    void BehaviorSelector::Update( bool canReselectBehavior )
+    {
+        EE_ASSERT( m_actionContext.IsValid() );
+
+        //-------------------------------------------------------------------------
+
+        if ( canReselectBehavior || m_pActiveBehavior == nullptr )
+        {
+            SelectBehavior();
         }
-        // HACK HACK HACK
 
         //-------------------------------------------------------------------------
 
         if ( m_pActiveBehavior != nullptr )
         {
-            m_pActiveBehavior->Update( m_actionContext );
+            Behavior::Status const status = m_pActiveBehavior->Update( m_actionContext );
+
+            // Finished behaviors are stopped immediately, a new one will be selected on the next update
+            if ( status != Behavior::Status::Running )
+            {
+                m_pActiveBehavior->Stop( m_actionContext, Behavior::StopReason::Completed );
+
+                #if EE_DEVELOPMENT_TOOLS
+                m_actionLog.emplace_back( m_actionContext.m_pEntityWorldUpdateContext->GetFrameID(), m_pActiveBehavior->GetName(), LoggedStatus::ActionCompleted );
+                #endif
+
+                m_pActiveBehavior = nullptr;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_actionLog.size() > 500 )
+        {
+            m_actionLog.erase( m_actionLog.begin(), m_actionLog.end() - 100 );
         }
+        #endif
     }
 }
\ No newline at end of file
@@ -42,8 +42,16 @@ namespace EE::AI
         BehaviorSelector( BehaviorContext const& context );
         ~BehaviorSelector();
 
-        // Update the currently active actions
-        void Update();
+        // Update the currently active behavior, reselection is expensive so it should only be allowed when the AI has been given budget to think
+        // AIs without an active behavior will always select one
+        void Update( bool canReselectBehavior );
+
+        inline Behavior const* GetActiveBehavior() const { return m_pActiveBehavior; }
+
+    private:
+
+        // Pick the highest priority behavior that can run and switch to it if needed
+        void SelectBehavior();
 
     private:
 
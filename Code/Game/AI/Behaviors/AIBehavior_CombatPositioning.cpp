@@ -1,7 +1,7 @@
 #include "AIBehavior_CombatPositioning.h"
 #include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
 #include "Base/Math/MathRandom.h"
-#include "Base/Math/BoundingVolumes.h"
+#include "Engine/Physics/Components/Component_PhysicsCharacter.h"
 
 //-------------------------------------------------------------------------
 
@@ -14,15 +14,6 @@ namespace EE::AI
 
     Behavior::Status CombatPositionBehavior::UpdateInternal( BehaviorContext const& ctx )
     {
-        // Remain in idle if there is no valid navmesh
-        AABB navmeshBounds = ctx.m_pNavmeshSystem->GetNavmeshBounds( 0 );
-        if ( !navmeshBounds.IsValid() )
-        {
-            return Status::Running;
-        }
-
-        //-------------------------------------------------------------------------
-
         if ( m_waitTimer.IsRunning() )
         {
             m_idleAction.Update( ctx );
@@ -30,11 +21,17 @@ namespace EE::AI
             // Wait for the timer to elapse and start a move
             if ( m_waitTimer.Update( ctx.GetDeltaTime() ) )
             {
-                Vector const boundsMin = navmeshBounds.GetMin();
-                Vector const boundsMax = navmeshBounds.GetMax();
-                Vector const moveGoalPosition( Math::GetRandomFloat( boundsMin.GetX(), boundsMax.GetX() ), Math::GetRandomFloat( boundsMin.GetY(), boundsMax.GetY() ), navmeshBounds.GetCenter().GetZ() );
+                Vector moveGoalPosition;
+                if ( SelectMoveGoalPosition( ctx, moveGoalPosition ) )
+                {
+                    m_moveToAction.Start( ctx, moveGoalPosition );
+                }
 
-                m_moveToAction.Start( ctx, moveGoalPosition );
+                // Remain in idle if there is no valid navmesh around us
+                if ( !m_moveToAction.IsRunning() )
+                {
+                    m_waitTimer.Start( Math::GetRandomFloat( 1.0f, 3.0f ) );
+                }
             }
         }
         else // We're moving
@@ -58,6 +55,66 @@ namespace EE::AI
         return Status::Running;
     }
 
+    bool CombatPositionBehavior::SelectMoveGoalPosition( BehaviorContext const& ctx, Vector& outGoalPosition )
+    {
+        Vector const characterPosition = ctx.m_pCharacter->GetPosition();
+
+        // Sample candidate positions
+        //-------------------------------------------------------------------------
+
+        m_candidateQueries.resize( s_numCandidatePositions );
+        for ( auto& query : m_candidateQueries )
+        {
+            query.m_origin = characterPosition;
+            query.m_radius = s_searchRadius;
+            query.m_seed = Math::GetRandomUInt();
+        }
+
+        ctx.m_pNavmeshSystem->FindRandomReachablePoints( m_candidateQueries, m_candidatePositions );
+
+        // Check which candidates we can move straight to
+        //-------------------------------------------------------------------------
+
+        m_raycastQueries.clear();
+        for ( auto const& candidate : m_candidatePositions )
+        {
+            if ( candidate.IsValid() )
+            {
+                m_raycastQueries.push_back( { characterPosition, candidate.m_position } );
+            }
+        }
+
+        if ( m_raycastQueries.empty() )
+        {
+            return false;
+        }
+
+        ctx.m_pNavmeshSystem->Raycasts( m_raycastQueries, m_raycastResults );
+
+        // Score candidates
+        //-------------------------------------------------------------------------
+
+        float bestScore = FLT_MAX;
+        int32_t const numCandidates = (int32_t) m_raycastQueries.size();
+        for ( int32_t i = 0; i < numCandidates; i++ )
+        {
+            Vector const& candidatePosition = m_raycastQueries[i].m_end;
+            float score = Math::Abs( candidatePosition.GetDistance2( characterPosition ) - s_preferredMoveDistance );
+            if ( m_raycastResults[i].HasHit() )
+            {
+                score += s_blockedMovePenalty;
+            }
+
+            if ( score < bestScore )
+            {
+                bestScore = score;
+                outGoalPosition = candidatePosition;
+            }
+        }
+
+        return true;
+    }
+
     void CombatPositionBehavior::StopInternal( BehaviorContext const& ctx, StopReason reason )
     {
 
@@ -2,6 +2,7 @@
 #include "AIBehavior.h"
 #include "Game/AI/Actions/AIAction_MoveTo.h"
 #include "Game/AI/Actions/AIAction_Idle.h"
+#include "Engine/Navmesh/NavmeshQuery.h"
 
 //-------------------------------------------------------------------------
 
@@ -9,6 +10,11 @@ namespace EE::AI
 {
     class CombatPositionBehavior : public Behavior
     {
+        constexpr static float const s_searchRadius = 10.0f;
+        constexpr static float const s_preferredMoveDistance = 5.0f;   // Prefer short repositioning moves over running across the arena
+        constexpr static float const s_blockedMovePenalty = 5.0f;      // Penalty (in meters) for positions we cant move straight to
+        constexpr static int32_t const s_numCandidatePositions = 16;
+
     public:
 
         EE_AI_BEHAVIOR_ID( CombatPositionBehavior );
@@ -19,10 +25,18 @@ namespace EE::AI
         virtual Status UpdateInternal( BehaviorContext const& ctx ) override;
         virtual void StopInternal( BehaviorContext const& ctx, StopReason reason ) override;
 
+        // Pick the best of a batch of reachable positions around us
+        bool SelectMoveGoalPosition( BehaviorContext const& ctx, Vector& outGoalPosition );
+
     private:
 
         MoveToAction                m_moveToAction;
         IdleAction                  m_idleAction;
         ManualCountdownTimer        m_waitTimer;
+
+        TVector<Navmesh::RandomPointQuery>  m_candidateQueries;
+        TVector<Navmesh::PointQueryResult>  m_candidatePositions;
+        TVector<Navmesh::RaycastQuery>      m_raycastQueries;
+        TVector<Navmesh::RaycastResult>     m_raycastResults;
     };
 }
\ No newline at end of file
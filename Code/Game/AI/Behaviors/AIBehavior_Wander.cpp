@@ -1,7 +1,7 @@
 #include "AIBehavior_Wander.h"
 #include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
 #include "Base/Math/MathRandom.h"
-#include "Base/Math/BoundingVolumes.h"
+#include "Engine/Physics/Components/Component_PhysicsCharacter.h"
 
 //-------------------------------------------------------------------------
 
@@ -14,15 +14,6 @@ namespace EE::AI
 
     Behavior::Status WanderBehavior::UpdateInternal( BehaviorContext const& ctx )
     {
-        // Remain in idle if there is no valid navmesh
-        AABB navmeshBounds = ctx.m_pNavmeshSystem->GetNavmeshBounds( 0 );
-        if ( !navmeshBounds.IsValid() )
-        {
-            return Status::Running;
-        }
-
-        //-------------------------------------------------------------------------
-
         if ( m_waitTimer.IsRunning() )
         {
             m_idleAction.Update( ctx );
@@ -30,11 +21,33 @@ namespace EE::AI
             // Wait for the timer to elapse and start a move
             if ( m_waitTimer.Update( ctx.GetDeltaTime() ) )
             {
-                Vector const boundsMin = navmeshBounds.GetMin();
-                Vector const boundsMax = navmeshBounds.GetMax();
-                Vector const moveGoalPosition( Math::GetRandomFloat( boundsMin.GetX(), boundsMax.GetX() ), Math::GetRandomFloat( boundsMin.GetY(), boundsMax.GetY() ), navmeshBounds.GetCenter().GetZ() );
+                // Request a few reachable goals around us in a single batch, so that a single failed sample doesnt leave us idling
+                Vector const characterPosition = ctx.m_pCharacter->GetPosition();
+
+                m_goalQueries.resize( s_numGoalCandidates );
+                for ( auto& query : m_goalQueries )
+                {
+                    query.m_origin = characterPosition;
+                    query.m_radius = s_wanderRadius;
+                    query.m_seed = Math::GetRandomUInt();
+                }
+
+                ctx.m_pNavmeshSystem->FindRandomReachablePoints( m_goalQueries, m_goalQueryResults );
+
+                for ( auto const& result : m_goalQueryResults )
+                {
+                    if ( result.IsValid() )
+                    {
+                        m_moveToAction.Start( ctx, result.m_position );
+                        break;
+                    }
+                }
 
-                m_moveToAction.Start( ctx, moveGoalPosition );
+                // Remain in idle if there is no valid navmesh around us
+                if ( !m_moveToAction.IsRunning() )
+                {
+                    m_waitTimer.Start( Math::GetRandomFloat( 1.0f, 3.0f ) );
+                }
             }
         }
         else // We're moving
@@ -2,6 +2,7 @@
 #include "AIBehavior.h"
 #include "Game/AI/Actions/AIAction_MoveTo.h"
 #include "Game/AI/Actions/AIAction_Idle.h"
+#include "Engine/Navmesh/NavmeshQuery.h"
 
 //-------------------------------------------------------------------------
 
@@ -9,6 +10,9 @@ namespace EE::AI
 {
     class WanderBehavior : public Behavior
     {
+        constexpr static float const s_wanderRadius = 15.0f;
+        constexpr static int32_t const s_numGoalCandidates = 4;
+
     public:
 
         EE_AI_BEHAVIOR_ID( WanderBehavior );
@@ -24,5 +28,8 @@ namespace EE::AI
         MoveToAction                m_moveToAction;
         IdleAction                  m_idleAction;
         ManualCountdownTimer        m_waitTimer;
+
+        TVector<Navmesh::RandomPointQuery>  m_goalQueries;
+        TVector<Navmesh::PointQueryResult>  m_goalQueryResults;
     };
 }
\ No newline at end of file
@@ -54,6 +54,13 @@ namespace EE::AI
     void AIDebugView::DrawOverviewWindow( EntityWorldUpdateContext const& context )
     {
         ImGui::Text( "Num AI: %u", m_pAIManager->m_AIs.size() );
+        ImGui::Text( "Behavior Reselections Scheduled: %u", m_pAIManager->m_numBehaviorReselectionsScheduled );
+
+        int32_t maxReselections = (int32_t) m_pAIManager->GetMaxBehaviorReselectionsPerFrame();
+        if ( ImGui::InputInt( "Max Reselections Per Frame", &maxReselections ) )
+        {
+            m_pAIManager->SetMaxBehaviorReselectionsPerFrame( (uint32_t) Math::Max( maxReselections, 1 ) );
+        }
     }
 }
 #endif
\ No newline at end of file
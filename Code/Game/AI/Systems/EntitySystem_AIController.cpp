@@ -2,11 +2,13 @@
 #include "Game/AI/Physics/AIPhysicsController.h"
 #include "Game/AI/Animation/AIAnimationController.h"
 #include "Engine/AI/Components/Component_AI.h"
+#include "Engine/AI/Systems/WorldSystem_AICrowdManager.h"
 #include "Engine/Navmesh/NavPower.h"
 #include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
 #include "Engine/Physics/Systems/WorldSystem_Physics.h"
 #include "Engine/Physics/Components/Component_PhysicsCharacter.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "Base/Render/RenderViewport.h"
 #include "Base/Types/ScopedValue.h"
 
 //-------------------------------------------------------------------------
@@ -105,6 +107,26 @@ namespace EE::AI
 
     //-------------------------------------------------------------------------
 
+    void AIController::UpdateSignificance( EntityWorldUpdateContext const& ctx )
+    {
+        AIComponent::Significance significance = AIComponent::Significance::High;
+
+        if ( auto pViewport = ctx.GetViewport() )
+        {
+            float const distanceToViewSq = m_behaviorContext.m_pCharacter->GetPosition().GetDistanceSquared3( pViewport->GetViewPosition() );
+            if ( distanceToViewSq > Math::Sqr( s_mediumSignificanceDistance ) )
+            {
+                significance = AIComponent::Significance::Low;
+            }
+            else if ( distanceToViewSq > Math::Sqr( s_highSignificanceDistance ) )
+            {
+                significance = AIComponent::Significance::Medium;
+            }
+        }
+
+        m_behaviorContext.m_pAIComponent->SetSignificance( significance );
+    }
+
     void AIController::Update( EntityWorldUpdateContext const& ctx )
     {
         TScopedGuardValue const contextGuardValue( m_behaviorContext.m_pEntityWorldUpdateContext, &ctx );
@@ -128,13 +150,23 @@ namespace EE::AI
         UpdateStage const updateStage = ctx.GetUpdateStage();
         if ( updateStage == UpdateStage::PrePhysics )
         {
-            m_behaviorSelector.Update();
+            UpdateSignificance( ctx );
+            m_behaviorSelector.Update( m_behaviorContext.m_pAIComponent->CanReselectBehavior() );
 
             // Update animation and get root motion delta (remember that root motion is in character space, so we need to convert the displacement to world space)
             m_pAnimGraphComponent->EvaluateGraph( ctx.GetDeltaTime(), m_pCharacterMeshComponent->GetWorldTransform(), m_behaviorContext.m_pPhysicsWorld );
-            Vector const& deltaTranslation = m_pCharacterMeshComponent->GetWorldTransform().RotateVector( m_pAnimGraphComponent->GetRootMotionDelta().GetTranslation() );
+            Vector deltaTranslation = m_pCharacterMeshComponent->GetWorldTransform().RotateVector( m_pAnimGraphComponent->GetRootMotionDelta().GetTranslation() );
             Quaternion const& deltaRotation = m_pAnimGraphComponent->GetRootMotionDelta().GetRotation();
 
+            // Steer around other agents rather than relying on the character controllers pushing each other apart
+            float const deltaTime = ctx.GetDeltaTime();
+            if ( deltaTime > 0.0f )
+            {
+                auto pCrowdManager = ctx.GetWorldSystem<CrowdManager>();
+                Vector const desiredVelocity = deltaTranslation / deltaTime;
+                deltaTranslation = pCrowdManager->CalculateAgentVelocity( m_behaviorContext.m_pCharacter->GetEntityID(), m_behaviorContext.m_pCharacter->GetPosition(), desiredVelocity ) * deltaTime;
+            }
+
             // Move character
             m_behaviorContext.m_pCharacterController->TryMoveCapsule( ctx, m_behaviorContext.m_pPhysicsWorld, deltaTranslation, deltaRotation );
 
@@ -19,6 +19,10 @@ namespace EE::AI
 
         EE_ENTITY_SYSTEM( AIController, RequiresUpdate( UpdateStage::PrePhysics ), RequiresUpdate( UpdateStage::PostPhysics ) );
 
+        // AIs further away from the view than these distances will reselect their behavior less often
+        constexpr static float const s_highSignificanceDistance = 15.0f;
+        constexpr static float const s_mediumSignificanceDistance = 40.0f;
+
     private:
 
         virtual void PostComponentRegister() override;
@@ -28,6 +32,9 @@ namespace EE::AI
         virtual void UnregisterComponent( EntityComponent* pComponent ) override;
         virtual void Update( EntityWorldUpdateContext const& ctx ) override;
 
+        // Update how significant this AI is to the player, this controls how often the AI manager allows us to reselect our behavior
+        void UpdateSignificance( EntityWorldUpdateContext const& ctx );
+
     private:
 
         BehaviorContext                                         m_behaviorContext;
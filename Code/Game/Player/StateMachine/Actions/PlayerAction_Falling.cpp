@@ -20,7 +20,9 @@ namespace EE::Player
     {
         if( ctx.m_pCharacterComponent->GetInAirTime() > 0.2f )
         {
-            Physics::QueryRules const& filter = ctx.m_pCharacterComponent->GetQueryRules();
+            // This probe is re-issued by every transition that tries to start falling, so share the results within the frame
+            Physics::QueryRules filter = ctx.m_pCharacterComponent->GetQueryRules();
+            filter.SetUseQueryCache( true );
 
             float const capsuleHalfHeight = ctx.m_pCharacterComponent->GetCapsuleHalfHeight();
             float const capsuleRadius = ctx.m_pCharacterComponent->GetCapsuleRadius();